@@ -1,7 +1,9 @@
 // Standard library headers (alphabetical within each group)
 #include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <memory>
+#include <random>
 #include <stdexcept>
 
 // Third-party library headers
@@ -34,6 +36,7 @@
 
 // Project utility headers
 #include "vira/utils/print_utils.hpp"
+#include "vira/utils/profiler.hpp"
 #include "vira/debug.hpp"
 
 namespace vira::cameras {
@@ -58,11 +61,14 @@ namespace vira::cameras {
      * @details Performs lazy initialization of camera subsystems including photosite,
      *          aperture, PSF, noise model, and filter mosaic. Also precomputes
      *          intrinsic matrices, pixel solid angles, and viewing frustum for
-     *          efficient runtime operation.
+     *          efficient runtime operation.  Once initialized, the const methods used
+     *          while rendering do not modify the camera.
      */
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     void Camera<TSpectral, TFloat, TMeshFloat>::initialize()
     {
+        VIRA_PROFILE_ZONE("Camera::initialize");
+
         if (needs_initialization_) {
             std::chrono::high_resolution_clock::time_point start_time;
             std::chrono::high_resolution_clock::time_point stop_time;
@@ -130,7 +136,14 @@ namespace vira::cameras {
 
             // Perform precomputation for efficient runtime operation
             this->initializeIntrinsicMatrix();
-            this->initializePixelSolidAngle();
+
+            // Reuse a restored solid angle table if it was computed for the same (undistorted) intrinsics:
+            bool reuse_solid_angle = restored_solid_angle_ && !hasDistortion() &&
+                pixel_solid_angle_.resolution() == resolution_ && restored_intrinsic_matrix_ == intrinsic_matrix_;
+            if (!reuse_solid_angle) {
+                this->initializePixelSolidAngle();
+            }
+            restored_solid_angle_ = false;
 
             // Configure coordinate system direction
             if (blender_frame_) {
@@ -162,6 +175,11 @@ namespace vira::cameras {
                 std::cout << vira::print::VIRA_INDENT << "Completed (" << duration.count() << " ms)\n" << std::flush;
             }
         }
+
+        // Build the PSF kernels (the PSF may have been replaced since the camera was last initialized):
+        if (psf_) {
+            psf_->initialize();
+        }
     }
 
     // =================================== //
@@ -693,6 +711,20 @@ namespace vira::cameras {
         return *psf_;
     }
 
+    /**
+     * @brief Gets the camera's PSF for use while rendering
+     * @return Reference to the point spread function object
+     * @throws std::runtime_error if PSF is not initialized
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    const PointSpreadFunction<TSpectral, TFloat>& Camera<TSpectral, TFloat, TMeshFloat>::psf() const
+    {
+        if (!psf_) {
+            throw std::runtime_error("PointSpreadFunction not initialized");
+        }
+        return *psf_;
+    }
+
     /**
      * @brief Configures camera to use physically-based Airy disk PSF
      * @details Sets the default PSF to use diffraction-limited Airy disk pattern
@@ -1213,22 +1245,26 @@ namespace vira::cameras {
     /**
      * @brief Simulates complete sensor response including noise
      * @param total_power_image Spectral power image incident on sensor
+     * @param stream Noise stream (the same seed and stream always produce the same noise)
      * @return Simulated sensor output image (normalized 0-1)
      * @details Converts optical power to photon counts, applies sensor noise,
      *          and simulates photosite response to produce final digital image.
      */
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
-    vira::images::Image<float> Camera<TSpectral, TFloat, TMeshFloat>::simulateSensor(const vira::images::Image<TSpectral>& total_power_image) const
+    vira::images::Image<float> Camera<TSpectral, TFloat, TMeshFloat>::simulateSensor(const vira::images::Image<TSpectral>& total_power_image, uint64_t stream) const
     {
+        VIRA_PROFILE_ZONE("Camera::simulateSensor");
+
         // Convert optical power to photon counts
-        vira::images::Image<TSpectral> received_photons = getPhotonCounts(total_power_image);
+        vira::images::Image<TSpectral> received_photons = getPhotonCounts(total_power_image, stream);
 
         // Generate noise for each pixel
         vira::images::Image<float> noise_counts(resolution_, 0);
         if (hasNoiseModel()) {
+            std::mt19937 rng = this->makeRNG(stream, 1);
             for (size_t i = 0; i < static_cast<size_t>(resolution_.x); ++i) {
                 for (size_t j = 0; j < static_cast<size_t>(resolution_.y); ++j) {
-                    noise_counts(i, j) = noise_model_->simulate(rng_, i, j, exposure_time_);
+                    noise_counts(i, j) = noise_model_->simulate(rng, i, j, exposure_time_);
                 }
             }
         }
@@ -1245,25 +1281,29 @@ namespace vira::cameras {
     /**
      * @brief Simulates RGB sensor response including noise
      * @param total_power_image Spectral power image incident on sensor
+     * @param stream Noise stream (the same seed and stream always produce the same noise)
      * @return Simulated RGB sensor output image (normalized 0-1)
      * @details Fast RGB simulation path that converts spectral data to RGB
      *          and processes each color channel independently.
      */
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
-    vira::images::Image<ColorRGB> Camera<TSpectral, TFloat, TMeshFloat>::simulateSensorRGB(const vira::images::Image<TSpectral>& total_power_image) const
+    vira::images::Image<ColorRGB> Camera<TSpectral, TFloat, TMeshFloat>::simulateSensorRGB(const vira::images::Image<TSpectral>& total_power_image, uint64_t stream) const
     {
+        VIRA_PROFILE_ZONE("Camera::simulateSensorRGB");
+
         // Convert optical power to RGB photon counts
-        vira::images::Image<ColorRGB> received_photons = getPhotonCountsRGB(total_power_image);
+        vira::images::Image<ColorRGB> received_photons = getPhotonCountsRGB(total_power_image, stream);
 
         // Generate RGB noise for each pixel
         vira::images::Image<ColorRGB> noise_counts(resolution_, ColorRGB{ 0 });
         if (hasNoiseModel()) {
+            std::mt19937 rng = this->makeRNG(stream, 1);
             for (size_t i = 0; i < static_cast<size_t>(resolution_.x); ++i) {
                 for (size_t j = 0; j < static_cast<size_t>(resolution_.y); ++j) {
                     ColorRGB noise{ 0, 0, 0 };
-                    noise[0] = noise_model_->simulate(rng_, i, j, exposure_time_);
-                    noise[1] = noise_model_->simulate(rng_, i, j, exposure_time_);
-                    noise[2] = noise_model_->simulate(rng_, i, j, exposure_time_);
+                    noise[0] = noise_model_->simulate(rng, i, j, exposure_time_);
+                    noise[1] = noise_model_->simulate(rng, i, j, exposure_time_);
+                    noise[2] = noise_model_->simulate(rng, i, j, exposure_time_);
                     noise_counts(i, j) = noise;
                 }
             }
@@ -1281,14 +1321,16 @@ namespace vira::cameras {
     /**
      * @brief Converts received optical power to photon counts with optional noise
      * @param received_power Spectral power image (W)
+     * @param stream Noise stream (the same seed and stream always produce the same noise)
      * @return Photon count image for each wavelength band
      * @details Converts power to energy using exposure time, then to photons using
      *          photon energies. Applies filter mosaic effects and optional Poisson noise.
      */
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
-    vira::images::Image<TSpectral> Camera<TSpectral, TFloat, TMeshFloat>::getPhotonCounts(const vira::images::Image<TSpectral>& received_power) const
+    vira::images::Image<TSpectral> Camera<TSpectral, TFloat, TMeshFloat>::getPhotonCounts(const vira::images::Image<TSpectral>& received_power, uint64_t stream) const
     {
         vira::images::Image<TSpectral> photon_counts(resolution_, TSpectral{ 0 });
+        std::mt19937 rng = this->makeRNG(stream, 0);
 
         if (hasFilterMosaic()) {
             // Apply color filter array
@@ -1300,7 +1342,7 @@ namespace vira::cameras {
                 if (photon_count.total() >= 1 && simulate_photon_noise_) {
                     for (size_t j = 0; j < TSpectral::size(); ++j) {
                         std::poisson_distribution<int> dist(photon_count[j]);
-                        photon_count[j] = static_cast<float>(dist(rng_));
+                        photon_count[j] = static_cast<float>(dist(rng));
                     }
                 }
 
@@ -1317,7 +1359,7 @@ namespace vira::cameras {
                 if (photon_count.total() >= 1 && simulate_photon_noise_) {
                     for (size_t j = 0; j < TSpectral::size(); ++j) {
                         std::poisson_distribution<int> dist(photon_count[j]);
-                        photon_count[j] = static_cast<float>(dist(rng_));
+                        photon_count[j] = static_cast<float>(dist(rng));
                     }
                 }
 
@@ -1331,14 +1373,16 @@ namespace vira::cameras {
     /**
      * @brief Converts received optical power to RGB photon counts with optional noise
      * @param received_power Spectral power image (W)
+     * @param stream Noise stream (the same seed and stream always produce the same noise)
      * @return RGB photon count image
      * @details Fast RGB conversion path that applies spectral-to-RGB transformation
      *          and computes photon counts for each RGB channel independently.
      */
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
-    vira::images::Image<ColorRGB> Camera<TSpectral, TFloat, TMeshFloat>::getPhotonCountsRGB(const vira::images::Image<TSpectral>& received_power) const
+    vira::images::Image<ColorRGB> Camera<TSpectral, TFloat, TMeshFloat>::getPhotonCountsRGB(const vira::images::Image<TSpectral>& received_power, uint64_t stream) const
     {
         vira::images::Image<ColorRGB> photon_counts(resolution_, ColorRGB{ 0 });
+        std::mt19937 rng = this->makeRNG(stream, 0);
 
         if (hasFilterMosaic()) {
             // Apply color filter array and convert to RGB
@@ -1351,7 +1395,7 @@ namespace vira::cameras {
                 if (photon_count.total() >= 1 && simulate_photon_noise_) {
                     for (size_t j = 0; j < ColorRGB::size(); ++j) {
                         std::poisson_distribution<int> dist(static_cast<double>(photon_count[j]));
-                        photon_count[j] = static_cast<float>(dist(rng_));
+                        photon_count[j] = static_cast<float>(dist(rng));
                     }
                 }
 
@@ -1369,7 +1413,7 @@ namespace vira::cameras {
                 if (photon_count.total() >= 1 && simulate_photon_noise_) {
                     for (size_t j = 0; j < ColorRGB::size(); ++j) {
                         std::poisson_distribution<int> dist(static_cast<double>(photon_count[j]));
-                        photon_count[j] = static_cast<float>(dist(rng_));
+                        photon_count[j] = static_cast<float>(dist(rng));
                     }
                 }
 
@@ -1380,6 +1424,21 @@ namespace vira::cameras {
         return photon_counts;
     }
 
+    /**
+     * @brief Creates a random number generator for a single sensor simulation
+     * @param stream Noise stream, supplied by the caller (e.g. a per-render counter)
+     * @param component Which noise source the generator drives (photon noise or sensor noise)
+     * @return Generator seeded from the camera's seed, the stream, and the component
+     * @details The generator depends only on its inputs, so sensor simulations are reproducible and
+     *          may run concurrently without sharing generator state.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    std::mt19937 Camera<TSpectral, TFloat, TMeshFloat>::makeRNG(uint64_t stream, uint32_t component) const
+    {
+        std::seed_seq seed{ rng_seed_, static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32), component };
+        return std::mt19937(seed);
+    }
+
     // ============================= //
     // === Geometry Computations === //
     // ============================= //
@@ -1396,6 +1455,19 @@ namespace vira::cameras {
         return (-z_dir_ * point[2]) >= 0;
     }
 
+    /**
+     * @brief Computes the distance of a point in front of the camera, along the boresight
+     * @param point 3D point in camera coordinate system
+     * @return Distance along the boresight (negative if the point is behind the camera)
+     * @details Accounts for coordinate system orientation in the same way as behind(), and is
+     *          used to clip geometry against a near plane.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    TFloat Camera<TSpectral, TFloat, TMeshFloat>::boresightDistance(const vec3<TFloat>& point) const
+    {
+        return static_cast<TFloat>(z_dir_) * point[2];
+    }
+
     /**
      * @brief Calculates Ground Sample Distance (GSD) at a given distance
      * @param distance Distance from camera to target in meters
@@ -77,6 +77,32 @@ namespace vira::cameras {
         return new_kernel;
     }
 
+    /**
+     * @brief Builds the pre-computed kernels, if they have not been built yet
+     * @details Called by Camera::initialize(), so the const accessors may be used while rendering.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat>
+    void PointSpreadFunction<TSpectral, TFloat>::initialize()
+    {
+        if (!initialized_kernels_) {
+            this->initKernels();
+        }
+    }
+
+    /**
+     * @brief Gets appropriate kernel size based on received power and minimum threshold
+     * @param received_power Spectral power received by the detector
+     * @param minimum_power Minimum power threshold for kernel truncation
+     * @return PSF kernel appropriately sized for the power level
+     * @details Builds the pre-computed kernels on first use.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat>
+    vira::images::Image<TSpectral> PointSpreadFunction<TSpectral, TFloat>::getKernel(TSpectral received_power, float minimum_power)
+    {
+        this->initialize();
+        return static_cast<const PointSpreadFunction&>(*this).getKernel(received_power, minimum_power);
+    }
+
     /**
      * @brief Gets appropriate kernel size based on received power and minimum threshold
      * @param received_power Spectral power received by the detector
@@ -84,12 +110,13 @@ namespace vira::cameras {
      * @return PSF kernel appropriately sized for the power level
      * @details Selects smallest kernel where edge power exceeds minimum threshold,
      *          preventing unnecessary computation for low-power sources
+     * @throws std::runtime_error if the kernels have not been built with initialize()
      */
     template <IsSpectral TSpectral, IsFloat TFloat>
-    vira::images::Image<TSpectral> PointSpreadFunction<TSpectral, TFloat>::getKernel(TSpectral received_power, float minimum_power)
+    vira::images::Image<TSpectral> PointSpreadFunction<TSpectral, TFloat>::getKernel(TSpectral received_power, float minimum_power) const
     {
         if (!initialized_kernels_) {
-            this->initKernels();
+            throw std::runtime_error("PointSpreadFunction kernels have not been initialized");
         }
 
         // If no minimum power specified, return largest kernel
@@ -124,6 +151,20 @@ namespace vira::cameras {
         return received_power * kernel;
     }
 
+    /**
+     * @brief Gets PSF response scaled by received power
+     * @param received_power Spectral power received by the detector
+     * @param minimum_power Minimum power threshold for kernel selection
+     * @return Power-scaled PSF response for realistic image formation
+     * @throws std::runtime_error if the kernels have not been built with initialize()
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat>
+    vira::images::Image<TSpectral> PointSpreadFunction<TSpectral, TFloat>::getResponse(TSpectral received_power, float minimum_power) const
+    {
+        auto kernel = this->getKernel(received_power, minimum_power);
+        return received_power * kernel;
+    }
+
     /**
      * @brief Initializes pre-computed kernels of various sizes for adaptive selection
      * @param kernel_sizes Vector of kernel sizes to pre-compute (must be odd)
@@ -0,0 +1,162 @@
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "glm/glm.hpp"
+
+#include "vira/vec.hpp"
+#include "vira/math.hpp"
+#include "vira/spectral_data.hpp"
+#include "vira/constraints.hpp"
+#include "vira/geometry/vertex.hpp"
+#include "vira/rendering/ray.hpp"
+
+namespace vira::geometry {
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    AnalyticEllipsoid<TSpectral, TMeshFloat>::AnalyticEllipsoid(TMeshFloat radius)
+        : radii{ radius, radius, radius }
+    {
+
+    };
+
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    AnalyticEllipsoid<TSpectral, TMeshFloat>::AnalyticEllipsoid(TMeshFloat equatorial_radius, TMeshFloat polar_radius)
+        : radii{ equatorial_radius, equatorial_radius, polar_radius }
+    {
+
+    };
+
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    AnalyticEllipsoid<TSpectral, TMeshFloat>::AnalyticEllipsoid(vec3<TMeshFloat> new_radii)
+        : radii{ new_radii }
+    {
+
+    };
+
+    /**
+     * @brief Computes the nearest intersection of a ray with the ellipsoid
+     * @param origin Ray origin in the local frame
+     * @param direction Ray direction in the local frame (need not be normalized)
+     * @param t_min Minimum accepted ray parameter
+     * @param t_max Maximum accepted ray parameter
+     * @param[out] t Ray parameter of the intersection
+     * @param[out] angles Parametric longitude and latitude (radians) of the intersection
+     * @return true if an intersection within (t_min, t_max) exists
+     *
+     * @details The ray is scaled into the unit sphere frame and the quadratic is solved in the form given by
+     *          Haines et al. (Ray Tracing Gems, Ch. 7), which avoids the catastrophic cancellation of the
+     *          textbook discriminant when the ray origin is far from the body.
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    bool AnalyticEllipsoid<TSpectral, TMeshFloat>::intersect(const vec3<TMeshFloat>& origin, const vec3<TMeshFloat>& direction, TMeshFloat t_min, TMeshFloat t_max, TMeshFloat& t, vec2<TMeshFloat>& angles) const
+    {
+        vec3<TMeshFloat> o = origin / radii;
+        vec3<TMeshFloat> d = direction / radii;
+
+        TMeshFloat a = glm::dot(d, d);
+        TMeshFloat b = glm::dot(o, d);
+        TMeshFloat c = glm::dot(o, o) - TMeshFloat{ 1 };
+
+        vec3<TMeshFloat> l = o - (b / a) * d;
+        TMeshFloat discriminant = a * (TMeshFloat{ 1 } - glm::dot(l, l));
+        if (discriminant < 0) {
+            return false;
+        }
+
+        TMeshFloat q = -b - std::copysign(std::sqrt(discriminant), b);
+        TMeshFloat t0 = c / q;
+        TMeshFloat t1 = q / a;
+        if (t0 > t1) {
+            std::swap(t0, t1);
+        }
+
+        if (t0 > t_min && t0 < t_max) {
+            t = t0;
+        }
+        else if (t1 > t_min && t1 < t_max) {
+            t = t1;
+        }
+        else {
+            return false;
+        }
+
+        vec3<TMeshFloat> p = o + t * d;
+        angles[0] = std::atan2(p[1], p[0]);
+        angles[1] = std::asin(std::clamp(p[2], TMeshFloat{ -1 }, TMeshFloat{ 1 }));
+        return true;
+    };
+
+    /**
+     * @brief Intersects a ray with the ellipsoid, updating the ray's Interaction if it is the closest hit
+     * @param ray Ray in the local frame
+     * @param mesh_ptr Type-erased pointer to the owning Mesh
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    void AnalyticEllipsoid<TSpectral, TMeshFloat>::intersect(vira::rendering::Ray<TSpectral, TMeshFloat>& ray, void* mesh_ptr) const
+    {
+        // Same self-intersection tolerance as Triangle::intersect:
+        static constexpr TMeshFloat tol = static_cast<TMeshFloat>(0.00001);
+
+        TMeshFloat t;
+        vec2<TMeshFloat> angles;
+        if (intersect(ray.origin, ray.direction, tol, ray.hit.t, t, angles)) {
+            ray.hit.t = t;
+            setInteraction(ray.hit, angles);
+            ray.hit.mesh_ptr = mesh_ptr;
+        }
+    };
+
+    /**
+     * @brief Computes the surface vertex at the given parametric longitude and latitude
+     * @param angles Parametric longitude and latitude (radians)
+     * @return Vertex with the exact position, outward normal, and texture coordinates
+     *
+     * @details Texture coordinates use the planetocentric longitude and latitude of the surface point, wrapped
+     *          to [0, 1) in longitude, matching the mapping used by makeUVSphere().
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    Vertex<TSpectral, TMeshFloat> AnalyticEllipsoid<TSpectral, TMeshFloat>::surfaceVertex(const vec2<TMeshFloat>& angles) const
+    {
+        TMeshFloat clat = std::cos(angles[1]);
+        vec3<TMeshFloat> unit{ clat * std::cos(angles[0]), clat * std::sin(angles[0]), std::sin(angles[1]) };
+
+        Vertex<TSpectral, TMeshFloat> vertex;
+        vertex.position = unit * radii;
+        vertex.normal = glm::normalize(vec3<float>(unit / radii));
+
+        const vec3<TMeshFloat>& p = vertex.position;
+        TMeshFloat lon = std::atan2(p[1], p[0]);
+        TMeshFloat lat = std::atan2(p[2], std::sqrt(p[0] * p[0] + p[1] * p[1]));
+        if (lon < 0) {
+            lon += 2 * PI<TMeshFloat>();
+        }
+        vertex.uv = UV{ static_cast<float>(lon * INV_2_PI<TMeshFloat>()), static_cast<float>(lat / PI<TMeshFloat>() + TMeshFloat{ 0.5 }) };
+
+        return vertex;
+    };
+
+    /**
+     * @brief Fills an Interaction for a hit at the given parametric longitude and latitude
+     * @param hit Interaction to be filled
+     * @param angles Parametric longitude and latitude (radians)
+     *
+     * @details Renderers consume hits as barycentric interpolations of three vertices.  An analytic hit is
+     *          expressed as a degenerate triangle whose vertices all equal the exact surface vertex, with
+     *          barycentric coordinates (1, 0, 0), so that interpolated positions, normals, and texture
+     *          coordinates are exact.
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    void AnalyticEllipsoid<TSpectral, TMeshFloat>::setInteraction(vira::rendering::Interaction<TSpectral, TMeshFloat>& hit, const vec2<TMeshFloat>& angles) const
+    {
+        Vertex<TSpectral, TMeshFloat> vertex = surfaceVertex(angles);
+
+        hit.vert[0] = vertex;
+        hit.vert[1] = vertex;
+        hit.vert[2] = vertex;
+        hit.w = { TMeshFloat{ 1 }, TMeshFloat{ 0 }, TMeshFloat{ 0 } };
+
+        hit.face_normal = vertex.normal;
+        hit.tri_id = 0;
+        hit.material_cache_index = 0;
+    };
+};
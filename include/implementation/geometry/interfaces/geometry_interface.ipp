@@ -1,3 +1,4 @@
+#include <array>
 #include <vector>
 #include <cstdint>
 #include <fstream>
@@ -11,9 +12,12 @@
 #include <set>
 #include <algorithm>
 #include <cctype>
+#include <mutex>
+#include <system_error>
 
 // ASSIMP includes
 #include <assimp/Importer.hpp>
+#include <assimp/DefaultIOSystem.h>
 #include <assimp/Exporter.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
@@ -34,6 +38,8 @@
 #include "vira/materials/lambertian.hpp"
 #include "vira/materials/pbr_material.hpp"
 #include "vira/scene.hpp"
+#include "vira/spice_utils.hpp"
+#include "vira/quipu/mesh_quipu.hpp"
 
 namespace fs = std::filesystem;
 
@@ -41,6 +47,24 @@ namespace fs = std::filesystem;
 #include "material_load.ipp"
 
 namespace vira::geometry {
+    namespace detail {
+        // Records every file ASSIMP opens, so that files referenced by the source file (such as the
+        // material library of an OBJ) can be tracked as dependencies of the mesh cache:
+        class RecordingIOSystem : public Assimp::DefaultIOSystem {
+        public:
+            Assimp::IOStream* Open(const char* pFile, const char* pMode = "rb") override
+            {
+                Assimp::IOStream* stream = Assimp::DefaultIOSystem::Open(pFile, pMode);
+                if (stream != nullptr) {
+                    opened.insert(fs::absolute(fs::path{ pFile }));
+                }
+                return stream;
+            }
+
+            std::set<fs::path> opened;
+        };
+    };
+
     template<IsFloat TFloat>
     mat4<TFloat> assimpToViraMat4(const aiMatrix4x4& assimpMat) {
         mat4<TFloat> viraMat;
@@ -125,6 +149,13 @@ namespace vira::geometry {
      * Preserves complete node hierarchy, applies transformations, loads materials
      * with texture support, and handles multi-mesh nodes by merging geometry.
      *
+     * If a mesh cache directory has been set, the processed buffers, material references,
+     * and node hierarchy are written to a MeshQuipu (keyed on the source file and the
+     * post-processing flags), and later loads bypass ASSIMP entirely.  Any other files
+     * ASSIMP opened (such as the material library of an OBJ) are recorded as dependencies,
+     * so editing them also invalidates the cache.  Files whose materials use embedded
+     * textures are not cached.
+     *
      * @throws std::runtime_error If Assimp fails to load the file
      */
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
@@ -144,15 +175,44 @@ namespace vira::geometry {
             aiProcess_FindInvalidData |
             aiProcess_ValidateDataStructure;
 
-        // Load the ai_scene
+        // Get the directory of the file for relative texture paths
+        fs::path basePath = filepath.parent_path();
+
+        // Attempt to load from the mesh cache:
+        uint64_t sourceKey = 0;
+        fs::path cacheFile;
+        if (!mesh_cache_directory.empty()) {
+            sourceKey = vira::quipu::MeshQuipu<TSpectral, TMeshFloat>::computeSourceKey(filepath, flags, rgbToSpectralKey());
+            cacheFile = vira::quipu::MeshQuipu<TSpectral, TMeshFloat>::cachePath(mesh_cache_directory, filepath, sourceKey);
+
+            if (vira::quipu::MeshQuipu<TSpectral, TMeshFloat>::isValidCache(cacheFile, sourceKey)) {
+                vira::quipu::MeshQuipuData<TSpectral, TMeshFloat> data = vira::quipu::MeshQuipu<TSpectral, TMeshFloat>(cacheFile).read();
+                LoadedMeshes<TFloat> loaded_meshes = addMeshData(scene, basePath, data, nullptr);
+                attachLoDs(scene, loaded_meshes, filepath, sourceKey);
+                return loaded_meshes;
+            }
+        }
+
+        // Load the ai_scene (the importer takes ownership of the IO system):
+        detail::RecordingIOSystem* ioSystem = new detail::RecordingIOSystem();
+        importer.SetIOHandler(ioSystem);
         const aiScene* ai_scene = importer.ReadFile(filepath.string(), flags);
 
         if (!ai_scene || ai_scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !ai_scene->mRootNode) {
             throw std::runtime_error("ASSIMP Error: " + std::string(importer.GetErrorString()));
         }
 
-        // Get the directory of the file for relative texture paths
-        fs::path basePath = filepath.parent_path();
+        vira::quipu::MeshQuipuData<TSpectral, TMeshFloat> data;
+
+        // Files other than the source file (e.g. material libraries) are baked into the material references:
+        std::error_code ec;
+        fs::path sourcePath = fs::weakly_canonical(filepath, ec);
+        for (const fs::path& opened : ioSystem->opened) {
+            fs::path openedPath = fs::weakly_canonical(opened, ec);
+            if (openedPath != sourcePath && fs::exists(opened)) {
+                data.dependencies.push_back(vira::quipu::MeshQuipu<TSpectral, TMeshFloat>::stampDependency(opened));
+            }
+        }
 
         // First pass: collect ALL nodes to preserve hierarchy structure
         std::vector<const aiNode*> all_nodes;
@@ -169,53 +229,31 @@ namespace vira::geometry {
 
         collect_all_nodes(ai_scene->mRootNode);
 
-        // Load materials first
-        size_t totalMaterials = ai_scene->mNumMaterials;
-        std::vector<vira::MaterialID> material_ids(totalMaterials);
-        for (unsigned int i = 0; i < totalMaterials; ++i) {
-            std::unique_ptr<vira::materials::Material<TSpectral>> new_material =
-                createMaterialFromAssimp<TSpectral>(basePath, ai_scene->mMaterials[i], ai_scene, rgbToSpectral_function);
-
-            aiString name;
-            std::string material_name;
-            if (ai_scene->mMaterials[i]->Get(AI_MATKEY_NAME, name) == AI_SUCCESS) {
-                material_name = std::string(name.C_Str());
-            }
-            else {
-                material_name = "Material_" + std::to_string(i);
-            }
+        // Describe materials first
+        bool cacheable = true;
+        data.materials.resize(ai_scene->mNumMaterials);
+        for (unsigned int i = 0; i < ai_scene->mNumMaterials; ++i) {
+            data.materials[i] = describeAssimpMaterial(ai_scene->mMaterials[i], i);
 
-            material_ids[i] = scene.addMaterial(std::move(new_material), material_name);
-        }
-
-        // Count nodes that actually have meshes
-        size_t mesh_count = 0;
-        for (const aiNode* node : all_nodes) {
-            if (node->mNumMeshes > 0) {
-                mesh_count++;
+            // Embedded textures live inside the source file, so cannot be restored from a cache:
+            if (hasEmbeddedTextures(data.materials[i])) {
+                cacheable = false;
             }
         }
 
-        // Create LoadedMeshes with correct mesh count
-        LoadedMeshes<TFloat> loaded_meshes(mesh_count);
-        loaded_meshes.nodes.reserve(all_nodes.size());
-
         // Find root node index
         auto root_it = node_to_index.find(ai_scene->mRootNode);
-        loaded_meshes.root_node = (root_it != node_to_index.end()) ? root_it->second : 0;
-
-        // Create a mapping from node index to mesh indices for this node
-        std::unordered_map<size_t, std::vector<size_t>> node_to_mesh_indices;
-        size_t mesh_idx = 0;
+        data.rootNode = (root_it != node_to_index.end()) ? root_it->second : 0;
 
         // Process all nodes to build the hierarchy
+        data.nodes.reserve(all_nodes.size());
         for (size_t node_idx = 0; node_idx < all_nodes.size(); ++node_idx) {
             const aiNode* ai_node = all_nodes[node_idx];
 
             // Create node structure
-            typename LoadedMeshes<TFloat>::Node node;
+            vira::quipu::MeshQuipuNode node;
             node.name = ai_node->mName.length > 0 ? std::string(ai_node->mName.C_Str()) : ("Node_" + std::to_string(node_idx));
-            node.local_transform = assimpToViraMat4<TFloat>(ai_node->mTransformation);
+            node.localTransform = assimpToViraMat4<double>(ai_node->mTransformation);
 
             // Set up parent-child relationships
             if (ai_node->mParent && node_to_index.find(ai_node->mParent) != node_to_index.end()) {
@@ -241,9 +279,12 @@ namespace vira::geometry {
                 }
 
                 // Create unified buffers for this node's meshes
-                VertexBuffer<TSpectral, TMeshFloat> vertexBuffer;
-                IndexBuffer indexBuffer;
-                std::vector<MaterialID::ValueType> faceMaterialIndices;
+                vira::quipu::MeshQuipuEntry<TSpectral, TMeshFloat> entry;
+                entry.name = node.name;
+
+                VertexBuffer<TSpectral, TMeshFloat>& vertexBuffer = entry.vertexBuffer;
+                IndexBuffer& indexBuffer = entry.indexBuffer;
+                std::vector<MaterialID::ValueType>& faceMaterialIndices = entry.materialIndices;
 
                 vertexBuffer.reserve(totalVertices);
                 indexBuffer.reserve(totalFaces * 3);
@@ -318,12 +359,11 @@ namespace vira::geometry {
 
                 // Create material mapping for this mesh
                 std::unordered_map<MaterialID::ValueType, MaterialID::ValueType> globalToLocalMaterialMap;
-                std::vector<vira::MaterialID> localMaterialIDs;
 
                 MaterialID::ValueType localMaterialIndex = 0;
                 for (MaterialID::ValueType globalMaterialIndex : uniqueMaterialIndices) {
                     globalToLocalMaterialMap[globalMaterialIndex] = localMaterialIndex;
-                    localMaterialIDs.push_back(material_ids[globalMaterialIndex]);
+                    entry.materialReferences.push_back(globalMaterialIndex);
                     localMaterialIndex++;
                 }
 
@@ -332,37 +372,84 @@ namespace vira::geometry {
                     faceMatIndex = globalToLocalMaterialMap[faceMatIndex];
                 }
 
-                // Create the mesh
-                auto new_mesh = std::make_unique<Mesh<TSpectral, TFloat, TMeshFloat>>(
-                    std::move(vertexBuffer),
-                    std::move(indexBuffer),
-                    std::move(faceMaterialIndices)
-                );
-                new_mesh->setSmoothShading(shade_smooth);
+                entry.smoothShading = shade_smooth;
 
-                // Add mesh to scene
-                vira::MeshID meshid = scene.addMesh(std::move(new_mesh), node.name);
+                // Store mesh reference in node
+                node.meshIndices.push_back(data.meshes.size());
+                data.meshes.push_back(std::move(entry));
+            }
 
-                // Apply materials
-                scene[meshid].material_cache_.resize(localMaterialIDs.size());
-                scene[meshid].materialIDs_.resize(localMaterialIDs.size());
+            data.nodes.push_back(std::move(node));
+        }
 
-                for (size_t localIdx = 0; localIdx < localMaterialIDs.size(); ++localIdx) {
-                    vira::MaterialID globalMaterialID = localMaterialIDs[localIdx];
-                    scene[meshid].material_cache_[localIdx] = scene.materials_.at(globalMaterialID).data.get();
-                    scene[meshid].materialIDs_[localIdx] = scene[meshid].material_cache_[localIdx]->getID();
-                }
+        // Write the mesh cache:
+        if (!mesh_cache_directory.empty() && cacheable) {
+            vira::quipu::MeshQuipu<TSpectral, TMeshFloat>::write(cacheFile, data, sourceKey);
+        }
 
-                // Store mesh reference in node
-                node.mesh_indices.push_back(mesh_idx);
-                node_to_mesh_indices[node_idx].push_back(mesh_idx);
+        LoadedMeshes<TFloat> loaded_meshes = addMeshData(scene, basePath, data, ai_scene);
+        attachLoDs(scene, loaded_meshes, filepath, sourceKey);
+        return loaded_meshes;
+    }
 
-                // Store in flat arrays
-                loaded_meshes.mesh_ids[mesh_idx] = meshid;
+    /**
+     * @brief Adds loaded (or cached) mesh data to the scene.
+     *
+     * @param scene Target scene
+     * @param basePath Directory used to resolve relative texture paths
+     * @param data Materials, meshes, and node hierarchy to add (mesh buffers are moved out)
+     * @param ai_scene ASSIMP scene used to resolve embedded textures (may be nullptr)
+     * @return LoadedMeshes<TFloat> containing mesh data and hierarchy
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    LoadedMeshes<TFloat> GeometryInterface<TSpectral, TFloat, TMeshFloat>::addMeshData(vira::Scene<TSpectral, TFloat, TMeshFloat>& scene, const fs::path& basePath, vira::quipu::MeshQuipuData<TSpectral, TMeshFloat>& data, const aiScene* ai_scene) {
+        // Load materials first
+        std::vector<vira::MaterialID> material_ids(data.materials.size());
+        for (size_t i = 0; i < data.materials.size(); ++i) {
+            std::unique_ptr<vira::materials::Material<TSpectral>> new_material =
+                createMaterialFromReference<TSpectral>(basePath, data.materials[i], ai_scene, rgbToSpectral_function);
 
-                mesh_idx++; // Increment mesh index only when we actually create a mesh
+            material_ids[i] = scene.addMaterial(std::move(new_material), data.materials[i].name);
+        }
+
+        // Create the meshes
+        LoadedMeshes<TFloat> loaded_meshes(data.meshes.size());
+        for (size_t mesh_idx = 0; mesh_idx < data.meshes.size(); ++mesh_idx) {
+            auto& entry = data.meshes[mesh_idx];
+
+            auto new_mesh = std::make_unique<Mesh<TSpectral, TFloat, TMeshFloat>>(
+                std::move(entry.vertexBuffer),
+                std::move(entry.indexBuffer),
+                std::move(entry.materialIndices)
+            );
+            new_mesh->setSmoothShading(entry.smoothShading);
+
+            // Add mesh to scene
+            vira::MeshID meshid = scene.addMesh(std::move(new_mesh), entry.name);
+
+            // Apply materials
+            scene[meshid].material_cache_.resize(entry.materialReferences.size());
+            scene[meshid].materialIDs_.resize(entry.materialReferences.size());
+
+            for (size_t localIdx = 0; localIdx < entry.materialReferences.size(); ++localIdx) {
+                vira::MaterialID globalMaterialID = material_ids[entry.materialReferences[localIdx]];
+                scene[meshid].material_cache_[localIdx] = scene.materials_.at(globalMaterialID).data.get();
+                scene[meshid].materialIDs_[localIdx] = scene[meshid].material_cache_[localIdx]->getID();
             }
 
+            loaded_meshes.mesh_ids[mesh_idx] = meshid;
+        }
+
+        // Build the node hierarchy
+        loaded_meshes.root_node = static_cast<size_t>(data.rootNode);
+        loaded_meshes.nodes.reserve(data.nodes.size());
+        for (const auto& quipu_node : data.nodes) {
+            typename LoadedMeshes<TFloat>::Node node(quipu_node.name, vira::mat4<TFloat>(quipu_node.localTransform));
+            node.mesh_indices.assign(quipu_node.meshIndices.begin(), quipu_node.meshIndices.end());
+            node.children.assign(quipu_node.children.begin(), quipu_node.children.end());
+            if (quipu_node.parent != std::numeric_limits<uint64_t>::max()) {
+                node.parent = static_cast<size_t>(quipu_node.parent);
+            }
             loaded_meshes.nodes.push_back(std::move(node));
         }
 
@@ -390,7 +477,7 @@ namespace vira::geometry {
 
         // Fill in the accumulated transforms for all meshes
         for (size_t node_idx = 0; node_idx < loaded_meshes.nodes.size(); ++node_idx) {
-            const auto& mesh_indices = node_to_mesh_indices[node_idx];
+            const auto& mesh_indices = loaded_meshes.nodes[node_idx].mesh_indices;
 
             if (!mesh_indices.empty()) {
                 mat4<TFloat> accumulated_transform = calculateAccumulatedTransform(node_idx);
@@ -407,31 +494,89 @@ namespace vira::geometry {
     }
 
     /**
-     * @brief Loads DSK (Digital Shape Kernel) format files using SPICE.
+     * @brief Attaches level-of-detail pyramids to newly loaded meshes.
      *
-     * @param scene Target scene for loading
-     * @param filepath Path to the DSK file
-     * @return LoadedMeshes<TFloat> containing the loaded DSK mesh
+     * @param scene Scene containing the loaded meshes
+     * @param loaded_meshes The meshes which were loaded
+     * @param filepath Path to the source file
+     * @param sourceKey Mesh cache key of the source file
      *
-     * Loads planetary surface data from NASA SPICE DSK files. Applies coordinate
-     * scaling (x1000) for unit conversion, extracts frame information for naming,
-     * and creates a default Lambertian material with the configured DSK albedo.
+     * Pyramids are stored alongside the mesh cache.  An existing pyramid is reused if
+     * it was generated from the same source file with the same options, otherwise a
+     * new one is generated.  Does nothing unless LoD generation has been enabled.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void GeometryInterface<TSpectral, TFloat, TMeshFloat>::attachLoDs(vira::Scene<TSpectral, TFloat, TMeshFloat>& scene, const LoadedMeshes<TFloat>& loaded_meshes, const fs::path& filepath, uint64_t sourceKey) {
+        if (!generate_lods || mesh_cache_directory.empty()) {
+            return;
+        }
+
+        for (size_t i = 0; i < loaded_meshes.mesh_ids.size(); ++i) {
+            uint64_t lodKey = sourceKey;
+            vira::utils::fnv1aCombine(lodKey, static_cast<uint64_t>(i), lod_options.reduction, static_cast<uint64_t>(lod_options.min_triangles),
+                static_cast<uint64_t>(lod_options.max_levels), lod_options.quantize_positions,
+                lod_options.simplification.boundary_weight, lod_options.simplification.prevent_flips);
+
+            fs::path lodName = filepath.stem().string() + "_lod" + std::to_string(i);
+            fs::path lodFile = vira::quipu::MeshQuipu<TSpectral, TMeshFloat>::cachePath(mesh_cache_directory, lodName, lodKey);
+
+            auto& mesh = scene[loaded_meshes.mesh_ids[i]];
+            if (vira::quipu::MeshQuipu<TSpectral, TMeshFloat>::isValidCache(lodFile, lodKey)) {
+                mesh.loadLoDs(lodFile);
+            }
+            else {
+                mesh.generateLoDs(lodFile, lodKey, lod_options);
+            }
+        }
+    }
+
+    /**
+     * @brief Computes a key identifying the RGB to spectral conversion, for use in mesh cache keys
+     * @return FNV-1a hash of the conversion evaluated at a fixed set of probe colors
      *
-     * @throws SPICE error If DSK file is invalid or no segment is found
-     * @note Requires SPICE library integration
+     * The conversion is an arbitrary function, so it is identified by its output.  Cached vertex
+     * colors converted by a different function (or the same function with different parameters)
+     * then produce a different key.
      */
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
-    LoadedMeshes<TFloat> GeometryInterface<TSpectral, TFloat, TMeshFloat>::loadDSK(vira::Scene<TSpectral, TFloat, TMeshFloat>& scene, const fs::path& filepath) {
-        // DSK implementation (copied from your existing DSK interface)
+    uint64_t GeometryInterface<TSpectral, TFloat, TMeshFloat>::rgbToSpectralKey() const {
+        const std::array<ColorRGB, 7> probes{
+            ColorRGB{ 0.f, 0.f, 0.f }, ColorRGB{ 1.f, 1.f, 1.f }, ColorRGB{ 0.5f, 0.5f, 0.5f },
+            ColorRGB{ 1.f, 0.f, 0.f }, ColorRGB{ 0.f, 1.f, 0.f }, ColorRGB{ 0.f, 0.f, 1.f },
+            ColorRGB{ 0.2f, 0.4f, 0.8f }
+        };
+
+        uint64_t key = vira::utils::FNV1A_OFFSET_BASIS;
+        for (const ColorRGB& probe : probes) {
+            TSpectral spectral = rgbToSpectral_function(probe);
+            for (size_t i = 0; i < TSpectral::size(); ++i) {
+                vira::utils::fnv1aCombine(key, spectral[i]);
+            }
+        }
+        return key;
+    }
+
+    /**
+     * @brief Reads the vertex and index buffers from a DSK file using SPICE.
+     *
+     * @param filepath Path to the DSK file
+     * @param vertexBuffer Output vertex buffer (positions scaled x1000)
+     * @param indexBuffer Output index buffer (zero based)
+     * @param meshName Output name, taken from the DSK frame or the file stem
+     *
+     * Vertices and plates are read in blocks of up to DSK_READ_BLOCK_SIZE elements
+     * per CSPICE call, rather than one element at a time.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void GeometryInterface<TSpectral, TFloat, TMeshFloat>::readDSKBuffers(const fs::path& filepath, VertexBuffer<TSpectral, TMeshFloat>& vertexBuffer, IndexBuffer& indexBuffer, std::string& meshName) {
         SpiceBoolean   found;
         SpiceDLADescr  dladsc;
-        SpiceDouble    verts[1][3];
         SpiceInt       handle;
         SpiceInt       n;
         SpiceInt       np;
         SpiceInt       nv;
-        SpiceInt       nvtx;
-        SpiceInt       plates[1][3];
+
+        std::lock_guard<std::recursive_mutex> lock(spiceMutex());
 
         dasopr_c(filepath.string().c_str(), &handle);
         dlabfs_c(handle, &dladsc, &found);
@@ -447,28 +592,39 @@ namespace vira::geometry {
         size_t numPlates = static_cast<size_t>(np);
         size_t numVertices = static_cast<size_t>(nv);
 
-        VertexBuffer<TSpectral, TMeshFloat> vertexBuffer(numVertices);
-        IndexBuffer indexBuffer(3 * numPlates);
+        vertexBuffer = VertexBuffer<TSpectral, TMeshFloat>(numVertices);
+        indexBuffer = IndexBuffer(3 * numPlates);
+
+        // Read the vertices in blocks:
+        std::vector<SpiceDouble> verts(3 * static_cast<size_t>(std::min<SpiceInt>(nv, DSK_READ_BLOCK_SIZE)));
+        for (SpiceInt start = 0; start < nv; start += n) {
+            SpiceInt room = std::min<SpiceInt>(nv - start, DSK_READ_BLOCK_SIZE);
+            dskv02_c(handle, &dladsc, start + 1, room, &n, reinterpret_cast<SpiceDouble(*)[3]>(verts.data()));
+            if (n <= 0) {
+                break;
+            }
 
-        size_t v_idx = 0;
-        for (auto i = 0; i < nv; i++) {
-            dskv02_c(handle, &dladsc, i + 1, 1, &nvtx, verts);
-            Vertex<TSpectral, TMeshFloat> vertex;
-            vertex.position = vec3<TMeshFloat>(1000 * verts[0][0], 1000 * verts[0][1], 1000 * verts[0][2]);
-            vertexBuffer[v_idx] = vertex;
-            v_idx++;
+            for (size_t i = 0; i < static_cast<size_t>(n); i++) {
+                Vertex<TSpectral, TMeshFloat>& vertex = vertexBuffer[static_cast<size_t>(start) + i];
+                vertex.position = vec3<TMeshFloat>(1000 * verts[3 * i + 0], 1000 * verts[3 * i + 1], 1000 * verts[3 * i + 2]);
+            }
         }
 
-        size_t i_idx = 0;
-        for (auto i = 0; i < np; i++) {
-            dskp02_c(handle, &dladsc, i + 1, 1, &n, plates);
-            for (int j = 0; j < 3; j++) {
-                indexBuffer[i_idx] = static_cast<uint32_t>(plates[0][static_cast<size_t>(j)] - 1);
-                i_idx++;
+        // Read the plates in blocks:
+        std::vector<SpiceInt> plates(3 * static_cast<size_t>(std::min<SpiceInt>(np, DSK_READ_BLOCK_SIZE)));
+        for (SpiceInt start = 0; start < np; start += n) {
+            SpiceInt room = std::min<SpiceInt>(np - start, DSK_READ_BLOCK_SIZE);
+            dskp02_c(handle, &dladsc, start + 1, room, &n, reinterpret_cast<SpiceInt(*)[3]>(plates.data()));
+            if (n <= 0) {
+                break;
+            }
+
+            size_t offset = 3 * static_cast<size_t>(start);
+            for (size_t i = 0; i < 3 * static_cast<size_t>(n); i++) {
+                indexBuffer[offset + i] = static_cast<uint32_t>(plates[i] - 1);
             }
         }
 
-        std::string meshName;
         SpiceDSKDescr dskdsc;
         SpiceChar frameStr[33] = { 0 };
 
@@ -483,6 +639,63 @@ namespace vira::geometry {
         }
 
         dascls_c(handle);
+    }
+
+    /**
+     * @brief Loads DSK (Digital Shape Kernel) format files using SPICE.
+     *
+     * @param scene Target scene for loading
+     * @param filepath Path to the DSK file
+     * @return LoadedMeshes<TFloat> containing the loaded DSK mesh
+     *
+     * Loads planetary surface data from NASA SPICE DSK files. Applies coordinate
+     * scaling (x1000) for unit conversion, extracts frame information for naming,
+     * and creates a default Lambertian material with the configured DSK albedo.
+     *
+     * If a mesh cache directory has been set, the converted buffers are written to a
+     * MeshQuipu the first time the DSK is loaded, and subsequent loads read the cache
+     * directly without calling into SPICE.
+     *
+     * @throws SPICE error If DSK file is invalid or no segment is found
+     * @note Requires SPICE library integration
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    LoadedMeshes<TFloat> GeometryInterface<TSpectral, TFloat, TMeshFloat>::loadDSK(vira::Scene<TSpectral, TFloat, TMeshFloat>& scene, const fs::path& filepath) {
+        VertexBuffer<TSpectral, TMeshFloat> vertexBuffer;
+        IndexBuffer indexBuffer;
+        std::string meshName;
+
+        // Attempt to load from the mesh cache:
+        bool cached = false;
+        uint64_t sourceKey = 0;
+        fs::path cacheFile;
+        if (!mesh_cache_directory.empty()) {
+            sourceKey = vira::quipu::MeshQuipu<TSpectral, TMeshFloat>::computeSourceKey(filepath);
+            cacheFile = vira::quipu::MeshQuipu<TSpectral, TMeshFloat>::cachePath(mesh_cache_directory, filepath, sourceKey);
+
+            if (vira::quipu::MeshQuipu<TSpectral, TMeshFloat>::isValidCache(cacheFile, sourceKey)) {
+                auto meshes = vira::quipu::MeshQuipu<TSpectral, TMeshFloat>(cacheFile).read().meshes;
+                if (meshes.size() == 1) {
+                    vertexBuffer = std::move(meshes[0].vertexBuffer);
+                    indexBuffer = std::move(meshes[0].indexBuffer);
+                    meshName = std::move(meshes[0].name);
+                    cached = true;
+                }
+            }
+        }
+
+        if (!cached) {
+            readDSKBuffers(filepath, vertexBuffer, indexBuffer, meshName);
+
+            if (!mesh_cache_directory.empty()) {
+                vira::quipu::MeshQuipuData<TSpectral, TMeshFloat> data;
+                data.meshes.resize(1);
+                data.meshes[0].name = meshName;
+                data.meshes[0].vertexBuffer = vertexBuffer;
+                data.meshes[0].indexBuffer = indexBuffer;
+                vira::quipu::MeshQuipu<TSpectral, TMeshFloat>::write(cacheFile, data, sourceKey);
+            }
+        }
 
         // Create the DSK material:
         auto new_material = std::make_unique<vira::materials::Lambertian<TSpectral>>();
@@ -504,6 +717,8 @@ namespace vira::geometry {
         loaded_meshes.mesh_ids[0] = meshid;
         loaded_meshes.transformations[0] = vira::mat4<TFloat>(1);
 
+        attachLoDs(scene, loaded_meshes, filepath, sourceKey);
+
         return loaded_meshes;
     }
 
@@ -622,7 +837,7 @@ namespace vira::geometry {
             }
 
             // Set faces
-            const auto& indexBuffer = mesh.getIndexBuffer();
+            const IndexBuffer indexBuffer = mesh.getIndices();
             const auto& faceMaterialIndices = mesh.getMaterialIndices();
 
             ai_mesh->mNumFaces = static_cast<unsigned int>(indexBuffer.size() / 3);
@@ -768,4 +983,41 @@ namespace vira::geometry {
     void GeometryInterface<TSpectral, TFloat, TMeshFloat>::setDSKAlbedo(const TSpectral& albedo) {
         dsk_albedo = albedo;
     }
-}
\ No newline at end of file
+
+    /**
+     * @brief Sets the directory used to cache converted meshes.
+     *
+     * @param directory Directory in which MeshQuipu (.qms) caches are stored (an empty path disables caching)
+     *
+     * When set, meshes converted from slow-to-parse formats (DSK and ASSIMP supported
+     * formats) are written to a binary MeshQuipu on first load.  Caches are keyed on the
+     * source file path, size, modification time, and loader flags, so modifying the source
+     * file invalidates its cache.
+     *
+     * @note Vertex colors are stored after RGB-to-spectral conversion, so caches should be
+     *       cleared if the RGB-to-spectral function is changed.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void GeometryInterface<TSpectral, TFloat, TMeshFloat>::setMeshCacheDirectory(const fs::path& directory) {
+        mesh_cache_directory = directory;
+    }
+
+    /**
+     * @brief Enables automatic level-of-detail generation for loaded meshes.
+     *
+     * @param enable Whether to generate (or reuse) LoD pyramids for loaded meshes
+     * @param options LoD pyramid generation options
+     *
+     * Requires a mesh cache directory (see setMeshCacheDirectory()), as the pyramids
+     * are stored as Mesh Quipus alongside the mesh cache and streamed by level as
+     * the LevelOfDetailManager updates each mesh's target GSD.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void GeometryInterface<TSpectral, TFloat, TMeshFloat>::setGenerateLoDs(bool enable, LoDPyramidOptions options) {
+        if (enable && mesh_cache_directory.empty()) {
+            throw std::runtime_error("A mesh cache directory must be set before enabling LoD generation");
+        }
+        generate_lods = enable;
+        lod_options = options;
+    }
+}
@@ -96,6 +96,10 @@ namespace vira::geometry {
         vira::images::Image<ColorRGB> output;
 
         if (isEmbeddedTexture(texturePathStr)) {
+            if (ai_scene == nullptr) {
+                throw std::runtime_error("Embedded texture " + texturePathStr + " is not available without an ASSIMP scene");
+            }
+
             // Handle embedded texture
             int textureIndex = getEmbeddedTextureIndex(texturePathStr);
             if (textureIndex >= 0 && textureIndex < static_cast<int>(ai_scene->mNumTextures)) {
@@ -144,6 +148,10 @@ namespace vira::geometry {
         vira::images::Image<float> output;
 
         if (isEmbeddedTexture(texturePathStr)) {
+            if (ai_scene == nullptr) {
+                throw std::runtime_error("Embedded texture " + texturePathStr + " is not available without an ASSIMP scene");
+            }
+
             // Handle embedded texture
             int textureIndex = getEmbeddedTextureIndex(texturePathStr);
             if (textureIndex >= 0 && textureIndex < static_cast<int>(ai_scene->mNumTextures)) {
@@ -189,41 +197,86 @@ namespace vira::geometry {
         return output;
     };
 
-    template <IsSpectral TSpectral>
-    std::unique_ptr<vira::materials::Material<TSpectral>> createMaterialFromAssimp(const fs::path& basePath, const aiMaterial* assimpMaterial, const aiScene* ai_scene, std::function<TSpectral(ColorRGB)> rgbToSpectral_function) {
-        std::unique_ptr<vira::materials::Material<TSpectral>> material;
+    static inline vira::quipu::MaterialReference describeAssimpMaterial(const aiMaterial* assimpMaterial, size_t index)
+    {
+        vira::quipu::MaterialReference reference;
 
-        float metallicFactor = 0.0f;
-        float roughnessFactor = 0.5f;
+        aiString name;
+        if (assimpMaterial->Get(AI_MATKEY_NAME, name) == AI_SUCCESS) {
+            reference.name = std::string(name.C_Str());
+        }
+        else {
+            reference.name = "Material_" + std::to_string(index);
+        }
 
         // Try to get metallic/roughness values
-        assimpMaterial->Get(AI_MATKEY_METALLIC_FACTOR, metallicFactor);
-        assimpMaterial->Get(AI_MATKEY_ROUGHNESS_FACTOR, roughnessFactor);
+        assimpMaterial->Get(AI_MATKEY_METALLIC_FACTOR, reference.metalness);
+        assimpMaterial->Get(AI_MATKEY_ROUGHNESS_FACTOR, reference.roughness);
+
+        // Albedo/diffuse color
+        aiColor3D diffuseColor(1.0f, 1.0f, 1.0f);
+        if (assimpMaterial->Get(AI_MATKEY_COLOR_DIFFUSE, diffuseColor) == AI_SUCCESS) {
+            reference.hasDiffuseColor = true;
+            reference.diffuseColor = ColorRGB(diffuseColor.r, diffuseColor.g, diffuseColor.b);
+        }
+
+        // Emission color
+        aiColor3D emissionColor(0.0f, 0.0f, 0.0f);
+        if (assimpMaterial->Get(AI_MATKEY_COLOR_EMISSIVE, emissionColor) == AI_SUCCESS) {
+            reference.emissionColor = ColorRGB(emissionColor.r, emissionColor.g, emissionColor.b);
+        }
+
+        // Texture paths
+        aiString texturePath;
+        if (assimpMaterial->GetTexture(aiTextureType_DIFFUSE, 0, &texturePath) == AI_SUCCESS) {
+            reference.diffuseTexture = std::string(texturePath.C_Str());
+        }
+        if (assimpMaterial->GetTexture(aiTextureType_NORMALS, 0, &texturePath) == AI_SUCCESS ||
+            assimpMaterial->GetTexture(aiTextureType_HEIGHT, 0, &texturePath) == AI_SUCCESS) {
+            reference.normalTexture = std::string(texturePath.C_Str());
+        }
+        if (assimpMaterial->GetTexture(aiTextureType_DIFFUSE_ROUGHNESS, 0, &texturePath) == AI_SUCCESS) {
+            reference.roughnessTexture = std::string(texturePath.C_Str());
+        }
+        if (assimpMaterial->GetTexture(aiTextureType_METALNESS, 0, &texturePath) == AI_SUCCESS) {
+            reference.metalnessTexture = std::string(texturePath.C_Str());
+        }
+        if (assimpMaterial->GetTexture(aiTextureType_EMISSIVE, 0, &texturePath) == AI_SUCCESS) {
+            reference.emissionTexture = std::string(texturePath.C_Str());
+        }
+
+        return reference;
+    }
+
+    static inline bool hasEmbeddedTextures(const vira::quipu::MaterialReference& reference)
+    {
+        return isEmbeddedTexture(reference.diffuseTexture) || isEmbeddedTexture(reference.normalTexture) ||
+            isEmbeddedTexture(reference.roughnessTexture) || isEmbeddedTexture(reference.metalnessTexture) ||
+            isEmbeddedTexture(reference.emissionTexture);
+    }
+
+    template <IsSpectral TSpectral>
+    std::unique_ptr<vira::materials::Material<TSpectral>> createMaterialFromReference(const fs::path& basePath, const vira::quipu::MaterialReference& reference, const aiScene* ai_scene, std::function<TSpectral(ColorRGB)> rgbToSpectral_function) {
+        std::unique_ptr<vira::materials::Material<TSpectral>> material;
 
         // TODO Use a PBR Material once those are supported:
         material = std::make_unique<vira::materials::Lambertian<TSpectral>>();
         //material = std::make_unique<vira::materials::PBRMaterial<TSpectral>>();
 
-        material->setMetalness(metallicFactor);
-        material->setRoughness(roughnessFactor);
+        material->setMetalness(reference.metalness);
+        material->setRoughness(reference.roughness);
 
         // Load albedo/diffuse color
-        aiColor3D diffuseColor(1.0f, 1.0f, 1.0f);
-        if (assimpMaterial->Get(AI_MATKEY_COLOR_DIFFUSE, diffuseColor) == AI_SUCCESS) {
-            ColorRGB rgb(diffuseColor.r, diffuseColor.g, diffuseColor.b);
-
+        if (reference.hasDiffuseColor) {
             // Convert RGB to spectral:
-            material->setAlbedo(rgbToSpectral_function(rgb));
+            material->setAlbedo(rgbToSpectral_function(reference.diffuseColor));
         }
 
         // Load diffuse texture if available
-        aiString texturePath;
-        if (assimpMaterial->GetTexture(aiTextureType_DIFFUSE, 0, &texturePath) == AI_SUCCESS) {
+        if (!reference.diffuseTexture.empty()) {
             try {
-                std::string texturePathStr = std::string(texturePath.C_Str());
-
                 // Read the ASSIMP Texture:
-                vira::images::Image<ColorRGB> albedoImageRGB = readAssimpTextureRGB(ai_scene, basePath, texturePathStr);
+                vira::images::Image<ColorRGB> albedoImageRGB = readAssimpTextureRGB(ai_scene, basePath, reference.diffuseTexture);
 
                 // Convert from sRGB to Linear colorspace:
                 vira::images::Image<TSpectral> albedoImage(albedoImageRGB.resolution());
@@ -235,18 +288,15 @@ namespace vira::geometry {
                 material->setAlbedo(albedoImage);
             }
             catch (const std::exception& e) {
-                std::cerr << "Warning: Failed to load diffuse texture " << texturePath.C_Str() << ": " << e.what() << std::endl;
+                std::cerr << "Warning: Failed to load diffuse texture " << reference.diffuseTexture << ": " << e.what() << std::endl;
             }
         }
 
         // Load normal map if available
-        if (assimpMaterial->GetTexture(aiTextureType_NORMALS, 0, &texturePath) == AI_SUCCESS ||
-            assimpMaterial->GetTexture(aiTextureType_HEIGHT, 0, &texturePath) == AI_SUCCESS) {
+        if (!reference.normalTexture.empty()) {
             try {
-                std::string texturePathStr = std::string(texturePath.C_Str());
-
                 // Read the ASSIMP Texture:
-                vira::images::Image<ColorRGB> normalImageRGB = readAssimpTextureRGB(ai_scene, basePath, texturePathStr);
+                vira::images::Image<ColorRGB> normalImageRGB = readAssimpTextureRGB(ai_scene, basePath, reference.normalTexture);
 
                 // Convert from RGB to Normal vectors:
                 vira::images::Image<vira::vec3<float>> normalMap = vira::images::Image<vec3<float>>(normalImageRGB.resolution());
@@ -261,58 +311,48 @@ namespace vira::geometry {
                 material->setNormalMap(normalMap);
             }
             catch (const std::exception& e) {
-                std::cerr << "Warning: Failed to load normal map texture " << texturePath.C_Str() << ": " << e.what() << std::endl;
+                std::cerr << "Warning: Failed to load normal map texture " << reference.normalTexture << ": " << e.what() << std::endl;
             }
         }
 
         // Load roughness map if available
-        if (assimpMaterial->GetTexture(aiTextureType_DIFFUSE_ROUGHNESS, 0, &texturePath) == AI_SUCCESS) {
+        if (!reference.roughnessTexture.empty()) {
             try {
-                std::string texturePathStr = std::string(texturePath.C_Str());
-
                 // Read the ASSIMP Texture:
-                vira::images::Image<float> roughnessImage = readAssimpTexture(ai_scene, basePath, texturePathStr);
+                vira::images::Image<float> roughnessImage = readAssimpTexture(ai_scene, basePath, reference.roughnessTexture);
 
                 material->setRoughness(roughnessImage);
             }
             catch (const std::exception& e) {
-                std::cerr << "Warning: Failed to load roughness texture " << texturePath.C_Str() << ": " << e.what() << std::endl;
+                std::cerr << "Warning: Failed to load roughness texture " << reference.roughnessTexture << ": " << e.what() << std::endl;
             }
         }
 
         // Load metalness map if available
-        if (assimpMaterial->GetTexture(aiTextureType_METALNESS, 0, &texturePath) == AI_SUCCESS) {
+        if (!reference.metalnessTexture.empty()) {
             try {
-                std::string texturePathStr = std::string(texturePath.C_Str());
-
                 // Read the ASSIMP Texture:
-                vira::images::Image<float> metalnessImage = readAssimpTexture(ai_scene, basePath, texturePathStr);
+                vira::images::Image<float> metalnessImage = readAssimpTexture(ai_scene, basePath, reference.metalnessTexture);
 
                 material->setMetalness(metalnessImage);
             }
             catch (const std::exception& e) {
-                std::cerr << "Warning: Failed to load metalness texture " << texturePath.C_Str() << ": " << e.what() << std::endl;
+                std::cerr << "Warning: Failed to load metalness texture " << reference.metalnessTexture << ": " << e.what() << std::endl;
             }
         }
 
         // Load emission value if available:
-        aiColor3D emissionColor(0.0f, 0.0f, 0.0f);
-        if (assimpMaterial->Get(AI_MATKEY_COLOR_EMISSIVE, emissionColor) == AI_SUCCESS) {
-            if (emissionColor.r > 0.0f || emissionColor.g > 0.0f || emissionColor.b > 0.0f) {
-                ColorRGB rgb(emissionColor.r, emissionColor.g, emissionColor.b);
-
-                // Convert RGB to spectral:
-                material->setEmission(rgbToSpectral_function(vira::images::sRGBToLinear_val(rgb)));
-            }
+        const ColorRGB& emissionColor = reference.emissionColor;
+        if (emissionColor[0] > 0.0f || emissionColor[1] > 0.0f || emissionColor[2] > 0.0f) {
+            // Convert RGB to spectral:
+            material->setEmission(rgbToSpectral_function(vira::images::sRGBToLinear_val(emissionColor)));
         }
 
         // Load emission texture if available
-        if (assimpMaterial->GetTexture(aiTextureType_EMISSIVE, 0, &texturePath) == AI_SUCCESS) {
+        if (!reference.emissionTexture.empty()) {
             try {
-                std::string texturePathStr = std::string(texturePath.C_Str());
-
                 // Read the ASSIMP Texture:
-                vira::images::Image<ColorRGB> emissionImageRGB = readAssimpTextureRGB(ai_scene, basePath, texturePathStr);
+                vira::images::Image<ColorRGB> emissionImageRGB = readAssimpTextureRGB(ai_scene, basePath, reference.emissionTexture);
 
                 // Convert from sRGB to Spectral:
                 vira::images::Image<TSpectral> emissionImage(emissionImageRGB.resolution());
@@ -323,7 +363,7 @@ namespace vira::geometry {
                 material->setEmission(emissionImage);
             }
             catch (const std::exception& e) {
-                std::cerr << "Warning: Failed to load emission texture " << texturePath.C_Str() << ": " << e.what() << std::endl;
+                std::cerr << "Warning: Failed to load emission texture " << reference.emissionTexture << ": " << e.what() << std::endl;
             }
         }
 
@@ -332,4 +372,4 @@ namespace vira::geometry {
 
 }
 
-#endif
\ No newline at end of file
+#endif
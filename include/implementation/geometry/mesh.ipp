@@ -1,24 +1,39 @@
 #include <cstdint>
 #include <vector>
+#include <array>
 #include <memory>
 #include <fstream>
 #include <limits>
 #include <cmath>
+#include <filesystem>
+#include <stdexcept>
+#include <utility>
+#include <algorithm>
+
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+#include "tbb/parallel_reduce.h"
 
 #include "embree3/rtcore.h"
 
 #include "vira/vec.hpp"
 #include "vira/spectral_data.hpp"
 #include "vira/geometry/triangle.hpp"
+#include "vira/geometry/triangle_cluster.hpp"
+#include "vira/geometry/analytic_ellipsoid.hpp"
 #include "vira/geometry/vertex.hpp"
 #include "vira/materials/material.hpp"
 #include "vira/materials/lambertian.hpp"
 #include "vira/constraints.hpp"
 #include "vira/quipu/dem_quipu.hpp"
+#include "vira/quipu/mesh_quipu.hpp"
+#include "vira/geometry/mesh_simplification.hpp"
 #include "vira/rendering/acceleration/vira_blas.hpp"
 #include "vira/rendering/acceleration/embree_blas.hpp"
+#include "vira/rendering/acceleration/analytic_blas.hpp"
 #include "vira/rendering/acceleration/aabb.hpp"
 #include "vira/scene.hpp"
+#include "vira/utils/profiler.hpp"
 
 namespace vira::geometry {
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
@@ -53,13 +68,34 @@ namespace vira::geometry {
         init();
     };
 
+    /**
+     * @brief Constructs a mesh represented by an analytic ellipsoid rather than triangles
+     * @param ellipsoid The ellipsoid, defined in the local frame of the mesh
+     *
+     * @details The mesh has no vertex or index buffers.  Its BLAS intersects the ellipsoid in closed form
+     *          (in both the Vira and Embree acceleration structures), so any number of instances can be
+     *          placed and transformed exactly as with a triangle mesh, with a single material.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    Mesh<TSpectral, TFloat, TMeshFloat>::Mesh(AnalyticEllipsoid<TSpectral, TMeshFloat> ellipsoid) :
+        isAnalytic_{ true }, analyticEllipsoid_{ ellipsoid }
+    {
+        smoothShading = true;
+        init();
+    };
+
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     void Mesh<TSpectral, TFloat, TMeshFloat>::init()
     {
+        // New buffers are always full (they are compacted again by constructTriangles()):
+        compact_ = false;
+        IndexBuffer16().swap(indexBuffer16);
+        std::vector<uint16_t>().swap(quantizedPositions);
+
         numTriangles = static_cast<size_t>(indexBuffer.size() / 3);
 
         // TODO Is this a good check for if normal vectors have been set?
-        if (glm::length(vertexBuffer[0].normal) == 0) {
+        if (!vertexBuffer.empty() && glm::length(vertexBuffer[0].normal) == 0) {
             calculateNormals();
         }
 
@@ -106,6 +142,47 @@ namespace vira::geometry {
             modified = true;
             init();
 
+            // Reapply materials:
+            material_cache_ = material_cache_SAVE;
+            materialIDs_ = materialIDs_SAVE;
+            default_material_cache_ = default_material_cache_SAVE;
+        }
+        else if (hasLoDs_) {
+            // Select the coarsest level which still meets the target GSD (the coarsest level if not visible):
+            const std::vector<float>& gsds = lodQuipu.getGSDs();
+            size_t level = 0;
+            if (std::isinf(targetGSD)) {
+                level = gsds.size() - 1;
+            }
+            else {
+                for (size_t i = 1; i < gsds.size(); ++i) {
+                    if (gsds[i] <= targetGSD) {
+                        level = i;
+                    }
+                    else {
+                        break;
+                    }
+                }
+            }
+
+            if (level == currentLoD) {
+                return;
+            }
+
+            // Save materials to re-apply:
+            std::vector<vira::materials::Material<TSpectral>*> material_cache_SAVE = material_cache_;
+            std::vector<vira::MaterialID> materialIDs_SAVE = materialIDs_;
+            vira::materials::Material<TSpectral>* default_material_cache_SAVE = default_material_cache_;
+
+            vira::quipu::MeshQuipuEntry<TSpectral, TMeshFloat> lod = lodQuipu.readMesh(level);
+            this->vertexBuffer = std::move(lod.vertexBuffer);
+            this->indexBuffer = std::move(lod.indexBuffer);
+            this->materialCacheIndices = std::move(lod.materialIndices);
+            currentLoD = level;
+
+            modified = true;
+            init();
+
             // Reapply materials:
             material_cache_ = material_cache_SAVE;
             materialIDs_ = materialIDs_SAVE;
@@ -113,12 +190,84 @@ namespace vira::geometry {
         }
     };
 
+    /**
+     * @brief Generates a level-of-detail pyramid from the current geometry and attaches it to the mesh
+     * @param filepath Path of the Mesh Quipu to write (the extension is replaced with .qms)
+     * @param sourceKey Key stored in the Mesh Quipu, used to detect stale pyramids when caching
+     * @param options Pyramid generation options
+     *
+     * @details The current buffers are treated as the full resolution level.  Coarser levels are generated
+     *          with quadric edge collapse simplification and selected by updateGSD(), which allows the
+     *          LevelOfDetailManager to reduce the triangle count of distant general meshes in the same way
+     *          as for DEMs.
+     *
+     * @throws std::runtime_error if the mesh is backed by a DEM Quipu (which already carries its own LoDs)
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void Mesh<TSpectral, TFloat, TMeshFloat>::generateLoDs(fs::path filepath, uint64_t sourceKey, LoDPyramidOptions options)
+    {
+        if (hasQuipu_) {
+            throw std::runtime_error("Cannot generate LoDs for a mesh backed by a DEM Quipu");
+        }
+        if (isAnalytic_) {
+            throw std::runtime_error("Cannot generate LoDs for an analytic mesh");
+        }
+        if (hasLoDs_ && currentLoD != 0) {
+            updateGSD(getDefaultGSD());
+        }
+        expand();
+
+        vira::quipu::MeshQuipuData<TSpectral, TMeshFloat> data;
+        data.meshes = buildLoDPyramid(vertexBuffer, indexBuffer, materialCacheIndices, options);
+        for (auto& level : data.meshes) {
+            level.smoothShading = smoothShading;
+        }
+
+        filepath.replace_extension(".qms");
+        vira::quipu::MeshQuipuWriterOptions writerOptions;
+        writerOptions.quantize_positions = options.quantize_positions;
+        vira::quipu::MeshQuipu<TSpectral, TMeshFloat>::write(filepath, data, sourceKey, writerOptions);
+        loadLoDs(filepath);
+
+        if (options.compact_storage) {
+            setCompactStorage(true);
+        }
+    };
+
+    /**
+     * @brief Attaches a previously generated level-of-detail pyramid to the mesh
+     * @param filepath Path to the Mesh Quipu containing the pyramid
+     *
+     * @details The mesh is assumed to currently hold the full resolution (first) level of the pyramid.
+     *
+     * @throws std::runtime_error if the Mesh Quipu is incompatible or empty
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void Mesh<TSpectral, TFloat, TMeshFloat>::loadLoDs(const fs::path& filepath)
+    {
+        if (hasQuipu_) {
+            throw std::runtime_error("Cannot attach LoDs to a mesh backed by a DEM Quipu");
+        }
+
+        vira::quipu::MeshQuipu<TSpectral, TMeshFloat> newQuipu(filepath);
+        if (!newQuipu.isCompatible() || newQuipu.getNumberOfMeshes() == 0) {
+            throw std::runtime_error(filepath.string() + " does not contain a compatible LoD pyramid");
+        }
+
+        lodQuipu = newQuipu;
+        hasLoDs_ = true;
+        currentLoD = 0;
+    };
+
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     float Mesh<TSpectral, TFloat, TMeshFloat>::getDefaultGSD()
     {
         if (hasQuipu_) {
             return quipu.getDefaultGSD();
         }
+        else if (hasLoDs_) {
+            return lodQuipu.getGSDs()[0];
+        }
         else {
             return 0.f;
         }
@@ -130,6 +279,9 @@ namespace vira::geometry {
         if (hasQuipu_) {
             return quipu.getCurrentGSD();
         }
+        else if (hasLoDs_) {
+            return lodQuipu.getGSDs()[currentLoD];
+        }
         else {
             return 0.f;
         }
@@ -173,69 +325,281 @@ namespace vira::geometry {
         }
     };
 
+    /**
+     * @brief Selects whether the mesh keeps compact buffers resident
+     * @param compactStorage If true, eligible meshes are stored compactly
+     *
+     * @details A compact mesh (a triangle mesh with at most 65536 vertices) replaces its IndexBuffer with an
+     *          IndexBuffer16, and its pre-constructed triangles with 16-bit positions quantized relative to the
+     *          mesh bounds.  The ViraBLAS is built and traversed directly from the quantized positions, and an
+     *          EmbreeBLAS is built from the 16-bit indices.  Triangles are only assembled (from the vertex
+     *          buffer) when they are hit or rasterized.
+     *
+     *          Quantization is lossy: the vertex positions are replaced by their decoded values, so that every
+     *          renderer sees the same surface.  Each axis is quantized to 1/65535 of the mesh extent.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void Mesh<TSpectral, TFloat, TMeshFloat>::setCompactStorage(bool compactStorage)
+    {
+        if (compactStorage == compactStorage_) {
+            return;
+        }
+        compactStorage_ = compactStorage;
+
+        if (compactStorage_) {
+            update();
+            constructTriangles();
+        }
+        else {
+            expand();
+        }
+
+        if (scene_ != nullptr) {
+            scene_->markDirty();
+        }
+    };
+
+    /**
+     * @brief Returns a copy of the indices as an IndexBuffer
+     * @details The indices of a compact mesh are widened from its IndexBuffer16.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    IndexBuffer Mesh<TSpectral, TFloat, TMeshFloat>::getIndices() const
+    {
+        if (compact_) {
+            return widenIndexBuffer(indexBuffer16);
+        }
+        return indexBuffer;
+    };
+
+    /**
+     * @brief Gets a triangle of the mesh, assembling it if the mesh is compact
+     * @param index Index of the triangle
+     * @param scratch Storage for an assembled triangle
+     * @return The pre-constructed triangle, or scratch once it has been assembled
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    const Triangle<TSpectral, TMeshFloat>& Mesh<TSpectral, TFloat, TMeshFloat>::getTriangle(size_t index, Triangle<TSpectral, TMeshFloat>& scratch) const
+    {
+        if (!compact_) {
+            return triangles[index];
+        }
+
+        // The vertex positions of a compact mesh hold the decoded quantized positions:
+        const uint16_t* indices = &indexBuffer16[3 * index];
+        scratch = Triangle<TSpectral, TMeshFloat>(vertexBuffer[indices[0]], vertexBuffer[indices[1]], vertexBuffer[indices[2]], smoothShading, materialCacheIndices[index]);
+        return scratch;
+    };
+
+    /**
+     * @brief Gets the vertex positions of a triangle, without assembling the triangle
+     * @param index Index of the triangle
+     * @return The positions of the three vertices of the triangle
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    std::array<vec3<TMeshFloat>, 3> Mesh<TSpectral, TFloat, TMeshFloat>::getTrianglePositions(size_t index) const
+    {
+        if (!compact_) {
+            const Triangle<TSpectral, TMeshFloat>& tri = triangles[index];
+            return { tri.vert[0].position, tri.vert[1].position, tri.vert[2].position };
+        }
+
+        const uint16_t* indices = &indexBuffer16[3 * index];
+        return { vertexBuffer[indices[0]].position, vertexBuffer[indices[1]].position, vertexBuffer[indices[2]].position };
+    };
+
+    /**
+     * @brief Intersects a ray with a triangle of the mesh
+     * @param ray The ray (in the local frame of the mesh), whose hit is updated if the triangle is closer
+     * @param index Index of the triangle
+     * @param mesh_ptr Type-erased pointer to the mesh, recorded in the hit
+     * @details The triangles of a compact mesh are intersected from their quantized positions, and the full
+     *          vertices are only read if the triangle is hit.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void Mesh<TSpectral, TFloat, TMeshFloat>::intersectTriangle(vira::rendering::Ray<TSpectral, TMeshFloat>& ray, size_t index, void* mesh_ptr) const
+    {
+        if (!compact_) {
+            triangles[index].intersect(ray, index, mesh_ptr);
+            return;
+        }
+
+        const uint16_t* indices = &indexBuffer16[3 * index];
+        std::array<Vertex<TSpectral, TMeshFloat>, 3> corners{};
+        for (size_t k = 0; k < 3; ++k) {
+            corners[k].position = dequantizePosition<TMeshFloat>(&quantizedPositions[3 * static_cast<size_t>(indices[k])], positionQuantization);
+        }
+
+        TMeshFloat previous_t = ray.hit.t;
+        Triangle<TSpectral, TMeshFloat>(corners, smoothShading, materialCacheIndices[index]).intersect(ray, index, mesh_ptr);
+        if (ray.hit.t < previous_t) {
+            // Same vertex order as Triangle::intersect():
+            ray.hit.vert[0] = vertexBuffer[indices[1]];
+            ray.hit.vert[1] = vertexBuffer[indices[2]];
+            ray.hit.vert[2] = vertexBuffer[indices[0]];
+        }
+    };
+
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     void Mesh<TSpectral, TFloat, TMeshFloat>::constructTriangles()
     {
         if (modified) {
-            size_t triID = 0;
-            triangles = std::vector<Triangle<TSpectral, TMeshFloat>>(numTriangles);
-            for (size_t i = 0; i < numTriangles; i++) {
-                auto id0 = indexBuffer[3 * i + 0];
-                auto id1 = indexBuffer[3 * i + 1];
-                auto id2 = indexBuffer[3 * i + 2];
-
-                auto v0 = vertexBuffer[id0];
-                auto v1 = vertexBuffer[id1];
-                auto v2 = vertexBuffer[id2];
-
-                Triangle<TSpectral, TMeshFloat> tri(v0, v1, v2, smoothShading, materialCacheIndices[i]);
-                triangles[triID] = tri;
-                triID++;
+            // The positions of a compact mesh may have been modified since it was compacted:
+            if (compact_) {
+                indexBuffer = widenIndexBuffer(indexBuffer16);
+                IndexBuffer16().swap(indexBuffer16);
+                std::vector<uint16_t>().swap(quantizedPositions);
+                compact_ = false;
+            }
+
+            bool eligible = compactStorage_ && !isAnalytic_ && numTriangles > 0 && fitsIndexBuffer16(vertexBuffer.size());
+            if (eligible) {
+                positionQuantization = computePositionQuantization(vertexBuffer);
+                quantizedPositions = quantizePositions(vertexBuffer, positionQuantization);
+                dequantizePositions(quantizedPositions, positionQuantization, vertexBuffer);
             }
+
+            buildTriangleCache();
+
+            if (eligible) {
+                compact();
+            }
+        }
+    };
+
+    /**
+     * @brief Constructs the triangles and triangle clusters from the full (non-compact) buffers
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void Mesh<TSpectral, TFloat, TMeshFloat>::buildTriangleCache()
+    {
+        triangles = std::vector<Triangle<TSpectral, TMeshFloat>>(numTriangles);
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, numTriangles),
+            [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t i = range.begin(); i != range.end(); ++i) {
+                    const auto& v0 = vertexBuffer[indexBuffer[3 * i + 0]];
+                    const auto& v1 = vertexBuffer[indexBuffer[3 * i + 1]];
+                    const auto& v2 = vertexBuffer[indexBuffer[3 * i + 2]];
+
+                    triangles[i] = Triangle<TSpectral, TMeshFloat>(v0, v1, v2, smoothShading, materialCacheIndices[i]);
+                }
+            });
+
+        // Group spatially coherent triangles into clusters for coarse visibility tests and BVH construction:
+        clusterOrder = spatialTriangleOrder(triangles);
+        clusters = buildTriangleClusters(triangles, clusterOrder);
+    };
+
+    /**
+     * @brief Replaces the IndexBuffer and pre-constructed triangles with the compact buffers
+     * @details The quantized positions must already have been computed (see constructTriangles()).
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void Mesh<TSpectral, TFloat, TMeshFloat>::compact()
+    {
+        indexBuffer16 = narrowIndexBuffer(indexBuffer);
+        IndexBuffer().swap(indexBuffer);
+        std::vector<Triangle<TSpectral, TMeshFloat>>().swap(triangles);
+        compact_ = true;
+    };
+
+    /**
+     * @brief Restores the IndexBuffer and pre-constructed triangles of a compact mesh
+     * @details The mesh is compacted again (if compact storage is still enabled) when its BLAS is next built.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void Mesh<TSpectral, TFloat, TMeshFloat>::expand()
+    {
+        if (!compact_) {
+            return;
         }
+
+        indexBuffer = widenIndexBuffer(indexBuffer16);
+        IndexBuffer16().swap(indexBuffer16);
+        std::vector<uint16_t>().swap(quantizedPositions);
+        compact_ = false;
+
+        buildTriangleCache();
+        update();
     };
 
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     void Mesh<TSpectral, TFloat, TMeshFloat>::calculateNormals()
     {
-        // Calculate face normals:
-        for (size_t i = 0; i < indexBuffer.size(); i = i + 3) {
-            size_t i0 = indexBuffer[i + 0];
-            size_t i1 = indexBuffer[i + 1];
-            size_t i2 = indexBuffer[i + 2];
-
-            auto& p0 = vertexBuffer[i0].position;
-            auto& p1 = vertexBuffer[i1].position;
-            auto& p2 = vertexBuffer[i2].position;
-
-            if (!std::isinf(p0[0]) && !std::isinf(p1[0]) && !std::isinf(p2[0])) {
-                vec3<float> e01 = p1 - p0;
-                vec3<float> e02 = p2 - p0;
-                Normal faceNormal = glm::normalize(glm::cross(e01, e02));
-
-                // TODO: Revisit this... as this is not a solution
-                if (!std::isnan(faceNormal[0]) &&
-                    !std::isnan(faceNormal[1]) &&
-                    !std::isnan(faceNormal[2])) {
-                    vertexBuffer[i0].normal = vertexBuffer[i0].normal + faceNormal;
-                    vertexBuffer[i1].normal = vertexBuffer[i1].normal + faceNormal;
-                    vertexBuffer[i2].normal = vertexBuffer[i2].normal + faceNormal;
+        expand();
+
+        size_t nFaces = indexBuffer.size() / 3;
+        size_t nVertices = vertexBuffer.size();
+
+        // Calculate face normals (faces with invalid vertices or zero area are flagged and skipped):
+        std::vector<Normal> faceNormals(nFaces);
+        std::vector<uint8_t> faceValid(nFaces, 0);
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, nFaces),
+            [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t f = range.begin(); f != range.end(); ++f) {
+                    auto& p0 = vertexBuffer[indexBuffer[3 * f + 0]].position;
+                    auto& p1 = vertexBuffer[indexBuffer[3 * f + 1]].position;
+                    auto& p2 = vertexBuffer[indexBuffer[3 * f + 2]].position;
+
+                    if (!std::isinf(p0[0]) && !std::isinf(p1[0]) && !std::isinf(p2[0])) {
+                        vec3<float> e01 = p1 - p0;
+                        vec3<float> e02 = p2 - p0;
+                        Normal faceNormal = glm::normalize(glm::cross(e01, e02));
+
+                        // TODO: Revisit this... as this is not a solution
+                        if (!std::isnan(faceNormal[0]) &&
+                            !std::isnan(faceNormal[1]) &&
+                            !std::isnan(faceNormal[2])) {
+                            faceNormals[f] = faceNormal;
+                            faceValid[f] = 1;
+                        }
+                    }
                 }
-            }
+            });
+
+        // Build the vertex-to-face adjacency.  Faces are listed in increasing order for each vertex, so
+        // that the accumulation below sums in exactly the same order as a serial pass over the faces:
+        std::vector<uint32_t> adjacencyOffsets(nVertices + 1, 0);
+        for (size_t i = 0; i < 3 * nFaces; ++i) {
+            adjacencyOffsets[indexBuffer[i] + 1]++;
+        }
+        for (size_t v = 0; v < nVertices; ++v) {
+            adjacencyOffsets[v + 1] += adjacencyOffsets[v];
         }
 
-        // Normalize vertex normals:
-        for (size_t i = 0; i < vertexBuffer.size(); i++) {
-            if (glm::length(vertexBuffer[i].normal) != 0) {
-                vertexBuffer[i].normal = glm::normalize(vertexBuffer[i].normal);
-            }
+        std::vector<uint32_t> adjacentFaces(3 * nFaces);
+        std::vector<uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+        for (size_t i = 0; i < 3 * nFaces; ++i) {
+            adjacentFaces[fill[indexBuffer[i]]++] = static_cast<uint32_t>(i / 3);
         }
+
+        // Accumulate and normalize vertex normals:
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, nVertices),
+            [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t v = range.begin(); v != range.end(); ++v) {
+                    Normal& normal = vertexBuffer[v].normal;
+                    for (uint32_t a = adjacencyOffsets[v]; a < adjacencyOffsets[v + 1]; ++a) {
+                        uint32_t f = adjacentFaces[a];
+                        if (faceValid[f]) {
+                            normal = normal + faceNormals[f];
+                        }
+                    }
+
+                    if (glm::length(normal) != 0) {
+                        normal = glm::normalize(normal);
+                    }
+                }
+            });
     };
 
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     vec3<TMeshFloat> Mesh<TSpectral, TFloat, TMeshFloat>::calculateCenter()
     {
         vec3<TMeshFloat> center{0, 0, 0};
+        if (isAnalytic_) {
+            return center;
+        }
+
         TMeshFloat valid = 0;
         for (auto& vertex : vertexBuffer) {
             if (!std::isinf(vertex.position[0]) && !std::isinf(vertex.position[1]) && !std::isinf(vertex.position[2])) {
@@ -395,6 +759,8 @@ namespace vira::geometry {
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     void Mesh<TSpectral, TFloat, TMeshFloat>::buildBVH(RTCDevice device, vira::rendering::BVHBuildOptions bvhBuildOptions)
     {
+        VIRA_PROFILE_ZONE("Mesh::buildBVH");
+
         if constexpr (std::same_as<TMeshFloat, float>) {
             if (this->modified) {
                 this->bvh = std::make_unique<vira::rendering::EmbreeBLAS<TSpectral, TFloat>>(device, this, bvhBuildOptions);
@@ -410,21 +776,71 @@ namespace vira::geometry {
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     void Mesh<TSpectral, TFloat, TMeshFloat>::buildBVH(vira::rendering::BVHBuildOptions bvhBuildOptions)
     {
-        if (this->modified) {
+        VIRA_PROFILE_ZONE("Mesh::buildBVH");
+
+        if (this->modified && isAnalytic_) {
+            this->bvh = std::make_unique<vira::rendering::AnalyticBLAS<TSpectral, TFloat, TMeshFloat>>(this, bvhBuildOptions);
+            this->aabb = this->bvh->getAABB();
+            this->modified = false;
+        }
+        else if (this->modified) {
             this->bvh = std::make_unique<vira::rendering::ViraBLAS<TSpectral>>(this, bvhBuildOptions);
             this->aabb = this->bvh->getAABB();
             this->modified = false;
         }
     };
 
+    /**
+     * @brief Returns the number of bytes held by the mesh's buffers and BLAS
+     * @details An Embree BLAS is allocated by the Scene's Embree device, so is only reported by Scene::getMemoryReport().
+     *          Meshes backed by a Quipu file only hold their currently loaded level of detail.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    vira::utils::MemoryUsage Mesh<TSpectral, TFloat, TMeshFloat>::getMemoryUsage() const
+    {
+        vira::utils::MemoryUsage usage;
+        usage.vertices = vira::utils::vectorBytes(vertexBuffer) + vira::utils::vectorBytes(quantizedPositions);
+        usage.indices = vira::utils::vectorBytes(indexBuffer) + vira::utils::vectorBytes(indexBuffer16) + vira::utils::vectorBytes(materialCacheIndices);
+        usage.triangles = vira::utils::vectorBytes(triangles) + vira::utils::vectorBytes(clusters) + vira::utils::vectorBytes(clusterOrder);
+        if (bvh != nullptr) {
+            usage.blas = bvh->getMemoryUsage();
+        }
+        return usage;
+    };
+
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     vira::rendering::AABB<TSpectral, TFloat> Mesh<TSpectral, TFloat, TMeshFloat>::getAABB()
     {
-        if (modified) {
-            // Re-compute AABB
-            for (auto& vert : vertexBuffer) {
-                aabb.grow(vert.position);
-            }
+        if (modified && isAnalytic_) {
+            aabb = vira::rendering::AABB<TSpectral, TFloat>(vec3<TFloat>(analyticEllipsoid_.getMin()), vec3<TFloat>(analyticEllipsoid_.getMax()));
+        }
+        else if (modified && !vertexBuffer.empty()) {
+            // Re-compute AABB (min/max are order independent, so the parallel reduction is exact):
+            using Bounds = std::pair<vec3<TMeshFloat>, vec3<TMeshFloat>>;
+            constexpr TMeshFloat inf = std::numeric_limits<TMeshFloat>::infinity();
+
+            Bounds bounds = tbb::parallel_reduce(tbb::blocked_range<size_t>(0, vertexBuffer.size()),
+                Bounds{ vec3<TMeshFloat>{ inf }, vec3<TMeshFloat>{ -inf } },
+                [&](const tbb::blocked_range<size_t>& range, Bounds local) {
+                    for (size_t i = range.begin(); i != range.end(); ++i) {
+                        const vec3<TMeshFloat>& p = vertexBuffer[i].position;
+                        for (int k = 0; k < 3; ++k) {
+                            local.first[k] = std::min(local.first[k], p[k]);
+                            local.second[k] = std::max(local.second[k], p[k]);
+                        }
+                    }
+                    return local;
+                },
+                [](Bounds a, const Bounds& b) {
+                    for (int k = 0; k < 3; ++k) {
+                        a.first[k] = std::min(a.first[k], b.first[k]);
+                        a.second[k] = std::max(a.second[k], b.second[k]);
+                    }
+                    return a;
+                });
+
+            aabb.grow(vec3<TFloat>(bounds.first));
+            aabb.grow(vec3<TFloat>(bounds.second));
         }
         return aabb;
     };
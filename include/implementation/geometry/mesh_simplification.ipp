@@ -0,0 +1,517 @@
+#include <vector>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <unordered_map>
+#include <functional>
+
+#include "vira/vec.hpp"
+#include "vira/constraints.hpp"
+#include "vira/spectral_data.hpp"
+#include "vira/geometry/vertex.hpp"
+#include "vira/scene/ids.hpp"
+#include "vira/quipu/mesh_quipu.hpp"
+
+namespace vira::geometry {
+    namespace detail {
+        /**
+         * @brief Symmetric 4x4 error quadric, stored as its upper triangle
+         *
+         * Layout is { aa, ab, ac, ad, bb, bc, bd, cc, cd, dd } for a plane ax + by + cz + d = 0.
+         */
+        struct Quadric {
+            std::array<double, 10> q{};
+
+            static Quadric fromPlane(const vec3<double>& n, double d, double weight)
+            {
+                Quadric Q;
+                Q.q = {
+                    weight * n[0] * n[0], weight * n[0] * n[1], weight * n[0] * n[2], weight * n[0] * d,
+                    weight * n[1] * n[1], weight * n[1] * n[2], weight * n[1] * d,
+                    weight * n[2] * n[2], weight * n[2] * d,
+                    weight * d * d
+                };
+                return Q;
+            }
+
+            Quadric& operator+=(const Quadric& other)
+            {
+                for (size_t i = 0; i < q.size(); ++i) {
+                    q[i] += other.q[i];
+                }
+                return *this;
+            }
+
+            Quadric operator+(const Quadric& other) const
+            {
+                Quadric result = *this;
+                result += other;
+                return result;
+            }
+
+            double evaluate(const vec3<double>& p) const
+            {
+                double x = p[0];
+                double y = p[1];
+                double z = p[2];
+                return q[0] * x * x + 2 * q[1] * x * y + 2 * q[2] * x * z + 2 * q[3] * x
+                    + q[4] * y * y + 2 * q[5] * y * z + 2 * q[6] * y
+                    + q[7] * z * z + 2 * q[8] * z
+                    + q[9];
+            }
+
+            // Solves for the position minimizing the quadric error (fails if the system is near singular):
+            bool optimum(vec3<double>& p) const
+            {
+                double a00 = q[0], a01 = q[1], a02 = q[2];
+                double a11 = q[4], a12 = q[5];
+                double a22 = q[7];
+
+                double c00 = a11 * a22 - a12 * a12;
+                double c01 = a02 * a12 - a01 * a22;
+                double c02 = a01 * a12 - a02 * a11;
+                double det = a00 * c00 + a01 * c01 + a02 * c02;
+
+                double scale = std::abs(a00) + std::abs(a11) + std::abs(a22);
+                if (!(std::abs(det) > 1e-10 * scale * scale * scale)) {
+                    return false;
+                }
+
+                double c11 = a00 * a22 - a02 * a02;
+                double c12 = a01 * a02 - a00 * a12;
+                double c22 = a00 * a11 - a01 * a01;
+
+                double b0 = -q[3];
+                double b1 = -q[6];
+                double b2 = -q[8];
+
+                double inv_det = 1. / det;
+                p = vec3<double>{
+                    (c00 * b0 + c01 * b1 + c02 * b2) * inv_det,
+                    (c01 * b0 + c11 * b1 + c12 * b2) * inv_det,
+                    (c02 * b0 + c12 * b1 + c22 * b2) * inv_det
+                };
+                return std::isfinite(p[0]) && std::isfinite(p[1]) && std::isfinite(p[2]);
+            }
+        };
+
+        struct CollapseCandidate {
+            double cost;
+            uint32_t v0;
+            uint32_t v1;
+            uint32_t stamp0;
+            uint32_t stamp1;
+            vec3<double> position;
+
+            bool operator>(const CollapseCandidate& other) const { return cost > other.cost; }
+        };
+
+        inline uint64_t edgeKey(uint32_t a, uint32_t b)
+        {
+            if (a > b) {
+                std::swap(a, b);
+            }
+            return (static_cast<uint64_t>(a) << 32) | static_cast<uint64_t>(b);
+        }
+
+        inline bool isFinite(const vec3<double>& p)
+        {
+            return std::isfinite(p[0]) && std::isfinite(p[1]) && std::isfinite(p[2]);
+        }
+    };
+
+
+    /**
+     * @brief Simplifies a triangle mesh using quadric error metric edge collapses
+     * @param vertexBuffer The vertices of the mesh
+     * @param indexBuffer The triangle indices of the mesh
+     * @param materialIndices Per-triangle material indices (may be empty)
+     * @param target_triangles The number of triangles to simplify down to
+     * @param options Simplification options
+     * @return The simplified buffers, with unused vertices removed
+     *
+     * @details Implements the edge collapse scheme of Garland and Heckbert.  Each vertex accumulates the
+     *          area-weighted plane quadrics of its faces, and the edge whose collapse to its optimal position
+     *          introduces the least error is collapsed first.  Open boundaries and edges between faces of
+     *          different materials receive additional perpendicular constraint planes so that silhouettes and
+     *          material seams are preserved.  Vertex attributes (normal, albedo, uv) are interpolated along the
+     *          collapsed edge.  Triangles with non-finite vertices are discarded.
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    SimplifiedMesh<TSpectral, TMeshFloat> simplifyMesh(const VertexBuffer<TSpectral, TMeshFloat>& vertexBuffer, const IndexBuffer& indexBuffer,
+        const std::vector<MaterialID::ValueType>& materialIndices, size_t target_triangles, MeshSimplificationOptions options)
+    {
+        using detail::Quadric;
+        using detail::CollapseCandidate;
+
+        size_t numVertices = vertexBuffer.size();
+        size_t numFaces = indexBuffer.size() / 3;
+        bool hasMaterials = (materialIndices.size() == numFaces);
+
+        // Working copies (positions are centered for numerical stability):
+        VertexBuffer<TSpectral, TMeshFloat> vertices = vertexBuffer;
+        std::vector<vec3<double>> positions(numVertices);
+        vec3<double> centroid{ 0, 0, 0 };
+        size_t numFinite = 0;
+        for (size_t i = 0; i < numVertices; ++i) {
+            positions[i] = vec3<double>(vertexBuffer[i].position);
+            if (detail::isFinite(positions[i])) {
+                centroid = centroid + positions[i];
+                numFinite++;
+            }
+        }
+        if (numFinite > 0) {
+            centroid = centroid / static_cast<double>(numFinite);
+        }
+        for (auto& p : positions) {
+            p = p - centroid;
+        }
+
+        std::vector<std::array<uint32_t, 3>> faces(numFaces);
+        std::vector<uint8_t> faceAlive(numFaces, 1);
+        std::vector<vec3<double>> faceNormals(numFaces, vec3<double>{ 0, 0, 0 });
+        std::vector<std::vector<uint32_t>> vertexFaces(numVertices);
+        std::vector<Quadric> quadrics(numVertices);
+        size_t aliveFaces = 0;
+
+        for (size_t f = 0; f < numFaces; ++f) {
+            faces[f] = { indexBuffer[3 * f + 0], indexBuffer[3 * f + 1], indexBuffer[3 * f + 2] };
+            const vec3<double>& p0 = positions[faces[f][0]];
+            const vec3<double>& p1 = positions[faces[f][1]];
+            const vec3<double>& p2 = positions[faces[f][2]];
+            if (!detail::isFinite(p0) || !detail::isFinite(p1) || !detail::isFinite(p2)) {
+                faceAlive[f] = 0;
+                continue;
+            }
+            aliveFaces++;
+
+            for (uint32_t v : faces[f]) {
+                vertexFaces[v].push_back(static_cast<uint32_t>(f));
+            }
+
+            vec3<double> n = cross(p1 - p0, p2 - p0);
+            double len = length(n);
+            if (len == 0) {
+                continue;
+            }
+            n = n / len;
+            faceNormals[f] = n;
+
+            Quadric Q = Quadric::fromPlane(n, -dot(n, p0), 0.5 * len);
+            for (uint32_t v : faces[f]) {
+                quadrics[v] += Q;
+            }
+        }
+
+        // Identify open boundaries and material seams:
+        struct EdgeInfo {
+            uint32_t count = 0;
+            MaterialID::ValueType material = 0;
+            bool seam = false;
+        };
+        std::unordered_map<uint64_t, EdgeInfo> edges;
+        edges.reserve(3 * aliveFaces);
+        for (size_t f = 0; f < numFaces; ++f) {
+            if (!faceAlive[f]) {
+                continue;
+            }
+            MaterialID::ValueType material = hasMaterials ? materialIndices[f] : 0;
+            for (size_t e = 0; e < 3; ++e) {
+                EdgeInfo& info = edges[detail::edgeKey(faces[f][e], faces[f][(e + 1) % 3])];
+                if (info.count == 0) {
+                    info.material = material;
+                }
+                else if (info.material != material) {
+                    info.seam = true;
+                }
+                info.count++;
+            }
+        }
+
+        if (options.boundary_weight > 0) {
+            for (size_t f = 0; f < numFaces; ++f) {
+                if (!faceAlive[f]) {
+                    continue;
+                }
+                for (size_t e = 0; e < 3; ++e) {
+                    uint32_t a = faces[f][e];
+                    uint32_t b = faces[f][(e + 1) % 3];
+                    const EdgeInfo& info = edges[detail::edgeKey(a, b)];
+                    if (info.count != 1 && !info.seam) {
+                        continue;
+                    }
+
+                    vec3<double> edge = positions[b] - positions[a];
+                    vec3<double> n = cross(edge, faceNormals[f]);
+                    double len = length(n);
+                    if (len == 0) {
+                        continue;
+                    }
+                    n = n / len;
+
+                    Quadric Q = Quadric::fromPlane(n, -dot(n, positions[a]), static_cast<double>(options.boundary_weight) * dot(edge, edge));
+                    quadrics[a] += Q;
+                    quadrics[b] += Q;
+                }
+            }
+        }
+
+        // Build the initial collapse candidates:
+        std::vector<uint32_t> stamps(numVertices, 0);
+        std::vector<uint8_t> vertexAlive(numVertices, 1);
+
+        auto makeCandidate = [&](uint32_t v0, uint32_t v1) -> CollapseCandidate {
+            Quadric Q = quadrics[v0] + quadrics[v1];
+
+            vec3<double> p;
+            double cost;
+            if (Q.optimum(p)) {
+                cost = Q.evaluate(p);
+            }
+            else {
+                // Fall back to the best of the endpoints and midpoint:
+                std::array<vec3<double>, 3> options_p{ positions[v0], positions[v1], 0.5 * (positions[v0] + positions[v1]) };
+                p = options_p[0];
+                cost = Q.evaluate(p);
+                for (size_t i = 1; i < 3; ++i) {
+                    double c = Q.evaluate(options_p[i]);
+                    if (c < cost) {
+                        cost = c;
+                        p = options_p[i];
+                    }
+                }
+            }
+
+            return CollapseCandidate{ std::max(cost, 0.), v0, v1, stamps[v0], stamps[v1], p };
+        };
+
+        std::priority_queue<CollapseCandidate, std::vector<CollapseCandidate>, std::greater<CollapseCandidate>> heap;
+        for (const auto& [key, info] : edges) {
+            (void)info;
+            heap.push(makeCandidate(static_cast<uint32_t>(key >> 32), static_cast<uint32_t>(key & 0xFFFFFFFF)));
+        }
+
+        // Checks if moving a vertex would flip any of its faces (faces shared by the edge are removed, so are ignored):
+        auto flips = [&](uint32_t v, uint32_t other, const vec3<double>& p) -> bool {
+            for (uint32_t f : vertexFaces[v]) {
+                if (!faceAlive[f]) {
+                    continue;
+                }
+                const auto& face = faces[f];
+                if (face[0] == other || face[1] == other || face[2] == other) {
+                    continue;
+                }
+
+                std::array<vec3<double>, 3> corners{ positions[face[0]], positions[face[1]], positions[face[2]] };
+                vec3<double> n_old = cross(corners[1] - corners[0], corners[2] - corners[0]);
+                for (size_t i = 0; i < 3; ++i) {
+                    if (face[i] == v) {
+                        corners[i] = p;
+                    }
+                }
+                vec3<double> n_new = cross(corners[1] - corners[0], corners[2] - corners[0]);
+                if (dot(n_old, n_new) <= 0) {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        // Collapse edges until the target is met:
+        std::vector<uint32_t> neighbors;
+        while (aliveFaces > target_triangles && !heap.empty()) {
+            CollapseCandidate candidate = heap.top();
+            heap.pop();
+
+            uint32_t v0 = candidate.v0;
+            uint32_t v1 = candidate.v1;
+            if (!vertexAlive[v0] || !vertexAlive[v1] || candidate.stamp0 != stamps[v0] || candidate.stamp1 != stamps[v1]) {
+                continue;
+            }
+
+            const vec3<double>& p = candidate.position;
+            if (options.prevent_flips && (flips(v0, v1, p) || flips(v1, v0, p))) {
+                continue;
+            }
+
+            // Interpolate vertex attributes along the collapsed edge:
+            vec3<double> edge = positions[v1] - positions[v0];
+            double edge_length2 = dot(edge, edge);
+            float t = 0.5f;
+            if (edge_length2 > 0) {
+                t = static_cast<float>(std::clamp(dot(p - positions[v0], edge) / edge_length2, 0., 1.));
+            }
+
+            Vertex<TSpectral, TMeshFloat>& kept = vertices[v0];
+            const Vertex<TSpectral, TMeshFloat>& removed = vertices[v1];
+            Normal normal = (1.f - t) * kept.normal + t * removed.normal;
+            float normal_length = length(normal);
+            kept.normal = (normal_length > 0) ? normal / normal_length : kept.normal;
+            kept.uv = (1.f - t) * kept.uv + t * removed.uv;
+            kept.albedo = kept.albedo * (1.f - t) + removed.albedo * t;
+            kept.position = vec3<TMeshFloat>(p + centroid);
+
+            positions[v0] = p;
+            quadrics[v0] += quadrics[v1];
+            vertexAlive[v1] = 0;
+            stamps[v0]++;
+
+            // Re-point the faces of the removed vertex:
+            for (uint32_t f : vertexFaces[v1]) {
+                if (!faceAlive[f]) {
+                    continue;
+                }
+                auto& face = faces[f];
+                if (face[0] == v0 || face[1] == v0 || face[2] == v0) {
+                    faceAlive[f] = 0;
+                    aliveFaces--;
+                    continue;
+                }
+                for (auto& v : face) {
+                    if (v == v1) {
+                        v = v0;
+                    }
+                }
+                vertexFaces[v0].push_back(f);
+            }
+            vertexFaces[v1].clear();
+            vertexFaces[v1].shrink_to_fit();
+
+            auto& v0Faces = vertexFaces[v0];
+            v0Faces.erase(std::remove_if(v0Faces.begin(), v0Faces.end(), [&](uint32_t f) { return !faceAlive[f]; }), v0Faces.end());
+
+            // Update the collapse candidates of all edges touching the kept vertex:
+            neighbors.clear();
+            for (uint32_t f : v0Faces) {
+                for (uint32_t v : faces[f]) {
+                    if (v != v0) {
+                        neighbors.push_back(v);
+                    }
+                }
+            }
+            std::sort(neighbors.begin(), neighbors.end());
+            neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+            for (uint32_t n : neighbors) {
+                heap.push(makeCandidate(v0, n));
+            }
+        }
+
+        // Compact the remaining geometry:
+        SimplifiedMesh<TSpectral, TMeshFloat> output;
+        std::vector<uint32_t> remap(numVertices, std::numeric_limits<uint32_t>::max());
+        output.indexBuffer.reserve(3 * aliveFaces);
+        if (hasMaterials) {
+            output.materialIndices.reserve(aliveFaces);
+        }
+
+        for (size_t f = 0; f < numFaces; ++f) {
+            if (!faceAlive[f]) {
+                continue;
+            }
+            for (uint32_t v : faces[f]) {
+                if (remap[v] == std::numeric_limits<uint32_t>::max()) {
+                    remap[v] = static_cast<uint32_t>(output.vertexBuffer.size());
+                    output.vertexBuffer.push_back(vertices[v]);
+                }
+                output.indexBuffer.push_back(remap[v]);
+            }
+            if (hasMaterials) {
+                output.materialIndices.push_back(materialIndices[f]);
+            }
+        }
+
+        return output;
+    };
+
+    /**
+     * @brief Estimates the ground sample distance of a mesh as its mean edge length
+     * @param vertexBuffer The vertices of the mesh
+     * @param indexBuffer The triangle indices of the mesh
+     * @return The mean edge length of all triangles with finite vertices (0 if there are none)
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    float estimateMeshGSD(const VertexBuffer<TSpectral, TMeshFloat>& vertexBuffer, const IndexBuffer& indexBuffer)
+    {
+        double total = 0;
+        size_t count = 0;
+        for (size_t i = 0; i + 2 < indexBuffer.size(); i += 3) {
+            vec3<double> p0 = vec3<double>(vertexBuffer[indexBuffer[i + 0]].position);
+            vec3<double> p1 = vec3<double>(vertexBuffer[indexBuffer[i + 1]].position);
+            vec3<double> p2 = vec3<double>(vertexBuffer[indexBuffer[i + 2]].position);
+            if (!detail::isFinite(p0) || !detail::isFinite(p1) || !detail::isFinite(p2)) {
+                continue;
+            }
+            total += length(p1 - p0) + length(p2 - p1) + length(p0 - p2);
+            count += 3;
+        }
+
+        if (count == 0) {
+            return 0.f;
+        }
+        return static_cast<float>(total / static_cast<double>(count));
+    };
+
+    /**
+     * @brief Builds a level-of-detail pyramid by repeatedly simplifying a mesh
+     * @param vertexBuffer The vertices of the full resolution mesh
+     * @param indexBuffer The triangle indices of the full resolution mesh
+     * @param materialIndices Per-triangle material indices (may be empty)
+     * @param options Pyramid generation options
+     * @return The levels, ordered from the full resolution mesh to the coarsest, each tagged with its GSD
+     *
+     * @details Each level is simplified from the previous one, retaining options.reduction of its triangles.
+     *          Generation stops once a level falls below options.min_triangles, options.max_levels is reached,
+     *          or the simplifier can no longer make meaningful progress.
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    std::vector<vira::quipu::MeshQuipuEntry<TSpectral, TMeshFloat>> buildLoDPyramid(const VertexBuffer<TSpectral, TMeshFloat>& vertexBuffer, const IndexBuffer& indexBuffer,
+        const std::vector<MaterialID::ValueType>& materialIndices, LoDPyramidOptions options)
+    {
+        std::vector<vira::quipu::MeshQuipuEntry<TSpectral, TMeshFloat>> levels;
+
+        vira::quipu::MeshQuipuEntry<TSpectral, TMeshFloat> base;
+        base.vertexBuffer = vertexBuffer;
+        base.indexBuffer = indexBuffer;
+        base.materialIndices = materialIndices;
+        base.gsd = estimateMeshGSD(vertexBuffer, indexBuffer);
+        levels.push_back(std::move(base));
+
+        float reduction = std::clamp(options.reduction, 0.01f, 0.95f);
+        while (levels.size() < options.max_levels) {
+            const auto& previous = levels.back();
+            size_t previous_triangles = previous.indexBuffer.size() / 3;
+            if (previous_triangles < options.min_triangles) {
+                break;
+            }
+
+            size_t target = std::max(static_cast<size_t>(1), static_cast<size_t>(reduction * static_cast<float>(previous_triangles)));
+            SimplifiedMesh<TSpectral, TMeshFloat> simplified = simplifyMesh(previous.vertexBuffer, previous.indexBuffer, previous.materialIndices, target, options.simplification);
+
+            // Stop if the simplifier has stalled (e.g. all remaining collapses would flip faces):
+            size_t triangles = simplified.indexBuffer.size() / 3;
+            if (triangles == 0 || static_cast<float>(triangles) > 0.9f * static_cast<float>(previous_triangles)) {
+                break;
+            }
+
+            vira::quipu::MeshQuipuEntry<TSpectral, TMeshFloat> level;
+            level.gsd = estimateMeshGSD(simplified.vertexBuffer, simplified.indexBuffer);
+
+            // GSD must increase monotonically for LoD selection:
+            float expected_gsd = previous.gsd * std::sqrt(static_cast<float>(previous_triangles) / static_cast<float>(triangles));
+            if (!(level.gsd > previous.gsd)) {
+                level.gsd = expected_gsd;
+            }
+
+            level.vertexBuffer = std::move(simplified.vertexBuffer);
+            level.indexBuffer = std::move(simplified.indexBuffer);
+            level.materialIndices = std::move(simplified.materialIndices);
+            levels.push_back(std::move(level));
+        }
+
+        return levels;
+    };
+};
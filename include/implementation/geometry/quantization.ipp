@@ -0,0 +1,162 @@
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+
+#include "glm/glm.hpp"
+
+#include "vira/vec.hpp"
+#include "vira/constraints.hpp"
+#include "vira/spectral_data.hpp"
+#include "vira/geometry/vertex.hpp"
+
+namespace vira::geometry {
+    /**
+     * @brief Tests if every index of a mesh can be stored in an IndexBuffer16
+     * @param vertexCount Number of vertices in the mesh
+     */
+    inline bool fitsIndexBuffer16(size_t vertexCount)
+    {
+        return vertexCount <= static_cast<size_t>(std::numeric_limits<uint16_t>::max()) + 1;
+    };
+
+    /**
+     * @brief Converts an IndexBuffer to an IndexBuffer16
+     * @param indexBuffer The index buffer to be converted
+     * @return The 16-bit index buffer
+     * @throws std::runtime_error if an index does not fit in 16 bits
+     */
+    inline IndexBuffer16 narrowIndexBuffer(const IndexBuffer& indexBuffer)
+    {
+        IndexBuffer16 indexBuffer16(indexBuffer.size());
+        for (size_t i = 0; i < indexBuffer.size(); ++i) {
+            if (indexBuffer[i] > std::numeric_limits<uint16_t>::max()) {
+                throw std::runtime_error("Index " + std::to_string(indexBuffer[i]) + " cannot be stored as a 16-bit index");
+            }
+            indexBuffer16[i] = static_cast<uint16_t>(indexBuffer[i]);
+        }
+        return indexBuffer16;
+    };
+
+    /**
+     * @brief Converts an IndexBuffer16 to an IndexBuffer
+     * @param indexBuffer16 The 16-bit index buffer to be converted
+     * @return The index buffer
+     */
+    inline IndexBuffer widenIndexBuffer(const IndexBuffer16& indexBuffer16)
+    {
+        return IndexBuffer(indexBuffer16.begin(), indexBuffer16.end());
+    };
+
+    /**
+     * @brief Computes the quantization which maps the bounds of a vertex buffer onto 16-bit coordinates
+     * @param vertexBuffer The vertex buffer to be quantized
+     * @return The position quantization
+     * @details The maximum decoding error along each axis is half of the corresponding scale, which is the
+     *          extent of the (finite) vertex positions divided by QUANTIZED_POSITION_MAX.
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    PositionQuantization computePositionQuantization(const VertexBuffer<TSpectral, TMeshFloat>& vertexBuffer)
+    {
+        vec3<double> bmin{ std::numeric_limits<double>::infinity() };
+        vec3<double> bmax{ -std::numeric_limits<double>::infinity() };
+        for (const auto& vertex : vertexBuffer) {
+            vec3<double> p{ vertex.position };
+            if (std::isfinite(p[0]) && std::isfinite(p[1]) && std::isfinite(p[2])) {
+                bmin = glm::min(bmin, p);
+                bmax = glm::max(bmax, p);
+            }
+        }
+
+        PositionQuantization quantization;
+        if (!std::isfinite(bmin[0])) {
+            return quantization;
+        }
+
+        quantization.origin = bmin;
+        for (int k = 0; k < 3; ++k) {
+            double extent = bmax[k] - bmin[k];
+            quantization.scale[k] = (extent > 0) ? extent / QUANTIZED_POSITION_MAX : 1.;
+        }
+        return quantization;
+    };
+
+    /**
+     * @brief Quantizes the positions of a vertex buffer
+     * @param vertexBuffer The vertex buffer to be quantized
+     * @param quantization The quantization to apply (see computePositionQuantization())
+     * @return Interleaved (x, y, z) quantized coordinates
+     * @details Vertices with non-finite positions (as used for DEM no-data regions) are encoded with the
+     *          reserved value, and decode to infinity.
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    std::vector<uint16_t> quantizePositions(const VertexBuffer<TSpectral, TMeshFloat>& vertexBuffer, const PositionQuantization& quantization)
+    {
+        std::vector<uint16_t> quantized(3 * vertexBuffer.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, vertexBuffer.size()),
+            [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t i = range.begin(); i != range.end(); ++i) {
+                    vec3<double> p{ vertexBuffer[i].position };
+                    bool finite = std::isfinite(p[0]) && std::isfinite(p[1]) && std::isfinite(p[2]);
+                    for (int k = 0; k < 3; ++k) {
+                        if (finite) {
+                            double q = std::round((p[k] - quantization.origin[k]) / quantization.scale[k]);
+                            quantized[3 * i + k] = static_cast<uint16_t>(std::clamp(q, 0., static_cast<double>(QUANTIZED_POSITION_MAX)));
+                        }
+                        else {
+                            quantized[3 * i + k] = std::numeric_limits<uint16_t>::max();
+                        }
+                    }
+                }
+            });
+        return quantized;
+    };
+
+    /**
+     * @brief Decodes quantized positions into a vertex buffer
+     * @param quantized Interleaved (x, y, z) quantized coordinates
+     * @param quantization The quantization used to encode the positions
+     * @param vertexBuffer The vertex buffer whose positions are to be written (must already be sized)
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    void dequantizePositions(const std::vector<uint16_t>& quantized, const PositionQuantization& quantization, VertexBuffer<TSpectral, TMeshFloat>& vertexBuffer)
+    {
+        if (quantized.size() != 3 * vertexBuffer.size()) {
+            throw std::runtime_error("Quantized position count does not match the vertex buffer");
+        }
+
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, vertexBuffer.size()),
+            [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t i = range.begin(); i != range.end(); ++i) {
+                    vertexBuffer[i].position = dequantizePosition<TMeshFloat>(&quantized[3 * i], quantization);
+                }
+            });
+    };
+
+    /**
+     * @brief Decodes a single quantized position
+     * @param quantized Pointer to the (x, y, z) quantized coordinates of the position
+     * @param quantization The quantization used to encode the position
+     * @return The decoded position (infinite if a non-finite position was encoded)
+     */
+    template <IsFloat TMeshFloat>
+    vec3<TMeshFloat> dequantizePosition(const uint16_t* quantized, const PositionQuantization& quantization)
+    {
+        if (quantized[0] == std::numeric_limits<uint16_t>::max()) {
+            return vec3<TMeshFloat>{ std::numeric_limits<TMeshFloat>::infinity() };
+        }
+
+        vec3<TMeshFloat> position;
+        for (int k = 0; k < 3; ++k) {
+            position[k] = static_cast<TMeshFloat>(quantization.origin[k] + quantization.scale[k] * quantized[k]);
+        }
+        return position;
+    };
+};
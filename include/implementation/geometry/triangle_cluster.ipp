@@ -0,0 +1,203 @@
+#include <vector>
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <cstdint>
+#include <utility>
+
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+#include "tbb/parallel_sort.h"
+
+#include "vira/math.hpp"
+#include "vira/vec.hpp"
+#include "vira/constraints.hpp"
+#include "vira/geometry/triangle.hpp"
+
+namespace vira::geometry {
+    namespace detail {
+        // Spreads the lower 10 bits of a value so that there are two zero bits between each:
+        inline uint32_t expandMortonBits(uint32_t v)
+        {
+            v = (v * 0x00010001u) & 0xFF0000FFu;
+            v = (v * 0x00000101u) & 0x0F00F00Fu;
+            v = (v * 0x00000011u) & 0xC30C30C3u;
+            v = (v * 0x00000005u) & 0x49249249u;
+            return v;
+        };
+    };
+
+    /**
+     * @brief Computes a spatially coherent ordering of a triangle buffer
+     * @param triangles The triangles to be ordered
+     * @return Triangle indices sorted along a Morton (Z-order) curve through their centroids
+     * @details Triangles with non-finite vertices are placed at the end of the ordering.  Ties are broken by
+     *          triangle index, so the ordering is deterministic.  The triangle buffer itself is not reordered,
+     *          so triangle indices (and therefore triangle IDs reported by renderers) are unaffected.
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    std::vector<uint32_t> spatialTriangleOrder(const std::vector<Triangle<TSpectral, TMeshFloat>>& triangles)
+    {
+        size_t N = triangles.size();
+
+        auto isValid = [&](size_t i) {
+            const Triangle<TSpectral, TMeshFloat>& tri = triangles[i];
+            return !(std::isinf(tri.vert[0].position[0]) || std::isinf(tri.vert[1].position[0]) || std::isinf(tri.vert[2].position[0]));
+        };
+
+        // Compute the bounds of all valid centroids:
+        vec3<TMeshFloat> bmin{ std::numeric_limits<TMeshFloat>::infinity() };
+        vec3<TMeshFloat> bmax{ -std::numeric_limits<TMeshFloat>::infinity() };
+        for (size_t i = 0; i < N; ++i) {
+            if (isValid(i)) {
+                bmin = glm::min(bmin, triangles[i].centroid);
+                bmax = glm::max(bmax, triangles[i].centroid);
+            }
+        }
+        vec3<TMeshFloat> extent = bmax - bmin;
+        TMeshFloat scale = std::max(extent[0], std::max(extent[1], extent[2]));
+        scale = (scale > 0) ? TMeshFloat{ 1023 } / scale : TMeshFloat{ 0 };
+
+        // Compute the Morton code of each centroid (invalid triangles are sorted last):
+        std::vector<std::pair<uint64_t, uint32_t>> keys(N);
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, N),
+            [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t i = range.begin(); i != range.end(); ++i) {
+                    uint64_t code = std::numeric_limits<uint64_t>::max();
+                    if (isValid(i)) {
+                        vec3<TMeshFloat> q = (triangles[i].centroid - bmin) * scale;
+                        uint32_t x = static_cast<uint32_t>(std::clamp(q[0], TMeshFloat{ 0 }, TMeshFloat{ 1023 }));
+                        uint32_t y = static_cast<uint32_t>(std::clamp(q[1], TMeshFloat{ 0 }, TMeshFloat{ 1023 }));
+                        uint32_t z = static_cast<uint32_t>(std::clamp(q[2], TMeshFloat{ 0 }, TMeshFloat{ 1023 }));
+                        code = (detail::expandMortonBits(x) << 2) | (detail::expandMortonBits(y) << 1) | detail::expandMortonBits(z);
+                    }
+                    keys[i] = { code, static_cast<uint32_t>(i) };
+                }
+            });
+        tbb::parallel_sort(keys.begin(), keys.end());
+
+        std::vector<uint32_t> order(N);
+        for (size_t i = 0; i < N; ++i) {
+            order[i] = keys[i].second;
+        }
+        return order;
+    };
+
+    /**
+     * @brief Partitions an ordering of a triangle buffer into contiguous clusters and computes their bounds
+     * @param triangles The triangles to be partitioned
+     * @param order The order in which triangles are grouped (see spatialTriangleOrder())
+     * @param cluster_size The maximum number of triangles per cluster
+     * @return The clusters, whose ranges index into order
+     * @details Triangles with non-finite vertices (as used for DEM no-data regions) are ignored
+     *          when computing bounds.  Clusters with no usable face normals receive a cone
+     *          half-angle of PI, which disables backface rejection for them.
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    std::vector<TriangleCluster<TMeshFloat>> buildTriangleClusters(const std::vector<Triangle<TSpectral, TMeshFloat>>& triangles, const std::vector<uint32_t>& order, size_t cluster_size)
+    {
+        std::vector<TriangleCluster<TMeshFloat>> clusters;
+        if (cluster_size == 0) {
+            return clusters;
+        }
+        clusters.reserve((order.size() + cluster_size - 1) / cluster_size);
+
+        for (size_t first = 0; first < order.size(); first += cluster_size) {
+            TriangleCluster<TMeshFloat> cluster;
+            cluster.first_triangle = first;
+            cluster.triangle_count = std::min(cluster_size, order.size() - first);
+
+            // Compute the bounding box and summed normal of all valid triangles:
+            vec3<TMeshFloat> bmin{ std::numeric_limits<TMeshFloat>::infinity() };
+            vec3<TMeshFloat> bmax{ -std::numeric_limits<TMeshFloat>::infinity() };
+            vec3<float> normal_sum{ 0 };
+            size_t num_valid = 0;
+            for (size_t i = first; i < first + cluster.triangle_count; ++i) {
+                const Triangle<TSpectral, TMeshFloat>& tri = triangles[order[i]];
+                if (std::isinf(tri.vert[0].position[0]) || std::isinf(tri.vert[1].position[0]) || std::isinf(tri.vert[2].position[0])) {
+                    continue;
+                }
+
+                for (const auto& vert : tri.vert) {
+                    bmin = glm::min(bmin, vert.position);
+                    bmax = glm::max(bmax, vert.position);
+                }
+
+                vec3<float> face_normal{ tri.face_normal };
+                if (!std::isnan(face_normal[0])) {
+                    normal_sum += face_normal;
+                    num_valid++;
+                }
+            }
+
+            if (num_valid == 0) {
+                cluster.radius = std::numeric_limits<TMeshFloat>::infinity();
+                clusters.push_back(cluster);
+                continue;
+            }
+
+            // Compute the bounding sphere:
+            cluster.center = (bmin + bmax) / TMeshFloat{ 2 };
+            for (size_t i = first; i < first + cluster.triangle_count; ++i) {
+                const Triangle<TSpectral, TMeshFloat>& tri = triangles[order[i]];
+                if (std::isinf(tri.vert[0].position[0]) || std::isinf(tri.vert[1].position[0]) || std::isinf(tri.vert[2].position[0])) {
+                    continue;
+                }
+                for (const auto& vert : tri.vert) {
+                    cluster.radius = std::max(cluster.radius, static_cast<TMeshFloat>(glm::length(vert.position - cluster.center)));
+                }
+            }
+
+            // Compute the normal cone:
+            if (glm::length(normal_sum) > 0) {
+                cluster.cone_axis = glm::normalize(normal_sum);
+
+                float min_dot = 1.f;
+                for (size_t i = first; i < first + cluster.triangle_count; ++i) {
+                    const Triangle<TSpectral, TMeshFloat>& tri = triangles[order[i]];
+                    vec3<float> face_normal{ tri.face_normal };
+                    if (!std::isnan(face_normal[0]) && !std::isinf(tri.vert[0].position[0])) {
+                        min_dot = std::min(min_dot, glm::dot(cluster.cone_axis, face_normal));
+                    }
+                }
+                cluster.cone_angle = std::acos(std::clamp(min_dot, -1.f, 1.f));
+            }
+
+            clusters.push_back(cluster);
+        }
+
+        return clusters;
+    };
+
+    /**
+     * @brief Tests if every surface bounded by a normal cone and bounding sphere faces away from a viewer
+     * @param cone_axis Axis of the normal cone
+     * @param cone_angle Half-angle of the normal cone (radians)
+     * @param center Center of the bounding sphere
+     * @param radius Radius of the bounding sphere
+     * @param view_position Position of the viewer (in the same frame as center)
+     * @return true if no surface within the bounds can be front-facing to the viewer
+     * @details Conservative: a surface is rejected only if the angle between the cone axis and the view
+     *          vector, widened by the cone half-angle, is smaller than the angle subtended by the sphere.
+     */
+    template <IsFloat T>
+    bool normalConeBackfacing(const vec3<float>& cone_axis, float cone_angle, const vec3<T>& center, T radius, const vec3<T>& view_position)
+    {
+        if (cone_angle >= PI_OVER_2<float>() || !std::isfinite(radius)) {
+            return false;
+        }
+
+        vec3<T> view_vector = center - view_position;
+        T distance = glm::length(view_vector);
+        if (!(distance > radius)) {
+            return false;
+        }
+
+        vec3<float> view_direction{ view_vector / distance };
+        float theta = std::acos(std::clamp(glm::dot(cone_axis, view_direction), -1.f, 1.f));
+        float limit = std::acos(static_cast<float>(radius / distance));
+
+        return (theta + cone_angle) < limit;
+    };
+};
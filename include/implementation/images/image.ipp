@@ -18,6 +18,7 @@
 #include "vira/images/image_pixel.hpp"
 #include "vira/images/interfaces/image_interface.hpp"
 #include "vira/utils/valid_value.hpp"
+#include "vira/utils/profiler.hpp"
 
 namespace vira::images {
     // ======================== //
@@ -991,6 +992,8 @@ namespace vira::images {
 
     template <IsPixel T>
     void Image<T>::convolve(Image<T>& kernel, bool applyToAlpha) {
+        VIRA_PROFILE_ZONE("Image::convolve");
+
         constexpr size_t numChannels = []() {
             if constexpr (IsVec<T>) {
                 return static_cast<size_t>(T::length());
@@ -6,6 +6,26 @@
 #include <chrono>
 #include <iomanip>
 #include <thread>
+#include <vector>
+#include <utility>
+#include <csignal>
+#include <exception>
+#include <functional>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <cstring>
+#include <cerrno>
+
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 #include "plog/Log.h"
 #include "plog/Initializers/RollingFileInitializer.h"
@@ -37,6 +57,17 @@ namespace vira {
         return *log_mutex;
     }
 
+    inline CrashLogger::AsyncState& CrashLogger::get_async_state() {
+        // Never destructed, so the writer thread may outlive static destruction without terminating the program
+        static AsyncState* async_state = new AsyncState();
+        return *async_state;
+    }
+
+    inline CrashLogger::RateLimit& CrashLogger::get_rate_limit() {
+        static RateLimit* rate_limit = new RateLimit();
+        return *rate_limit;
+    }
+
     /**
      * Initialize the crash logger with a log file path
      * @param log_file_path Path to the log file (will be created if doesn't exist)
@@ -54,21 +85,21 @@ namespace vira {
      * Log an informational event
      */
     inline void CrashLogger::event(const std::string& message) {
-        log_internal(Level::EVENT, message);
+        log_internal(Level::EVENT, message, message);
     }
 
     /**
      * Log a warning
      */
     inline void CrashLogger::warning(const std::string& message) {
-        log_internal(Level::WARNING, message);
+        log_internal(Level::WARNING, message, message);
     }
 
     /**
      * Log an error
      */
     inline void CrashLogger::error(const std::string& message) {
-        log_internal(Level::ERR, message);
+        log_internal(Level::ERR, message, message);
     }
 
     /**
@@ -76,7 +107,8 @@ namespace vira {
      */
     template<typename... Args>
     void CrashLogger::event(const std::string& format, Args&&... args) {
-        event(format_string(format, std::forward<Args>(args)...));
+        // Rate limiting groups messages by their format, so repeats with different values are counted together:
+        log_internal(Level::EVENT, format_string(format, std::forward<Args>(args)...), format);
     }
 
     /**
@@ -84,7 +116,8 @@ namespace vira {
      */
     template<typename... Args>
     void CrashLogger::warning(const std::string& format, Args&&... args) {
-        warning(format_string(format, std::forward<Args>(args)...));
+        // Rate limiting groups messages by their format, so repeats with different values are counted together:
+        log_internal(Level::WARNING, format_string(format, std::forward<Args>(args)...), format);
     }
 
     /**
@@ -92,7 +125,8 @@ namespace vira {
      */
     template<typename... Args>
     void CrashLogger::error(const std::string& format, Args&&... args) {
-        error(format_string(format, std::forward<Args>(args)...));
+        // Rate limiting groups messages by their format, so repeats with different values are counted together:
+        log_internal(Level::ERR, format_string(format, std::forward<Args>(args)...), format);
     }
 
     /**
@@ -105,6 +139,10 @@ namespace vira {
         if (get_initialized_flag()) {
             event("CrashLogger shutdown - graceful exit");
 
+            // Write everything still queued before the file is removed:
+            stop_writer();
+            close_crash_fd();
+
             // Give a moment for the final log to be written
             std::this_thread::sleep_for(std::chrono::milliseconds(10));
 
@@ -181,31 +219,63 @@ namespace vira {
         }
     }
 
-    inline void CrashLogger::log_internal(Level level, const std::string& message) {
+    inline void CrashLogger::log_internal(Level level, const std::string& message, const std::string& key) {
         ensure_initialized(); // Auto-initialize if needed
 
         if (!get_initialized_flag()) {
             return; // Failed to initialize
         }
 
-        std::string formatted = format_message(level, message);
-        write_log(formatted);
-    }
+        // Errors are never rate limited:
+        uint32_t suppressed = 0;
+        if (level != Level::ERR && !should_log(key, suppressed)) {
+            return;
+        }
+
+        // Lines are formatted by the caller, so queued lines can be written without allocating:
+        std::string line = format_message(level, std::chrono::system_clock::now(), message);
+        if (suppressed > 0) {
+            line += " [" + std::to_string(suppressed) + " repeats suppressed]";
+        }
 
-    inline void CrashLogger::write_log(const std::string& message) {
-        if (!get_initialized_flag()) return;
+        // Events and warnings are handed to the writer thread when asynchronous logging is enabled:
+        AsyncState& async = get_async_state();
+        if (level != Level::ERR && async.enabled.load(std::memory_order_acquire)) {
+            if (!async.queue->push(line)) {
+                async.dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+            return;
+        }
 
+        // Errors are always written synchronously (after anything queued before them), so they reach the
+        // file even if the program crashes immediately afterwards:
         std::lock_guard<std::mutex> lock(get_log_mutex());
 
+        std::vector<std::string> lines;
+        collect_queued(lines);
+        lines.push_back(std::move(line));
+        write_entries(lines);
+    }
+
+    /**
+     * Write formatted lines to the log (the caller must hold the log mutex)
+     */
+    inline void CrashLogger::write_entries(const std::vector<std::string>& messages) {
+        if (!get_initialized_flag() || messages.empty()) return;
+
         // Write through plog
-        PLOG_INFO << message;
+        for (const std::string& message : messages) {
+            PLOG_INFO << message;
+        }
 
         // For immediate writes to survive crashes, we'll also write directly to file
         // This ensures the log persists even if plog's internal buffers aren't flushed
         try {
             std::ofstream file(get_log_file_path(), std::ios::app);
             if (file.is_open()) {
-                file << message << std::endl;
+                for (const std::string& message : messages) {
+                    file << message << '\n';
+                }
                 file.flush(); // Force immediate disk write
             }
         }
@@ -214,9 +284,8 @@ namespace vira {
         }
     }
 
-    inline std::string CrashLogger::format_message(Level level, const std::string& message) {
-        // Get current timestamp
-        auto now = std::chrono::system_clock::now();
+    inline std::string CrashLogger::format_message(Level level, std::chrono::system_clock::time_point now, const std::string& message) {
+        // Format the timestamp of when the message was logged (not when it was written)
         auto time_t = std::chrono::system_clock::to_time_t(now);
         auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
             now.time_since_epoch()) % 1000;
@@ -233,9 +302,9 @@ namespace vira {
             oss << "UNKNOWN_TIME";
         }
 #else
-        struct tm* tm_ptr = std::localtime(&time_t);
-        if (tm_ptr) {
-            oss << std::put_time(tm_ptr, "%Y-%m-%d %H:%M:%S");
+        struct tm tm_buf;
+        if (localtime_r(&time_t, &tm_buf) != nullptr) {
+            oss << std::put_time(&tm_buf, "%Y-%m-%d %H:%M:%S");
         }
         else {
             oss << "UNKNOWN_TIME";
@@ -257,6 +326,347 @@ namespace vira {
         return oss.str();
     }
 
+    /**
+     * Enable asynchronous logging of events and warnings
+     * @param queue_capacity Maximum number of entries waiting to be written (rounded up to a power of two)
+     *
+     * Logging calls then only format the message and push it onto a lock-free queue, and a background
+     * thread writes the queue to the log file.  If the queue is full, the entry is dropped (see dropped_count()).
+     * Queued lines longer than MAX_ENTRY_LENGTH are truncated.  Errors are still written synchronously.  The
+     * capacity is fixed by the first call.
+     *
+     * The log file is also opened for the crash handlers, which drain the queue with write() if the program
+     * crashes or terminates.
+     */
+    inline void CrashLogger::enable_async(size_t queue_capacity) {
+        ensure_initialized();
+
+        AsyncState& async = get_async_state();
+        std::lock_guard<std::mutex> control(async.control);
+        if (async.enabled.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        // The queue is never destroyed, so late producers can never push into freed memory:
+        if (!async.queue) {
+            async.queue = std::make_unique<EntryQueue>(queue_capacity);
+        }
+
+        // Open the log file now, as a crash handler may not allocate or open files:
+        if (async.crash_fd.load(std::memory_order_acquire) < 0) {
+#ifdef _WIN32
+            int fd = -1;
+            _sopen_s(&fd, get_log_file_path().c_str(), _O_WRONLY | _O_APPEND | _O_CREAT | _O_BINARY, _SH_DENYNO, _S_IREAD | _S_IWRITE);
+#else
+            int fd = ::open(get_log_file_path().c_str(), O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0644);
+#endif
+            async.crash_fd.store(fd, std::memory_order_release);
+        }
+
+        install_crash_handlers();
+
+        async.running.store(true, std::memory_order_release);
+        async.writer = std::thread(writer_loop);
+        async.enabled.store(true, std::memory_order_release);
+    }
+
+    /**
+     * Disable asynchronous logging, writing any queued entries first
+     */
+    inline void CrashLogger::disable_async() {
+        stop_writer();
+    }
+
+    /**
+     * Check if asynchronous logging is enabled
+     */
+    inline bool CrashLogger::is_async() {
+        return get_async_state().enabled.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Write all queued entries to the log file before returning
+     */
+    inline void CrashLogger::flush() {
+        std::lock_guard<std::mutex> lock(get_log_mutex());
+
+        std::vector<std::string> lines;
+        collect_queued(lines);
+        write_entries(lines);
+    }
+
+    /**
+     * Number of entries dropped because the asynchronous queue was full
+     */
+    inline size_t CrashLogger::dropped_count() {
+        return get_async_state().dropped.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Limit how often the same event or warning is written
+     * @param max_per_window Maximum number of times a message is written per window (0 disables the limit)
+     * @param window Duration of each window
+     *
+     * Messages are grouped by their format string.  The number of suppressed repeats is appended to the
+     * next message of the group that is written.  Errors are never rate limited.
+     */
+    inline void CrashLogger::set_rate_limit(size_t max_per_window, std::chrono::milliseconds window) {
+        RateLimit& rate_limit = get_rate_limit();
+        rate_limit.window_ms.store(std::max<int64_t>(1, static_cast<int64_t>(window.count())), std::memory_order_relaxed);
+        rate_limit.max_per_window.store(max_per_window, std::memory_order_relaxed);
+    }
+
+    inline bool CrashLogger::should_log(const std::string& key, uint32_t& suppressed) {
+        RateLimit& rate_limit = get_rate_limit();
+        size_t max_per_window = rate_limit.max_per_window.load(std::memory_order_relaxed);
+        if (max_per_window == 0) {
+            return true;
+        }
+
+        int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        int64_t window = now_ms / rate_limit.window_ms.load(std::memory_order_relaxed);
+
+        size_t hash = std::hash<std::string>{}(key);
+        RateSlot& slot = rate_limit.slots[hash % 256];
+
+        // Start a new window (or hand the slot to a different message).  Messages sharing a slot may
+        // occasionally reset each other's count, which only lets a few extra repeats through:
+        size_t previous_key = slot.key.load(std::memory_order_relaxed);
+        int64_t previous_window = slot.window.load(std::memory_order_relaxed);
+        if (previous_key != hash || previous_window != window) {
+            if (slot.window.compare_exchange_strong(previous_window, window, std::memory_order_relaxed)) {
+                previous_key = slot.key.exchange(hash, std::memory_order_relaxed);
+                slot.count.store(0, std::memory_order_relaxed);
+
+                uint32_t previous_suppressed = slot.suppressed.exchange(0, std::memory_order_relaxed);
+                if (previous_key == hash) {
+                    suppressed = previous_suppressed;
+                }
+            }
+        }
+
+        if (slot.count.fetch_add(1, std::memory_order_relaxed) < max_per_window) {
+            return true;
+        }
+
+        slot.suppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    /**
+     * Move all queued lines into a vector (the caller must hold the log mutex, so lines are written in order)
+     */
+    inline void CrashLogger::collect_queued(std::vector<std::string>& lines) {
+        AsyncState& async = get_async_state();
+        if (!async.queue) {
+            return;
+        }
+
+        char buffer[MAX_ENTRY_LENGTH];
+        size_t length = 0;
+        while (async.queue->pop(buffer, length)) {
+            lines.emplace_back(buffer, length);
+        }
+    }
+
+    inline void CrashLogger::writer_loop() {
+        AsyncState& async = get_async_state();
+        std::vector<std::string> entries;
+
+        while (async.running.load(std::memory_order_acquire)) {
+            {
+                std::lock_guard<std::mutex> lock(get_log_mutex());
+                collect_queued(entries);
+                write_entries(entries);
+            }
+
+            if (entries.empty()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            entries.clear();
+        }
+    }
+
+    inline void CrashLogger::stop_writer() {
+        AsyncState& async = get_async_state();
+        {
+            std::lock_guard<std::mutex> control(async.control);
+            async.enabled.store(false, std::memory_order_release);
+            if (async.running.exchange(false, std::memory_order_acq_rel) && async.writer.joinable()) {
+                async.writer.join();
+            }
+        }
+
+        // Anything pushed before logging became synchronous again:
+        flush();
+    }
+
+    /**
+     * Write queued lines from a crash handler
+     *
+     * Only async-signal-safe operations are used: lines are copied out of the preallocated queue onto the
+     * stack and written with write() to the descriptor opened by enable_async().  The log mutex is not
+     * taken, as the crashing thread (or the writer thread) may hold it.  A line the writer thread has
+     * already popped, but not yet written, may be lost.
+     */
+    inline void CrashLogger::flush_for_crash() {
+        AsyncState& async = get_async_state();
+        int fd = async.crash_fd.load(std::memory_order_acquire);
+        if (fd < 0 || !async.queue) {
+            return;
+        }
+
+        char buffer[MAX_ENTRY_LENGTH + 1];
+        size_t length = 0;
+        while (async.queue->pop(buffer, length)) {
+            buffer[length] = '\n';
+            write_raw(fd, buffer, length + 1);
+        }
+    }
+
+    /**
+     * Write a buffer to a file descriptor, retrying partial writes (async-signal-safe)
+     */
+    inline void CrashLogger::write_raw(int fd, const char* data, size_t size) {
+        while (size > 0) {
+#ifdef _WIN32
+            int written = _write(fd, data, static_cast<unsigned int>(size));
+#else
+            ssize_t written = ::write(fd, data, size);
+            if (written < 0 && errno == EINTR) {
+                continue;
+            }
+#endif
+            if (written <= 0) {
+                return;
+            }
+            data += written;
+            size -= static_cast<size_t>(written);
+        }
+    }
+
+    /**
+     * Close the crash handlers' log file descriptor (before the log file is removed)
+     */
+    inline void CrashLogger::close_crash_fd() {
+        int fd = get_async_state().crash_fd.exchange(-1, std::memory_order_acq_rel);
+        if (fd >= 0) {
+#ifdef _WIN32
+            _close(fd);
+#else
+            ::close(fd);
+#endif
+        }
+    }
+
+    inline void CrashLogger::install_crash_handlers() {
+        static std::once_flag installed;
+        std::call_once(installed, []() {
+            AsyncState& async = get_async_state();
+            async.previous_terminate = std::set_terminate(crash_terminate_handler);
+
+            const int signals[4] = { SIGSEGV, SIGABRT, SIGFPE, SIGILL };
+            for (size_t i = 0; i < 4; ++i) {
+                auto previous = std::signal(signals[i], crash_signal_handler);
+                async.previous_signals[i] = (previous == SIG_ERR) ? nullptr : previous;
+            }
+            });
+    }
+
+    inline void CrashLogger::crash_signal_handler(int signal) {
+        flush_for_crash();
+
+        // Hand the signal to whoever handled it before the logger:
+        AsyncState& async = get_async_state();
+        const int signals[4] = { SIGSEGV, SIGABRT, SIGFPE, SIGILL };
+        void (*previous)(int) = SIG_DFL;
+        for (size_t i = 0; i < 4; ++i) {
+            if (signals[i] == signal && async.previous_signals[i] != nullptr) {
+                previous = async.previous_signals[i];
+            }
+        }
+
+        std::signal(signal, previous);
+        std::raise(signal);
+    }
+
+    inline void CrashLogger::crash_terminate_handler() {
+        flush_for_crash();
+
+        std::terminate_handler previous = get_async_state().previous_terminate;
+        if (previous != nullptr) {
+            previous();
+        }
+        std::abort();
+    }
+
+    // ================== //
+    // === EntryQueue === //
+    // ================== //
+    inline CrashLogger::EntryQueue::EntryQueue(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) {
+            size *= 2;
+        }
+
+        cells_ = std::vector<Cell>(size);
+        for (size_t i = 0; i < size; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        mask_ = size - 1;
+    }
+
+    inline bool CrashLogger::EntryQueue::push(const std::string& line) {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells_[pos & mask_];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+            if (difference == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.length = std::min(line.size(), MAX_ENTRY_LENGTH);
+                    std::memcpy(cell.text, line.data(), cell.length);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0) {
+                return false; // Full
+            }
+            else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Copy the oldest line into buffer (which must hold MAX_ENTRY_LENGTH characters), without allocating
+     */
+    inline bool CrashLogger::EntryQueue::pop(char* buffer, size_t& length) {
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells_[pos & mask_];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+
+            if (difference == 0) {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    length = cell.length;
+                    std::memcpy(buffer, cell.text, length);
+                    cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0) {
+                return false; // Empty
+            }
+            else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
     inline void CrashLogger::cleanup_on_exit() {
         if (!get_graceful_shutdown_flag()) {
             shutdown();
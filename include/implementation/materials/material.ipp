@@ -223,4 +223,14 @@ namespace vira::materials {
         return this->emissionMap.sampleUVs(uv);
     };
 
+    /**
+     * @brief Returns the number of bytes held by the material's maps
+     */
+    template <IsSpectral TSpectral>
+    size_t Material<TSpectral>::getMemoryUsage() const
+    {
+        return albedoMap.getMemoryUsage() + normalMap.getMemoryUsage() + roughnessMap.getMemoryUsage()
+            + metalnessMap.getMemoryUsage() + transmissionMap.getMemoryUsage() + emissionMap.getMemoryUsage();
+    };
+
 };
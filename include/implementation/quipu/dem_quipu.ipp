@@ -16,6 +16,7 @@
 #include "vira/rendering/acceleration/aabb.hpp"
 #include "vira/quipu/class_ids.hpp"
 #include "vira/quipu/quipu_io.hpp"
+#include "vira/utils/profiler.hpp"
 
 namespace fs = std::filesystem;
 
@@ -69,6 +70,8 @@ namespace vira::quipu {
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     std::vector<vira::dems::DEM<TSpectral, TFloat, TMeshFloat>> DEMQuipu<TSpectral, TFloat, TMeshFloat>::readPyramid()
     {
+        VIRA_PROFILE_ZONE("DEMQuipu::readPyramid");
+
         std::vector<vira::dems::DEM<TSpectral, TFloat, TMeshFloat>> pyramid;
         std::ifstream file;
         open(filepath.string(), file);
@@ -137,6 +140,8 @@ namespace vira::quipu {
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     void DEMQuipu<TSpectral, TFloat, TMeshFloat>::readBuffers(vira::geometry::VertexBuffer<TSpectral, TMeshFloat>& vertexBuffer, vira::geometry::IndexBuffer& indexBuffer, double requiredGSD)
     {
+        VIRA_PROFILE_ZONE("DEMQuipu::readBuffers");
+
         // Skip the identifier (constructor verified valid file):
         std::ifstream file(filepath.string(), std::ifstream::binary);
 
@@ -0,0 +1,600 @@
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <fstream>
+#include <filesystem>
+#include <sstream>
+#include <iomanip>
+#include <random>
+#include <stdexcept>
+#include <system_error>
+#include <vector>
+#include <algorithm>
+
+#include "lz4.h"
+
+#include "vira/spectral_data.hpp"
+#include "vira/constraints.hpp"
+#include "vira/geometry/vertex.hpp"
+#include "vira/geometry/quantization.hpp"
+#include "vira/utils/utils.hpp"
+#include "vira/utils/hash_utils.hpp"
+#include "vira/quipu/class_ids.hpp"
+#include "vira/quipu/quipu_io.hpp"
+#include "vira/utils/profiler.hpp"
+
+namespace fs = std::filesystem;
+
+namespace vira::quipu {
+    /**
+     * @brief Opens a MeshQuipu and reads its header
+     * @param newFilepath Path to the .qms file
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    MeshQuipu<TSpectral, TMeshFloat>::MeshQuipu(const fs::path& newFilepath) :
+        filepath{ newFilepath }
+    {
+        std::ifstream file;
+        open(filepath, file);
+
+        // Read the file header:
+        readClassID(file, classID);
+        if (classID != VIRA_MESH) {
+            throw std::runtime_error(filepath.string() + " is a valid Quipu, but does not contain mesh data");
+        }
+
+        readValue(file, version);
+        readValue(file, sourceKey);
+        if (version >= 4) {
+            readValue(file, fileSize);
+        }
+        readClassID(file, precisionID);
+        readValue(file, spectralSize);
+        readValue(file, vertexSize);
+        readValue(file, numberOfMaterials);
+        readValue(file, numberOfMeshes);
+        readValue(file, numberOfNodes);
+        readValue(file, rootNode);
+
+        // Read the dependencies and the table of contents:
+        if (version == MESH_QUIPU_VERSION) {
+            uint32_t numberOfDependencies = 0;
+            readValue(file, numberOfDependencies);
+            dependencies = std::vector<MeshQuipuDependency>(numberOfDependencies);
+            for (auto& dependency : dependencies) {
+                readString(file, dependency.path);
+                readValue(file, dependency.fileSize);
+                readValue(file, dependency.writeTime);
+            }
+
+            gsds = std::vector<float>(numberOfMeshes);
+            offsets = std::vector<uint64_t>(numberOfMeshes);
+            for (size_t i = 0; i < numberOfMeshes; ++i) {
+                readValue(file, gsds[i]);
+                readValue(file, offsets[i]);
+            }
+        }
+
+        this->headerSize = static_cast<size_t>(file.tellg());
+
+        file.close();
+    };
+
+    /**
+     * @brief Checks that the stored buffers match the memory layout of this instantiation
+     * @return true if the format version, mesh precision, spectral size, and vertex size all match
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    bool MeshQuipu<TSpectral, TMeshFloat>::isCompatible() const
+    {
+        return version == MESH_QUIPU_VERSION &&
+            precisionID == getClassID<TMeshFloat>() &&
+            spectralSize == static_cast<uint32_t>(TSpectral::size()) &&
+            vertexSize == static_cast<uint32_t>(sizeof(vira::geometry::Vertex<TSpectral, TMeshFloat>));
+    };
+
+    /**
+     * @brief Reads the materials, meshes, and node hierarchy stored in the MeshQuipu
+     * @return The stored data, in the order it was written
+     *
+     * @throws std::runtime_error if the stored buffers are not compatible with this instantiation
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    MeshQuipuData<TSpectral, TMeshFloat> MeshQuipu<TSpectral, TMeshFloat>::read() const
+    {
+        VIRA_PROFILE_ZONE("MeshQuipu::read");
+
+        if (!isCompatible()) {
+            throw std::runtime_error(filepath.string() + " was written with an incompatible version, mesh precision, or spectral type");
+        }
+
+        std::ifstream file(filepath, std::ifstream::binary);
+        file.seekg(static_cast<std::streamoff>(headerSize), std::ios::beg);
+
+        MeshQuipuData<TSpectral, TMeshFloat> data;
+        data.rootNode = rootNode;
+        data.dependencies = dependencies;
+
+        // Read the material references:
+        data.materials.resize(numberOfMaterials);
+        for (auto& material : data.materials) {
+            readMaterialReference(file, material);
+        }
+
+        // Read the mesh buffers:
+        data.meshes.resize(numberOfMeshes);
+        for (auto& mesh : data.meshes) {
+            readEntry(file, mesh);
+        }
+
+        // Read the node hierarchy:
+        data.nodes.resize(numberOfNodes);
+        for (auto& node : data.nodes) {
+            readString(file, node.name);
+            readMat(file, node.localTransform);
+            readVector(file, node.meshIndices);
+            readVector(file, node.children);
+            readValue(file, node.parent);
+        }
+
+        if (!file) {
+            throw std::runtime_error(filepath.string() + " is truncated or corrupt");
+        }
+
+        file.close();
+        return data;
+    };
+
+
+    /**
+     * @brief Reads a single mesh (or a single level of a LoD pyramid) from the MeshQuipu
+     * @param index Index of the mesh to read
+     * @return The requested mesh
+     *
+     * @throws std::runtime_error if the stored buffers are not compatible with this instantiation
+     * @throws std::out_of_range if the index is invalid
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    MeshQuipuEntry<TSpectral, TMeshFloat> MeshQuipu<TSpectral, TMeshFloat>::readMesh(size_t index) const
+    {
+        VIRA_PROFILE_ZONE("MeshQuipu::readMesh");
+
+        if (!isCompatible()) {
+            throw std::runtime_error(filepath.string() + " was written with an incompatible version, mesh precision, or spectral type");
+        }
+        if (index >= offsets.size()) {
+            throw std::out_of_range("Mesh index " + std::to_string(index) + " is out of range for " + filepath.string());
+        }
+
+        std::ifstream file(filepath, std::ifstream::binary);
+        file.seekg(static_cast<std::streamoff>(offsets[index]), std::ios::beg);
+
+        MeshQuipuEntry<TSpectral, TMeshFloat> mesh;
+        readEntry(file, mesh);
+
+        if (!file) {
+            throw std::runtime_error(filepath.string() + " is truncated or corrupt");
+        }
+
+        file.close();
+        return mesh;
+    };
+
+
+    // ===================== //
+    // === Cache Helpers === //
+    // ===================== //
+    /**
+     * @brief Computes the key used to detect stale mesh caches
+     * @param sourceFile The original file the meshes were loaded from
+     * @param flags Any loader options which change the resulting buffers
+     * @param conversionKey Key identifying any conversion applied to the loaded values (e.g. RGB to spectral)
+     * @return FNV-1a hash of the source path, size, modification time, flags, conversion, and buffer layout
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    uint64_t MeshQuipu<TSpectral, TMeshFloat>::computeSourceKey(const fs::path& sourceFile, uint64_t flags, uint64_t conversionKey)
+    {
+        if (!fs::exists(sourceFile)) {
+            throw std::runtime_error("Cannot compute a cache key for missing file: " + sourceFile.string());
+        }
+
+        std::error_code ec;
+        fs::path canonicalPath = fs::weakly_canonical(sourceFile, ec);
+        if (ec) {
+            canonicalPath = sourceFile;
+        }
+
+        uint64_t fileSize = static_cast<uint64_t>(fs::file_size(sourceFile));
+        int64_t writeTime = static_cast<int64_t>(fs::last_write_time(sourceFile).time_since_epoch().count());
+
+        uint64_t key = vira::utils::FNV1A_OFFSET_BASIS;
+        vira::utils::fnv1aCombine(key, canonicalPath.string(), fileSize, writeTime, flags, conversionKey,
+            static_cast<uint16_t>(getClassID<TMeshFloat>()), static_cast<uint64_t>(TSpectral::size()));
+        return key;
+    };
+
+    /**
+     * @brief Constructs the path of the cache file for a given source file
+     * @param cacheDirectory Directory in which caches are stored
+     * @param sourceFile The original file the meshes were loaded from
+     * @param sourceKey The key computed by computeSourceKey()
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    fs::path MeshQuipu<TSpectral, TMeshFloat>::cachePath(const fs::path& cacheDirectory, const fs::path& sourceFile, uint64_t sourceKey)
+    {
+        std::stringstream ss;
+        ss << sourceFile.stem().string() << "_" << std::hex << std::setw(16) << std::setfill('0') << sourceKey << ".qms";
+        return cacheDirectory / ss.str();
+    };
+
+    /**
+     * @brief Checks if a cache file exists, is complete, and matches the given source key
+     * @param filepath Path to the .qms file
+     * @param sourceKey The key computed by computeSourceKey()
+     * @details A file whose size differs from the size recorded in its header (e.g. one truncated by an
+     *          interrupted write) is rejected, as is a file with a dependency that has changed since it
+     *          was written.
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    bool MeshQuipu<TSpectral, TMeshFloat>::isValidCache(const fs::path& filepath, uint64_t sourceKey)
+    {
+        if (!fs::exists(filepath) || fs::is_directory(filepath)) {
+            return false;
+        }
+
+        try {
+            MeshQuipu<TSpectral, TMeshFloat> quipu(filepath);
+            if (quipu.getSourceKey() != sourceKey || !quipu.isCompatible() ||
+                quipu.getFileSize() != static_cast<uint64_t>(fs::file_size(filepath))) {
+                return false;
+            }
+
+            return std::all_of(quipu.getDependencies().begin(), quipu.getDependencies().end(),
+                [](const MeshQuipuDependency& dependency) { return isCurrent(dependency); });
+        }
+        catch (const std::exception&) {
+            return false;
+        }
+    };
+
+    /**
+     * @brief Records the current size and modification time of a dependency
+     * @param dependency Path to a file the cached data is built from
+     * @return The stamp to store in MeshQuipuData::dependencies
+     *
+     * @throws std::runtime_error if the file does not exist
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    MeshQuipuDependency MeshQuipu<TSpectral, TMeshFloat>::stampDependency(const fs::path& dependency)
+    {
+        if (!fs::exists(dependency)) {
+            throw std::runtime_error("Cannot stamp missing dependency: " + dependency.string());
+        }
+
+        MeshQuipuDependency stamp;
+        stamp.path = fs::absolute(dependency).string();
+        stamp.fileSize = static_cast<uint64_t>(fs::file_size(dependency));
+        stamp.writeTime = static_cast<int64_t>(fs::last_write_time(dependency).time_since_epoch().count());
+        return stamp;
+    };
+
+    /**
+     * @brief Checks if a dependency still matches its stamp
+     * @param dependency The stamp recorded by stampDependency()
+     * @return false if the file has been removed, or its size or modification time has changed
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    bool MeshQuipu<TSpectral, TMeshFloat>::isCurrent(const MeshQuipuDependency& dependency)
+    {
+        std::error_code ec;
+        fs::path path{ dependency.path };
+        uint64_t fileSize = static_cast<uint64_t>(fs::file_size(path, ec));
+        if (ec) {
+            return false;
+        }
+        auto writeTime = fs::last_write_time(path, ec);
+        if (ec) {
+            return false;
+        }
+
+        return fileSize == dependency.fileSize && static_cast<int64_t>(writeTime.time_since_epoch().count()) == dependency.writeTime;
+    };
+
+
+    // ===================== //
+    // === Write Methods === //
+    // ===================== //
+    /**
+     * @brief Writes materials, meshes, and a node hierarchy to a MeshQuipu
+     * @param filepath Output path (the extension is replaced with .qms)
+     * @param data The data to store
+     * @param sourceKey The key computed by computeSourceKey()
+     * @param options Writer options
+     * @details The file is written to a temporary path next to filepath and renamed into place once complete,
+     *          so readers (and isValidCache()) never observe a partially written file.
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    void MeshQuipu<TSpectral, TMeshFloat>::write(fs::path filepath, const MeshQuipuData<TSpectral, TMeshFloat>& data, uint64_t sourceKey, MeshQuipuWriterOptions options)
+    {
+        VIRA_PROFILE_ZONE("MeshQuipu::write");
+
+        // Ensure file extension to be MeshQuipu (.qms):
+        filepath.replace_extension(".qms");
+        utils::makePath(filepath);
+
+        // Write to a uniquely named temporary file (concurrent writers of the same cache never share one):
+        std::stringstream suffix;
+        suffix << ".tmp" << std::hex << std::random_device{}();
+        fs::path tempPath = filepath;
+        tempPath += suffix.str();
+
+        std::ofstream file(tempPath, std::ofstream::binary);
+
+        // Write the header:
+        writeIdentifier(file);
+        writeClassID(file, VIRA_MESH);
+        writeValue(file, MESH_QUIPU_VERSION);
+        writeValue(file, sourceKey);
+        std::streampos fileSizePosition = file.tellp();
+        writeValue(file, uint64_t{ 0 });
+        writeClassID<TMeshFloat>(file);
+        writeValue(file, static_cast<uint32_t>(TSpectral::size()));
+        writeValue(file, static_cast<uint32_t>(sizeof(vira::geometry::Vertex<TSpectral, TMeshFloat>)));
+        writeValue(file, static_cast<uint32_t>(data.materials.size()));
+        writeValue(file, static_cast<uint32_t>(data.meshes.size()));
+        writeValue(file, static_cast<uint32_t>(data.nodes.size()));
+        writeValue(file, data.rootNode);
+
+        writeValue(file, static_cast<uint32_t>(data.dependencies.size()));
+        for (const auto& dependency : data.dependencies) {
+            writeString(file, dependency.path);
+            writeValue(file, dependency.fileSize);
+            writeValue(file, dependency.writeTime);
+        }
+
+        // Reserve space for the table of contents:
+        std::streampos tableOfContents = file.tellp();
+        for (size_t i = 0; i < data.meshes.size(); ++i) {
+            writeValue(file, data.meshes[i].gsd);
+            writeValue(file, uint64_t{ 0 });
+        }
+
+        // Write the material references:
+        for (const auto& material : data.materials) {
+            writeMaterialReference(file, material);
+        }
+
+        // Write the mesh buffers:
+        std::vector<uint64_t> offsets(data.meshes.size());
+        for (size_t i = 0; i < data.meshes.size(); ++i) {
+            offsets[i] = static_cast<uint64_t>(file.tellp());
+            writeEntry(file, data.meshes[i], options);
+        }
+
+        // Write the node hierarchy:
+        for (const auto& node : data.nodes) {
+            writeString(file, node.name);
+            writeMat(file, node.localTransform);
+            writeVector(file, node.meshIndices);
+            writeVector(file, node.children);
+            writeValue(file, node.parent);
+        }
+
+        // Fill in the file size and table of contents:
+        std::streampos end = file.tellp();
+        file.seekp(fileSizePosition);
+        writeValue(file, static_cast<uint64_t>(end));
+        file.seekp(tableOfContents);
+        for (size_t i = 0; i < data.meshes.size(); ++i) {
+            writeValue(file, data.meshes[i].gsd);
+            writeValue(file, offsets[i]);
+        }
+        file.seekp(end);
+
+        file.close();
+        std::error_code ec;
+        if (!file) {
+            fs::remove(tempPath, ec);
+            throw std::runtime_error("Failed to write MeshQuipu: " + filepath.string());
+        }
+
+        // Move the complete file into place (replacing any stale cache):
+        fs::rename(tempPath, filepath, ec);
+        if (ec) {
+            fs::remove(tempPath, ec);
+            throw std::runtime_error("Failed to move MeshQuipu into place: " + filepath.string());
+        }
+    };
+
+    // Flags describing how the buffers of a MeshQuipuEntry are encoded:
+    constexpr uint8_t MESH_QUIPU_INDEX16 = 1 << 0;
+    constexpr uint8_t MESH_QUIPU_QUANTIZED_POSITIONS = 1 << 1;
+
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    void MeshQuipu<TSpectral, TMeshFloat>::writeEntry(std::ofstream& file, const MeshQuipuEntry<TSpectral, TMeshFloat>& mesh, const MeshQuipuWriterOptions& options)
+    {
+        using namespace vira::geometry;
+        bool compress = options.compress;
+
+        writeString(file, mesh.name);
+        writeValue(file, mesh.smoothShading);
+        writeValue(file, mesh.gsd);
+        writeVector(file, mesh.materialReferences);
+
+        writeValue(file, static_cast<uint64_t>(mesh.vertexBuffer.size()));
+        writeValue(file, static_cast<uint64_t>(mesh.indexBuffer.size()));
+        writeValue(file, static_cast<uint64_t>(mesh.materialIndices.size()));
+
+        uint8_t flags = 0;
+        if (fitsIndexBuffer16(mesh.vertexBuffer.size())) {
+            flags |= MESH_QUIPU_INDEX16;
+        }
+        if (options.quantize_positions && !mesh.vertexBuffer.empty()) {
+            flags |= MESH_QUIPU_QUANTIZED_POSITIONS;
+        }
+        writeValue(file, flags);
+
+        // Write the vertex buffer:
+        if (flags & MESH_QUIPU_QUANTIZED_POSITIONS) {
+            PositionQuantization quantization = computePositionQuantization(mesh.vertexBuffer);
+            writeValue(file, quantization.origin);
+            writeValue(file, quantization.scale);
+
+            std::vector<uint16_t> positions = quantizePositions(mesh.vertexBuffer, quantization);
+            std::vector<TSpectral> albedos(mesh.vertexBuffer.size());
+            std::vector<Normal> normals(mesh.vertexBuffer.size());
+            std::vector<UV> uvs(mesh.vertexBuffer.size());
+            for (size_t i = 0; i < mesh.vertexBuffer.size(); ++i) {
+                albedos[i] = mesh.vertexBuffer[i].albedo;
+                normals[i] = mesh.vertexBuffer[i].normal;
+                uvs[i] = mesh.vertexBuffer[i].uv;
+            }
+
+            writeArray(file, reinterpret_cast<const char*>(positions.data()), positions.size() * sizeof(uint16_t), compress);
+            writeArray(file, reinterpret_cast<const char*>(albedos.data()), albedos.size() * sizeof(TSpectral), compress);
+            writeArray(file, reinterpret_cast<const char*>(normals.data()), normals.size() * sizeof(Normal), compress);
+            writeArray(file, reinterpret_cast<const char*>(uvs.data()), uvs.size() * sizeof(UV), compress);
+        }
+        else {
+            writeArray(file, reinterpret_cast<const char*>(mesh.vertexBuffer.data()), mesh.vertexBuffer.size() * sizeof(Vertex<TSpectral, TMeshFloat>), compress);
+        }
+
+        // Write the index buffer:
+        if (flags & MESH_QUIPU_INDEX16) {
+            IndexBuffer16 indexBuffer16 = narrowIndexBuffer(mesh.indexBuffer);
+            writeArray(file, reinterpret_cast<const char*>(indexBuffer16.data()), indexBuffer16.size() * sizeof(uint16_t), compress);
+        }
+        else {
+            writeArray(file, reinterpret_cast<const char*>(mesh.indexBuffer.data()), mesh.indexBuffer.size() * sizeof(uint32_t), compress);
+        }
+
+        writeArray(file, reinterpret_cast<const char*>(mesh.materialIndices.data()), mesh.materialIndices.size() * sizeof(vira::MaterialID::ValueType), compress);
+    };
+
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    void MeshQuipu<TSpectral, TMeshFloat>::readEntry(std::ifstream& file, MeshQuipuEntry<TSpectral, TMeshFloat>& mesh)
+    {
+        using namespace vira::geometry;
+
+        readString(file, mesh.name);
+        readValue(file, mesh.smoothShading);
+        readValue(file, mesh.gsd);
+        readVector(file, mesh.materialReferences);
+
+        uint64_t numberOfVertices;
+        uint64_t numberOfIndices;
+        uint64_t numberOfMaterialIndices;
+        readValue(file, numberOfVertices);
+        readValue(file, numberOfIndices);
+        readValue(file, numberOfMaterialIndices);
+
+        uint8_t flags;
+        readValue(file, flags);
+
+        mesh.vertexBuffer.resize(static_cast<size_t>(numberOfVertices));
+        mesh.indexBuffer.resize(static_cast<size_t>(numberOfIndices));
+        mesh.materialIndices.resize(static_cast<size_t>(numberOfMaterialIndices));
+
+        // Read (and decode) the vertex buffer:
+        if (flags & MESH_QUIPU_QUANTIZED_POSITIONS) {
+            PositionQuantization quantization;
+            readValue(file, quantization.origin);
+            readValue(file, quantization.scale);
+
+            std::vector<uint16_t> positions(3 * mesh.vertexBuffer.size());
+            std::vector<TSpectral> albedos(mesh.vertexBuffer.size());
+            std::vector<Normal> normals(mesh.vertexBuffer.size());
+            std::vector<UV> uvs(mesh.vertexBuffer.size());
+
+            readArray(file, reinterpret_cast<char*>(positions.data()), positions.size() * sizeof(uint16_t));
+            readArray(file, reinterpret_cast<char*>(albedos.data()), albedos.size() * sizeof(TSpectral));
+            readArray(file, reinterpret_cast<char*>(normals.data()), normals.size() * sizeof(Normal));
+            readArray(file, reinterpret_cast<char*>(uvs.data()), uvs.size() * sizeof(UV));
+
+            dequantizePositions(positions, quantization, mesh.vertexBuffer);
+            for (size_t i = 0; i < mesh.vertexBuffer.size(); ++i) {
+                mesh.vertexBuffer[i].albedo = albedos[i];
+                mesh.vertexBuffer[i].normal = normals[i];
+                mesh.vertexBuffer[i].uv = uvs[i];
+            }
+        }
+        else {
+            readArray(file, reinterpret_cast<char*>(mesh.vertexBuffer.data()), mesh.vertexBuffer.size() * sizeof(Vertex<TSpectral, TMeshFloat>));
+        }
+
+        // Read (and widen) the index buffer:
+        if (flags & MESH_QUIPU_INDEX16) {
+            IndexBuffer16 indexBuffer16(mesh.indexBuffer.size());
+            readArray(file, reinterpret_cast<char*>(indexBuffer16.data()), indexBuffer16.size() * sizeof(uint16_t));
+            mesh.indexBuffer = widenIndexBuffer(indexBuffer16);
+        }
+        else {
+            readArray(file, reinterpret_cast<char*>(mesh.indexBuffer.data()), mesh.indexBuffer.size() * sizeof(uint32_t));
+        }
+
+        readArray(file, reinterpret_cast<char*>(mesh.materialIndices.data()), mesh.materialIndices.size() * sizeof(vira::MaterialID::ValueType));
+    };
+
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    size_t MeshQuipu<TSpectral, TMeshFloat>::writeArray(std::ofstream& file, const char* buffer, size_t bufferSize, bool compress)
+    {
+        // LZ4 is limited to inputs smaller than LZ4_MAX_INPUT_SIZE, so larger buffers are stored raw:
+        uint8_t compressed = (compress && bufferSize > 0 && bufferSize <= static_cast<size_t>(LZ4_MAX_INPUT_SIZE)) ? 1 : 0;
+
+        size_t size = writeValue(file, compressed);
+        if (compressed) {
+            size += compressData(file, const_cast<char*>(buffer), bufferSize);
+        }
+        else {
+            size += writeBuffer(file, buffer, bufferSize);
+        }
+        return size;
+    };
+
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    void MeshQuipu<TSpectral, TMeshFloat>::readArray(std::ifstream& file, char* buffer, size_t bufferSize)
+    {
+        uint8_t compressed;
+        readValue(file, compressed);
+        if (compressed) {
+            decompressData(file, buffer, bufferSize);
+        }
+        else {
+            readBuffer(file, buffer, bufferSize);
+        }
+    };
+
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    size_t MeshQuipu<TSpectral, TMeshFloat>::writeMaterialReference(std::ofstream& file, const MaterialReference& material)
+    {
+        size_t size = 0;
+        size += writeString(file, material.name);
+        size += writeValue(file, material.metalness);
+        size += writeValue(file, material.roughness);
+        size += writeValue(file, material.hasDiffuseColor);
+        size += writeValue(file, material.diffuseColor);
+        size += writeValue(file, material.emissionColor);
+        size += writeString(file, material.diffuseTexture);
+        size += writeString(file, material.normalTexture);
+        size += writeString(file, material.roughnessTexture);
+        size += writeString(file, material.metalnessTexture);
+        size += writeString(file, material.emissionTexture);
+        return size;
+    };
+
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    void MeshQuipu<TSpectral, TMeshFloat>::readMaterialReference(std::ifstream& file, MaterialReference& material)
+    {
+        readString(file, material.name);
+        readValue(file, material.metalness);
+        readValue(file, material.roughness);
+        readValue(file, material.hasDiffuseColor);
+        readValue(file, material.diffuseColor);
+        readValue(file, material.emissionColor);
+        readString(file, material.diffuseTexture);
+        readString(file, material.normalTexture);
+        readString(file, material.roughnessTexture);
+        readString(file, material.metalnessTexture);
+        readString(file, material.emissionTexture);
+    };
+};
@@ -0,0 +1,778 @@
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <fstream>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <concepts>
+
+#include "vira/vec.hpp"
+#include "vira/math.hpp"
+#include "vira/spectral_data.hpp"
+#include "vira/constraints.hpp"
+#include "vira/reference_frame.hpp"
+#include "vira/images/image.hpp"
+#include "vira/geometry/vertex.hpp"
+#include "vira/geometry/analytic_ellipsoid.hpp"
+#include "vira/materials/material.hpp"
+#include "vira/materials/lambertian.hpp"
+#include "vira/materials/mcewen.hpp"
+#include "vira/materials/pbr_material.hpp"
+#include "vira/lights/light.hpp"
+#include "vira/lights/point_light.hpp"
+#include "vira/lights/sphere_light.hpp"
+#include "vira/cameras/camera.hpp"
+#include "vira/unresolved/unresolved_object.hpp"
+#include "vira/rendering/acceleration/vira_blas.hpp"
+#include "vira/utils/mapped_file.hpp"
+#include "vira/quipu/class_ids.hpp"
+#include "vira/quipu/quipu_io.hpp"
+#include "vira/quipu/dem_quipu.hpp"
+#include "vira/scene.hpp"
+
+namespace fs = std::filesystem;
+
+namespace vira::quipu {
+    /**
+     * @brief Writes a snapshot of a Scene
+     * @param filepath Path of the snapshot file to write
+     * @param scene The scene to write
+     * @param options Options controlling which precomputed data is stored
+     *
+     * @details Meshes are written first, so that instances can refer to them by index.  Groups are written in
+     *          breadth-first order (root first), so that every group's parent already exists when it is loaded.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void SceneSnapshot<TSpectral, TFloat, TMeshFloat>::write(const fs::path& filepath, Scene<TSpectral, TFloat, TMeshFloat>& scene, SceneSnapshotOptions options)
+    {
+        using GROUP = vira::scene::Group<TSpectral, TFloat, TMeshFloat>;
+
+        std::ofstream file(filepath, std::ios::out | std::ios::binary);
+        if (!file.is_open()) {
+            throw std::runtime_error("Could not open " + filepath.string() + " for writing");
+        }
+
+        // Write the header:
+        writeIdentifier(file);
+        writeClassID(file, VIRA_SCENE_SNAPSHOT);
+        writeValue(file, SCENE_SNAPSHOT_VERSION);
+        writeClassID<TFloat>(file);
+        writeClassID<TMeshFloat>(file);
+        writeValue(file, static_cast<uint32_t>(TSpectral::size()));
+        writeValue(file, static_cast<uint32_t>(sizeof(vira::geometry::Vertex<TSpectral, TMeshFloat>)));
+        writeValue(file, static_cast<uint32_t>(sizeof(size_t)));
+
+        // Write the global scene settings:
+        writeValue(file, scene.ambient_lighting_);
+        writeValue(file, scene.has_ambient_);
+        writeSnapshotImage(file, scene.background_emission_);
+        writeValue(file, scene.ephemeris_time_);
+
+        // Write the material table (the scene's default material is implicit):
+        std::unordered_map<MaterialID, uint32_t> materialTableIndex;
+        std::vector<std::pair<materials::Material<TSpectral>*, uint8_t>> materialTable;
+        std::vector<std::string> materialNames;
+        for (auto& [materialID, entry] : scene.materials_) {
+            if (materialID == scene.defaultMaterialID) {
+                continue;
+            }
+
+            materials::Material<TSpectral>* material = entry.data.get();
+            uint8_t type;
+            if (dynamic_cast<materials::PBRMaterial<TSpectral>*>(material) != nullptr) {
+                type = SNAPSHOT_PBR;
+            }
+            else if (dynamic_cast<materials::McEwen<TSpectral>*>(material) != nullptr) {
+                type = SNAPSHOT_MCEWEN;
+            }
+            else if (dynamic_cast<materials::Lambertian<TSpectral>*>(material) != nullptr) {
+                type = SNAPSHOT_LAMBERTIAN;
+            }
+            else {
+                std::cerr << "Warning: Material " << entry.name << " cannot be stored in a scene snapshot, the default material will be used instead\n";
+                continue;
+            }
+
+            materialTableIndex[materialID] = static_cast<uint32_t>(materialTable.size());
+            materialTable.emplace_back(material, type);
+            materialNames.push_back(entry.name);
+        }
+
+        writeValue(file, static_cast<uint64_t>(materialTable.size()));
+        for (size_t i = 0; i < materialTable.size(); ++i) {
+            writeString(file, materialNames[i]);
+            writeMaterial(file, *materialTable[i].first, materialTable[i].second);
+        }
+
+        auto materialIndex = [&](const MaterialID& materialID) -> uint32_t {
+            auto it = materialTableIndex.find(materialID);
+            return (it == materialTableIndex.end()) ? NO_INDEX : it->second;
+        };
+
+        // Write the meshes:
+        std::unordered_map<MeshID, uint32_t> meshTableIndex;
+        writeValue(file, static_cast<uint64_t>(scene.meshes_.size()));
+        for (auto& [meshID, meshData] : scene.meshes_) {
+            meshTableIndex[meshID] = static_cast<uint32_t>(meshTableIndex.size());
+
+            auto& mesh = *meshData.mesh;
+            writeString(file, meshData.name);
+
+            uint8_t type = SNAPSHOT_BUFFER_MESH;
+            if (mesh.hasQuipu()) {
+                type = SNAPSHOT_DEM_MESH;
+            }
+            else if (mesh.isAnalytic()) {
+                type = SNAPSHOT_ELLIPSOID_MESH;
+            }
+            writeValue(file, type);
+            writeValue(file, mesh.getSmoothShading());
+
+            const std::vector<MaterialID>& meshMaterials = mesh.getMaterialIDs();
+            std::vector<uint32_t> slots(meshMaterials.size());
+            for (size_t i = 0; i < meshMaterials.size(); ++i) {
+                slots[i] = materialIndex(meshMaterials[i]);
+            }
+            writeArray(file, slots.data(), slots.size());
+
+            if (type == SNAPSHOT_DEM_MESH) {
+                writeString(file, fs::absolute(mesh.getQuipuFilepath()).string());
+            }
+            else if (type == SNAPSHOT_ELLIPSOID_MESH) {
+                writeValue(file, mesh.getAnalyticEllipsoid().radii);
+            }
+            else {
+                const auto& vertexBuffer = mesh.getVertexBuffer();
+                const IndexBuffer indexBuffer = mesh.getIndices();
+                const auto& materialIndices = mesh.getMaterialIndices();
+                writeArray(file, vertexBuffer.data(), vertexBuffer.size());
+                writeArray(file, indexBuffer.data(), indexBuffer.size());
+                writeArray(file, materialIndices.data(), materialIndices.size());
+
+                // LoD pyramids are referenced rather than copied:
+                writeString(file, mesh.hasLoDs() ? fs::absolute(mesh.lodQuipu.getFilepath()).string() : std::string{});
+                writeValue(file, static_cast<uint64_t>(mesh.currentLoD));
+                writeValue(file, mesh.getCompactStorage());
+
+                // Only the Vira BVH can be serialized (an Embree BVH is opaque, and is rebuilt on load):
+                const vira::rendering::ViraBLAS<TSpectral>* blas = nullptr;
+                if constexpr (std::same_as<TFloat, double> && std::same_as<TMeshFloat, double>) {
+                    if (options.store_blas && !mesh.modified) {
+                        blas = dynamic_cast<const vira::rendering::ViraBLAS<TSpectral>*>(mesh.bvh.get());
+                    }
+                }
+
+                writeValue(file, blas != nullptr);
+                if (blas != nullptr) {
+                    writeArray(file, blas->getNodes(), blas->getNodeCount());
+                    writeArray(file, blas->getTriangleIndices(), blas->getTriangleCount());
+                }
+            }
+        }
+
+        // Collect the groups in breadth-first order:
+        std::vector<GROUP*> groups{ &scene };
+        std::vector<uint32_t> parents{ NO_INDEX };
+        std::vector<std::string> groupNames{ "" };
+        for (size_t i = 0; i < groups.size(); ++i) {
+            for (auto& [groupID, entry] : groups[i]->groups_) {
+                groups.push_back(entry.data.get());
+                parents.push_back(static_cast<uint32_t>(i));
+                groupNames.push_back(entry.name);
+            }
+        }
+
+        // Write the scene graph:
+        writeValue(file, static_cast<uint64_t>(groups.size()));
+        for (size_t i = 0; i < groups.size(); ++i) {
+            GROUP& group = *groups[i];
+
+            writeValue(file, parents[i]);
+            writeString(file, groupNames[i]);
+            writeFrame(file, group);
+
+            writeValue(file, static_cast<uint64_t>(group.cameras_.size()));
+            for (auto& [cameraID, entry] : group.cameras_) {
+                writeString(file, entry.name);
+                writeCamera(file, *entry.data, options);
+            }
+
+            writeValue(file, static_cast<uint64_t>(group.instances_.size()));
+            for (auto& [instanceID, entry] : group.instances_) {
+                writeString(file, entry.name);
+                writeValue(file, meshTableIndex.at(entry.data->getMeshID()));
+                writeFrame(file, *entry.data);
+            }
+
+            writeValue(file, static_cast<uint64_t>(group.lights_.size()));
+            for (auto& [lightID, entry] : group.lights_) {
+                writeString(file, entry.name);
+                writeLight(file, *entry.data);
+            }
+
+            writeValue(file, static_cast<uint64_t>(group.unresolved_objects_.size()));
+            for (auto& [unresolvedID, entry] : group.unresolved_objects_) {
+                writeString(file, entry.name);
+                writeValue(file, entry.data->getIrradiance());
+                writeFrame(file, *entry.data);
+            }
+        }
+
+        file.close();
+    };
+
+    /**
+     * @brief Loads a snapshot into a Scene
+     * @param filepath Path of the snapshot file
+     * @param scene The scene to load into
+     *
+     * @details The snapshot's materials, meshes, and scene graph are added to the scene with newly allocated IDs.
+     *          The root group of the snapshot is applied to the scene itself, and the global scene settings
+     *          (ambient lighting, background emission, and ephemeris time) are overwritten.
+     *
+     * @throws std::runtime_error if the file is not a SceneSnapshot, or was written with a different format
+     *         version, precision, or spectral type
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void SceneSnapshot<TSpectral, TFloat, TMeshFloat>::load(const fs::path& filepath, Scene<TSpectral, TFloat, TMeshFloat>& scene)
+    {
+        using MESH = vira::geometry::Mesh<TSpectral, TFloat, TMeshFloat>;
+        using GROUP = vira::scene::Group<TSpectral, TFloat, TMeshFloat>;
+        using UNRESOLVED = vira::unresolved::UnresolvedObject<TSpectral, TFloat, TMeshFloat>;
+
+        vira::utils::MappedFile mappedFile(filepath);
+        vira::utils::MappedFileReader reader(mappedFile);
+
+        // Validate the header:
+        std::string_view fileIdentifier(reader.view<char>(sizeOfIdentifier), sizeOfIdentifier);
+        if (fileIdentifier != identifier) {
+            throw std::runtime_error(filepath.string() + " exists, but is not a valid Quipu!");
+        }
+
+        ViraClassID classID;
+        reader.readValue(classID);
+        if (classID != VIRA_SCENE_SNAPSHOT) {
+            throw std::runtime_error(filepath.string() + " is a valid Quipu, but does not contain a scene snapshot");
+        }
+
+        uint16_t version;
+        ViraClassID floatID;
+        ViraClassID meshFloatID;
+        uint32_t spectralSize;
+        uint32_t vertexSize;
+        uint32_t sizeTSize;
+        reader.readValue(version);
+        reader.readValue(floatID);
+        reader.readValue(meshFloatID);
+        reader.readValue(spectralSize);
+        reader.readValue(vertexSize);
+        reader.readValue(sizeTSize);
+
+        if (version != SCENE_SNAPSHOT_VERSION) {
+            throw std::runtime_error(filepath.string() + " was written with an incompatible scene snapshot version");
+        }
+        if (floatID != getClassID<TFloat>() || meshFloatID != getClassID<TMeshFloat>() ||
+            spectralSize != static_cast<uint32_t>(TSpectral::size()) ||
+            vertexSize != static_cast<uint32_t>(sizeof(vira::geometry::Vertex<TSpectral, TMeshFloat>)) ||
+            sizeTSize != static_cast<uint32_t>(sizeof(size_t))) {
+            throw std::runtime_error(filepath.string() + " was written for a Scene with a different precision or spectral type");
+        }
+
+        // Read the global scene settings:
+        reader.readValue(scene.ambient_lighting_);
+        reader.readValue(scene.has_ambient_);
+        readSnapshotImage(reader, scene.background_emission_);
+        reader.readValue(scene.ephemeris_time_);
+
+        // Read the material table:
+        uint64_t materialCount;
+        reader.readValue(materialCount);
+        std::vector<MaterialID> materialIDs(materialCount);
+        for (uint64_t i = 0; i < materialCount; ++i) {
+            std::string name;
+            reader.readString(name);
+            materialIDs[i] = scene.addMaterial(readMaterial(reader), name);
+        }
+
+        auto lookupMaterial = [&](uint32_t index) -> MaterialID {
+            return (index == NO_INDEX) ? scene.defaultMaterialID : materialIDs.at(index);
+        };
+
+        // Read the meshes:
+        uint64_t meshCount;
+        reader.readValue(meshCount);
+        std::vector<MeshID> meshIDs(meshCount);
+        for (uint64_t i = 0; i < meshCount; ++i) {
+            std::string name;
+            uint8_t type;
+            bool smoothShading;
+            reader.readString(name);
+            reader.readValue(type);
+            reader.readValue(smoothShading);
+
+            size_t slotCount;
+            const uint32_t* slots = viewArray<uint32_t>(reader, slotCount);
+            uint32_t firstSlot = (slotCount > 0) ? slots[0] : NO_INDEX;
+
+            if (type == SNAPSHOT_DEM_MESH) {
+                std::string quipuPath;
+                reader.readString(quipuPath);
+                meshIDs[i] = scene.addQuipuMesh(DEMQuipu<TSpectral, TFloat, TMeshFloat>(quipuPath), lookupMaterial(firstSlot), smoothShading, name);
+            }
+            else if (type == SNAPSHOT_ELLIPSOID_MESH) {
+                vec3<TMeshFloat> radii;
+                reader.readValue(radii);
+                meshIDs[i] = scene.addEllipsoidMesh(vira::geometry::AnalyticEllipsoid<TSpectral, TMeshFloat>(radii), lookupMaterial(firstSlot), name);
+            }
+            else if (type == SNAPSHOT_BUFFER_MESH) {
+                size_t vertexCount;
+                size_t indexCount;
+                size_t materialIndexCount;
+                const auto* vertices = viewArray<vira::geometry::Vertex<TSpectral, TMeshFloat>>(reader, vertexCount);
+                const auto* indices = viewArray<uint32_t>(reader, indexCount);
+                const auto* materialIndices = viewArray<MaterialID::ValueType>(reader, materialIndexCount);
+
+                auto mesh = std::make_unique<MESH>(
+                    vira::geometry::VertexBuffer<TSpectral, TMeshFloat>(vertices, vertices + vertexCount),
+                    vira::geometry::IndexBuffer(indices, indices + indexCount),
+                    std::vector<MaterialID::ValueType>(materialIndices, materialIndices + materialIndexCount));
+                mesh->setSmoothShading(smoothShading);
+
+                MESH* meshPtr = mesh.get();
+                meshIDs[i] = scene.addMesh(std::move(mesh), name);
+                for (size_t slot = 0; slot < std::min(slotCount, meshPtr->getMaterialCount()); ++slot) {
+                    meshPtr->setMaterial(slot, lookupMaterial(slots[slot]));
+                }
+
+                std::string lodPath;
+                uint64_t currentLoD;
+                bool compactStorage;
+                reader.readString(lodPath);
+                reader.readValue(currentLoD);
+                reader.readValue(compactStorage);
+                if (!lodPath.empty()) {
+                    meshPtr->loadLoDs(lodPath);
+                    meshPtr->currentLoD = static_cast<size_t>(currentLoD);
+                }
+                meshPtr->setCompactStorage(compactStorage);
+
+                bool hasBLAS;
+                reader.readValue(hasBLAS);
+                if (hasBLAS) {
+                    size_t nodeCount;
+                    size_t triangleCount;
+                    const auto* nodes = viewArray<vira::rendering::ViraBLASNode<TSpectral>>(reader, nodeCount);
+                    const auto* triangleIndices = viewArray<size_t>(reader, triangleCount);
+
+                    if constexpr (std::same_as<TFloat, double> && std::same_as<TMeshFloat, double>) {
+                        meshPtr->bvh = std::make_unique<vira::rendering::ViraBLAS<TSpectral>>(meshPtr, nodes, nodeCount, triangleIndices);
+                        meshPtr->aabb = meshPtr->bvh->getAABB();
+                        meshPtr->modified = false;
+                    }
+                }
+            }
+            else {
+                throw std::runtime_error(filepath.string() + " contains an unknown mesh type");
+            }
+        }
+
+        // Read the scene graph:
+        uint64_t groupCount;
+        reader.readValue(groupCount);
+        std::vector<GROUP*> groups(groupCount, nullptr);
+        for (uint64_t i = 0; i < groupCount; ++i) {
+            uint32_t parent;
+            std::string groupName;
+            reader.readValue(parent);
+            reader.readString(groupName);
+
+            if (parent == NO_INDEX) {
+                if (i != 0) {
+                    throw std::runtime_error(filepath.string() + " contains more than one root group");
+                }
+                groups[i] = &scene;
+            }
+            else {
+                if (parent >= i) {
+                    throw std::runtime_error(filepath.string() + " contains a group which precedes its parent");
+                }
+                GROUP& parentGroup = *groups[parent];
+                GroupID groupID = parentGroup.newGroup(groupName);
+                groups[i] = &parentGroup[groupID];
+            }
+
+            GROUP& group = *groups[i];
+            readFrame(reader, group);
+
+            uint64_t cameraCount;
+            reader.readValue(cameraCount);
+            for (uint64_t j = 0; j < cameraCount; ++j) {
+                std::string name;
+                reader.readString(name);
+                CameraID cameraID = group.newCamera(name);
+                readCamera(reader, group[cameraID]);
+            }
+
+            uint64_t instanceCount;
+            reader.readValue(instanceCount);
+            for (uint64_t j = 0; j < instanceCount; ++j) {
+                std::string name;
+                uint32_t meshIndex;
+                reader.readString(name);
+                reader.readValue(meshIndex);
+                InstanceID instanceID = group.newInstance(meshIDs.at(meshIndex), name);
+                readFrame(reader, group[instanceID]);
+            }
+
+            uint64_t lightCount;
+            reader.readValue(lightCount);
+            for (uint64_t j = 0; j < lightCount; ++j) {
+                std::string name;
+                reader.readString(name);
+                LightID lightID = group.addLight(readLight(reader), name);
+                readFrame(reader, group[lightID]);
+            }
+
+            uint64_t unresolvedCount;
+            reader.readValue(unresolvedCount);
+            for (uint64_t j = 0; j < unresolvedCount; ++j) {
+                std::string name;
+                TSpectral irradiance;
+                reader.readString(name);
+                reader.readValue(irradiance);
+                UnresolvedID unresolvedID = group.addUnresolvedObject(std::make_unique<UNRESOLVED>(irradiance), name);
+                readFrame(reader, group[unresolvedID]);
+            }
+        }
+
+        scene.markDirty();
+    };
+
+
+
+    // ============================== //
+    // === Aligned bulk array I/O === //
+    // ============================== //
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void SceneSnapshot<TSpectral, TFloat, TMeshFloat>::pad(std::ofstream& file)
+    {
+        static constexpr char zeros[SCENE_SNAPSHOT_ALIGNMENT] = {};
+
+        size_t remainder = static_cast<size_t>(file.tellp()) % SCENE_SNAPSHOT_ALIGNMENT;
+        if (remainder != 0) {
+            writeBuffer(file, zeros, SCENE_SNAPSHOT_ALIGNMENT - remainder);
+        }
+    };
+
+    /**
+     * @brief Writes an element count followed by an aligned array
+     * @param file The file to write to
+     * @param values Pointer to the first element
+     * @param count Number of elements
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    template <typename T>
+    void SceneSnapshot<TSpectral, TFloat, TMeshFloat>::writeArray(std::ofstream& file, const T* values, size_t count)
+    {
+        writeValue(file, static_cast<uint64_t>(count));
+        pad(file);
+        if (count > 0) {
+            writeBuffer(file, reinterpret_cast<const char*>(values), count * sizeof(T));
+        }
+    };
+
+    /**
+     * @brief Views an array written by writeArray() in place
+     * @param reader Reader over the mapped snapshot
+     * @param[out] count Number of elements
+     * @return Pointer to the first element (valid while the snapshot remains mapped)
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    template <typename T>
+    const T* SceneSnapshot<TSpectral, TFloat, TMeshFloat>::viewArray(vira::utils::MappedFileReader& reader, size_t& count)
+    {
+        uint64_t storedCount;
+        reader.readValue(storedCount);
+        reader.align(SCENE_SNAPSHOT_ALIGNMENT);
+
+        count = static_cast<size_t>(storedCount);
+        return reader.view<T>(count);
+    };
+
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    template <typename T>
+    void SceneSnapshot<TSpectral, TFloat, TMeshFloat>::writeSnapshotImage(std::ofstream& file, const vira::images::Image<T>& image)
+    {
+        vira::images::Resolution resolution = image.resolution();
+        writeValue(file, static_cast<int32_t>(resolution.x));
+        writeValue(file, static_cast<int32_t>(resolution.y));
+
+        const std::vector<T>& data = image.getVector();
+        writeArray(file, data.data(), data.size());
+    };
+
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    template <typename T>
+    void SceneSnapshot<TSpectral, TFloat, TMeshFloat>::readSnapshotImage(vira::utils::MappedFileReader& reader, vira::images::Image<T>& image)
+    {
+        int32_t x;
+        int32_t y;
+        reader.readValue(x);
+        reader.readValue(y);
+
+        size_t count;
+        const T* data = viewArray<T>(reader, count);
+        image = vira::images::Image<T>(vira::images::Resolution{ x, y }, std::vector<T>(data, data + count));
+    };
+
+
+
+    // =========================== //
+    // === Reference Frame I/O === //
+    // =========================== //
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void SceneSnapshot<TSpectral, TFloat, TMeshFloat>::writeFrame(std::ofstream& file, const ReferenceFrame<TFloat>& frame)
+    {
+        writeValue(file, frame.getLocalTransformationMatrix());
+        writeValue(file, frame.getLocalVelocity());
+        writeValue(file, frame.getLocalAngularRate());
+        writeString(file, frame.getNAIFName());
+        writeString(file, frame.getFrameName());
+    };
+
+    /**
+     * @brief Reads the local states and SPICE configuration of a reference frame
+     * @param reader Reader over the mapped snapshot
+     * @param frame The frame to apply the states to (must already be attached to its parent)
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void SceneSnapshot<TSpectral, TFloat, TMeshFloat>::readFrame(vira::utils::MappedFileReader& reader, ReferenceFrame<TFloat>& frame)
+    {
+        mat4<TFloat> localTransformation;
+        vec3<TFloat> localVelocity;
+        vec3<TFloat> localAngularRate;
+        std::string naifName;
+        std::string frameName;
+        reader.readValue(localTransformation);
+        reader.readValue(localVelocity);
+        reader.readValue(localAngularRate);
+        reader.readString(naifName);
+        reader.readString(frameName);
+
+        frame.setLocalTransformation(localTransformation);
+        frame.setLocalVelocity(localVelocity);
+        frame.setLocalAngularRate(localAngularRate);
+        if (!naifName.empty()) {
+            frame.configureSPICE(naifName, frameName);
+        }
+    };
+
+
+
+    // ==================== //
+    // === Material I/O === //
+    // ==================== //
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void SceneSnapshot<TSpectral, TFloat, TMeshFloat>::writeMaterial(std::ofstream& file, materials::Material<TSpectral>& material, uint8_t type)
+    {
+        writeValue(file, type);
+        writeValue(file, static_cast<int32_t>(material.getBSDFID()));
+
+        writeSnapshotImage(file, material.getAlbedoMap());
+        writeSnapshotImage(file, material.getNormalMap());
+        writeSnapshotImage(file, material.getRoughnessMap());
+        writeSnapshotImage(file, material.getMetalnessMap());
+        writeSnapshotImage(file, material.getTransmissionMap());
+        writeSnapshotImage(file, material.getEmissionMap());
+
+        if (type == SNAPSHOT_PBR) {
+            writeValue(file, static_cast<materials::PBRMaterial<TSpectral>&>(material).getF0());
+        }
+    };
+
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    std::unique_ptr<materials::Material<TSpectral>> SceneSnapshot<TSpectral, TFloat, TMeshFloat>::readMaterial(vira::utils::MappedFileReader& reader)
+    {
+        uint8_t type;
+        int32_t bsdfID;
+        reader.readValue(type);
+        reader.readValue(bsdfID);
+
+        std::unique_ptr<materials::Material<TSpectral>> material;
+        if (type == SNAPSHOT_LAMBERTIAN) {
+            material = std::make_unique<materials::Lambertian<TSpectral>>();
+        }
+        else if (type == SNAPSHOT_MCEWEN) {
+            material = std::make_unique<materials::McEwen<TSpectral>>();
+        }
+        else if (type == SNAPSHOT_PBR) {
+            material = std::make_unique<materials::PBRMaterial<TSpectral>>();
+        }
+        else {
+            throw std::runtime_error("Scene snapshot contains an unknown material type");
+        }
+        material->setBSDFID(static_cast<int>(bsdfID));
+
+        vira::images::Image<TSpectral> albedoMap;
+        vira::images::Image<Normal> normalMap;
+        vira::images::Image<float> roughnessMap;
+        vira::images::Image<float> metalnessMap;
+        vira::images::Image<TSpectral> transmissionMap;
+        vira::images::Image<TSpectral> emissionMap;
+        readSnapshotImage(reader, albedoMap);
+        readSnapshotImage(reader, normalMap);
+        readSnapshotImage(reader, roughnessMap);
+        readSnapshotImage(reader, metalnessMap);
+        readSnapshotImage(reader, transmissionMap);
+        readSnapshotImage(reader, emissionMap);
+
+        material->setAlbedo(std::move(albedoMap));
+        material->setNormalMap(std::move(normalMap));
+        material->setRoughness(std::move(roughnessMap));
+        material->setMetalness(std::move(metalnessMap));
+        material->setTransmission(std::move(transmissionMap));
+        material->setEmission(std::move(emissionMap));
+
+        if (type == SNAPSHOT_PBR) {
+            TSpectral f0;
+            reader.readValue(f0);
+            static_cast<materials::PBRMaterial<TSpectral>&>(*material).setF0(f0);
+        }
+
+        return material;
+    };
+
+
+
+    // ================== //
+    // === Camera I/O === //
+    // ================== //
+    /**
+     * @brief Writes the intrinsics, settings, and (optionally) precomputed tables of a camera
+     * @param file The file to write to
+     * @param camera The camera to write
+     * @param options Snapshot options
+     *
+     * @details The per-pixel solid angle table is only stored for an initialized camera without a distortion
+     *          model, as distortion models are not serialized (and the table would not match on load).
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void SceneSnapshot<TSpectral, TFloat, TMeshFloat>::writeCamera(std::ofstream& file, const cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, const SceneSnapshotOptions& options)
+    {
+        writeFrame(file, camera);
+
+        writeValue(file, camera.focal_length_);
+        writeValue(file, camera.px_);
+        writeValue(file, camera.py_);
+        writeValue(file, camera.kxy_);
+        writeValue(file, camera.kyx_);
+        writeValue(file, static_cast<int32_t>(camera.resolution_.x));
+        writeValue(file, static_cast<int32_t>(camera.resolution_.y));
+        writeValue(file, camera.sensor_size_);
+        writeValue(file, camera.optical_efficiency_);
+
+        writeValue(file, camera.exposure_time_);
+        writeValue(file, camera.focus_distance_);
+        writeValue(file, camera.f_stop_);
+        writeValue(file, camera.depth_of_field_);
+        writeValue(file, camera.blender_frame_);
+        writeValue(file, static_cast<uint8_t>(camera.default_psf_option_));
+
+        bool storeTable = options.store_camera_tables && !camera.needs_initialization_ && !camera.hasDistortion();
+        writeValue(file, storeTable);
+        if (storeTable) {
+            writeValue(file, camera.intrinsic_matrix_);
+            writeSnapshotImage(file, camera.pixel_solid_angle_);
+        }
+    };
+
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void SceneSnapshot<TSpectral, TFloat, TMeshFloat>::readCamera(vira::utils::MappedFileReader& reader, cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera)
+    {
+        readFrame(reader, camera);
+
+        int32_t x;
+        int32_t y;
+        uint8_t psfOption;
+        reader.readValue(camera.focal_length_);
+        reader.readValue(camera.px_);
+        reader.readValue(camera.py_);
+        reader.readValue(camera.kxy_);
+        reader.readValue(camera.kyx_);
+        reader.readValue(x);
+        reader.readValue(y);
+        reader.readValue(camera.sensor_size_);
+        reader.readValue(camera.optical_efficiency_);
+
+        reader.readValue(camera.exposure_time_);
+        reader.readValue(camera.focus_distance_);
+        reader.readValue(camera.f_stop_);
+        reader.readValue(camera.depth_of_field_);
+        reader.readValue(camera.blender_frame_);
+        reader.readValue(psfOption);
+
+        camera.resolution_ = vira::images::Resolution{ x, y };
+        camera.default_psf_option_ = static_cast<typename cameras::Camera<TSpectral, TFloat, TMeshFloat>::DefaultPSFOption>(psfOption);
+        camera.needs_initialization_ = true;
+
+        bool hasTable;
+        reader.readValue(hasTable);
+        if (hasTable) {
+            reader.readValue(camera.restored_intrinsic_matrix_);
+            readSnapshotImage(reader, camera.pixel_solid_angle_);
+            camera.restored_solid_angle_ = true;
+        }
+    };
+
+
+
+    // ================= //
+    // === Light I/O === //
+    // ================= //
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void SceneSnapshot<TSpectral, TFloat, TMeshFloat>::writeLight(std::ofstream& file, const lights::Light<TSpectral, TFloat, TMeshFloat>& light)
+    {
+        lights::LightType type = light.getType();
+        writeValue(file, static_cast<uint8_t>(type));
+
+        if (type == lights::POINT_LIGHT) {
+            const auto& pointLight = static_cast<const lights::PointLight<TSpectral, TFloat, TMeshFloat>&>(light);
+            writeValue(file, pointLight.getSpectralIntensity());
+        }
+        else if (type == lights::SPHERE_LIGHT) {
+            const auto& sphereLight = static_cast<const lights::SphereLight<TSpectral, TFloat, TMeshFloat>&>(light);
+            writeValue(file, sphereLight.getRadius());
+            writeValue(file, sphereLight.getSpectralRadiance());
+        }
+
+        writeFrame(file, light);
+    };
+
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    std::unique_ptr<lights::Light<TSpectral, TFloat, TMeshFloat>> SceneSnapshot<TSpectral, TFloat, TMeshFloat>::readLight(vira::utils::MappedFileReader& reader)
+    {
+        uint8_t type;
+        reader.readValue(type);
+
+        if (type == lights::POINT_LIGHT) {
+            TSpectral spectralIntensity;
+            reader.readValue(spectralIntensity);
+            return std::make_unique<lights::PointLight<TSpectral, TFloat, TMeshFloat>>(spectralIntensity * (4.f * PI<float>()));
+        }
+        else if (type == lights::SPHERE_LIGHT) {
+            TFloat radius;
+            TSpectral spectralRadiance;
+            reader.readValue(radius);
+            reader.readValue(spectralRadiance);
+            return std::make_unique<lights::SphereLight<TSpectral, TFloat, TMeshFloat>>(spectralRadiance, radius, false);
+        }
+
+        throw std::runtime_error("Scene snapshot contains an unknown light type");
+    };
+};
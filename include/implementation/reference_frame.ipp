@@ -440,10 +440,17 @@ namespace vira {
     };
 
 
+    /**
+     * @brief Sets the local states (relative to the parent) from SPICE
+     * @param et The ephemeris time
+     *
+     * @details Global states are not updated here, they are propagated for the whole scene graph at once by
+     *          the ReferenceFrameHierarchy.
+     */
     template <IsFloat TFloat>
-    void ReferenceFrame<TFloat>::updateSPICEStates(double et)
+    void ReferenceFrame<TFloat>::computeLocalSPICEStates(double et)
     {
-        // This function directly sets the local and global transformation data without relying on the other
+        // This function directly sets the local transformation data without relying on the other
         // setter methods to ensure the SPICE frames are handled appropriately.
         if (!parent_->configured_frame_) {
             throw std::runtime_error("SPICE NAIFID and FrameName have not both been configured for a Parent (Group) object");
@@ -465,18 +472,6 @@ namespace vira {
             local_angular_rate_ = SpiceUtils<TFloat>::computeAngularRate(frame_name_, parent_->frame_name_, et);
         }
         local_transformation_ = makeTransformationMatrix(local_position_, local_rotation_, local_scale_);
-
-        // Compute global transform (relative to scene):
-        std::array<vira::vec3<TFloat>, 2> global_state = SpiceUtils<TFloat>::spkezr(naif_name_, et, scene_->frame_name_, "NONE", scene_->naif_name_);
-        global_position_ = global_state[0];
-        global_velocity_ = global_state[1];
-        if (!frame_name_.empty()) {
-            global_rotation_ = Rotation<TFloat>(SpiceUtils<TFloat>::pxform(frame_name_, scene_->frame_name_, et));
-            global_angular_rate_ = SpiceUtils<TFloat>::computeAngularRate(frame_name_, scene_->frame_name_, et);
-        }
-        global_transformation_ = makeTransformationMatrix(global_position_, global_rotation_, global_scale_);
-
-        onReferenceFrameChanged();
     };
 
 
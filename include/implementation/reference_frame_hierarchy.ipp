@@ -0,0 +1,194 @@
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <stdexcept>
+
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+
+#include "vira/vec.hpp"
+#include "vira/constraints.hpp"
+#include "vira/reference_frame.hpp"
+
+namespace vira {
+    template <IsFloat TFloat>
+    void ReferenceFrameHierarchy<TFloat>::clear()
+    {
+        frames_.clear();
+        parents_.clear();
+        depths_.clear();
+        level_offsets_.clear();
+        spice_frames_.clear();
+
+        global_transformations_.clear();
+        global_positions_.clear();
+        global_velocities_.clear();
+        global_angular_rates_.clear();
+
+        dirty_.clear();
+        changed_.clear();
+        updated_.clear();
+    };
+
+    /**
+     * @brief Appends a frame to the hierarchy
+     * @param frame The frame to be added
+     * @param parent Index of the parent frame (NO_PARENT for the root)
+     * @return Index of the added frame
+     * @throws std::runtime_error if frames are not added in breadth-first order
+     */
+    template <IsFloat TFloat>
+    uint32_t ReferenceFrameHierarchy<TFloat>::addFrame(ReferenceFrame<TFloat>* frame, uint32_t parent)
+    {
+        uint32_t index = static_cast<uint32_t>(frames_.size());
+        uint32_t depth = 0;
+        if (parent != NO_PARENT) {
+            if (parent >= index) {
+                throw std::runtime_error("ReferenceFrameHierarchy parents must be added before their children");
+            }
+            depth = depths_[parent] + 1;
+        }
+
+        if (!depths_.empty() && depth < depths_.back()) {
+            throw std::runtime_error("ReferenceFrameHierarchy frames must be added in breadth-first order");
+        }
+        if (depth == level_offsets_.size()) {
+            level_offsets_.push_back(index);
+        }
+
+        frames_.push_back(frame);
+        parents_.push_back(parent);
+        depths_.push_back(depth);
+        if (parent != NO_PARENT && frame->isConfiguredSpiceObject()) {
+            spice_frames_.push_back(index);
+        }
+
+        global_transformations_.emplace_back(1);
+        global_positions_.emplace_back(0);
+        global_velocities_.emplace_back(0);
+        global_angular_rates_.emplace_back(0);
+
+        dirty_.push_back(0);
+        changed_.push_back(0);
+
+        return index;
+    };
+
+    /**
+     * @brief Sets the local states of all SPICE configured frames and propagates the results
+     * @param et The ephemeris time
+     *
+     * @details SPICE is not thread safe, so the local states are queried sequentially.  Frames which are not
+     *          configured as SPICE objects keep their local states, and are only updated if an ancestor moved.
+     */
+    template <IsFloat TFloat>
+    void ReferenceFrameHierarchy<TFloat>::updateSPICE(double et)
+    {
+        for (uint32_t index : spice_frames_) {
+            frames_[index]->computeLocalSPICEStates(et);
+            dirty_[index] = 1;
+        }
+        update();
+    };
+
+    /**
+     * @brief Propagates global transformations and velocities from the dirty frames to their descendants
+     *
+     * @details After the update, getUpdatedFrames() holds the indices of every frame whose global state was
+     *          recomputed.
+     */
+    template <IsFloat TFloat>
+    void ReferenceFrameHierarchy<TFloat>::update()
+    {
+        updated_.clear();
+
+        for (size_t level = 0; level < level_offsets_.size(); ++level) {
+            size_t begin = level_offsets_[level];
+            size_t end = (level + 1 < level_offsets_.size()) ? level_offsets_[level + 1] : frames_.size();
+
+            tbb::parallel_for(tbb::blocked_range<size_t>(begin, end, 256),
+                [&](const tbb::blocked_range<size_t>& range) {
+                    for (size_t i = range.begin(); i != range.end(); ++i) {
+                        uint32_t parent = parents_[i];
+                        changed_[i] = dirty_[i] || (parent != NO_PARENT && changed_[parent]);
+                        if (changed_[i]) {
+                            updateFrame(static_cast<uint32_t>(i));
+                        }
+                    }
+                });
+        }
+
+        for (uint32_t i = 0; i < static_cast<uint32_t>(frames_.size()); ++i) {
+            if (changed_[i]) {
+                updated_.push_back(i);
+            }
+            dirty_[i] = 0;
+        }
+    };
+
+    /**
+     * @brief Recomputes the global state of a single frame and writes it back to the frame
+     * @param index Index of the frame to be updated
+     *
+     * @details Parent states are read from the hierarchy if the parent was updated in this pass, and from the
+     *          parent frame otherwise (as it may have been modified directly since the last update).  The
+     *          velocity model matches ReferenceFrame::updateGlobalVelocities(), except that the local velocity
+     *          of a SPICE frame (from spkezr in its parent's frame) is rotated by the parent's global rotation.
+     */
+    template <IsFloat TFloat>
+    void ReferenceFrameHierarchy<TFloat>::updateFrame(uint32_t index)
+    {
+        ReferenceFrame<TFloat>* frame = frames_[index];
+        uint32_t parent = parents_[index];
+
+        mat4<TFloat> parent_transformation{ 1 };
+        vec3<TFloat> parent_position{ 0 };
+        vec3<TFloat> parent_velocity{ 0 };
+        vec3<TFloat> parent_angular_rate{ 0 };
+        if (parent != NO_PARENT) {
+            if (changed_[parent]) {
+                parent_transformation = global_transformations_[parent];
+                parent_position = global_positions_[parent];
+                parent_velocity = global_velocities_[parent];
+                parent_angular_rate = global_angular_rates_[parent];
+            }
+            else {
+                const ReferenceFrame<TFloat>* parent_frame = frames_[parent];
+                parent_transformation = parent_frame->global_transformation_;
+                parent_position = parent_frame->global_position_;
+                parent_velocity = parent_frame->global_velocity_;
+                parent_angular_rate = parent_frame->global_angular_rate_;
+            }
+        }
+
+        mat4<TFloat> global_transformation = parent_transformation * frame->local_transformation_;
+        vec3<TFloat> global_position = ReferenceFrame<TFloat>::getPositionFromTransformation(global_transformation);
+        vec3<TFloat> global_scale = ReferenceFrame<TFloat>::getScaleFromTransformation(global_transformation);
+        Rotation<TFloat> global_rotation = ReferenceFrame<TFloat>::getRotationFromTransformation(global_transformation, global_scale);
+
+        // SPICE velocities are queried in the parent's axes, while velocities set directly are in the frame's own axes:
+        vec3<TFloat> local_velocity;
+        if (parent != NO_PARENT && frame->isConfiguredSpiceObject()) {
+            vec3<TFloat> parent_scale = ReferenceFrame<TFloat>::getScaleFromTransformation(parent_transformation);
+            local_velocity = ReferenceFrame<TFloat>::getRotationFromTransformation(parent_transformation, parent_scale) * frame->local_velocity_;
+        }
+        else {
+            local_velocity = global_rotation * frame->local_velocity_;
+        }
+
+        vec3<TFloat> global_velocity = parent_velocity + cross(parent_angular_rate, global_position - parent_position) + local_velocity;
+        vec3<TFloat> global_angular_rate = parent_angular_rate + global_rotation * frame->local_angular_rate_;
+
+        global_transformations_[index] = global_transformation;
+        global_positions_[index] = global_position;
+        global_velocities_[index] = global_velocity;
+        global_angular_rates_[index] = global_angular_rate;
+
+        frame->global_transformation_ = global_transformation;
+        frame->global_position_ = global_position;
+        frame->global_scale_ = global_scale;
+        frame->global_rotation_ = global_rotation;
+        frame->global_velocity_ = global_velocity;
+        frame->global_angular_rate_ = global_angular_rate;
+    };
+};
@@ -0,0 +1,33 @@
+#include "vira/vec.hpp"
+#include "vira/spectral_data.hpp"
+#include "vira/constraints.hpp"
+#include "vira/rendering/ray.hpp"
+#include "vira/geometry/mesh.hpp"
+#include "vira/geometry/analytic_ellipsoid.hpp"
+#include "vira/rendering/acceleration/aabb.hpp"
+
+namespace vira::rendering {
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    AnalyticBLAS<TSpectral, TFloat, TMeshFloat>::AnalyticBLAS(vira::geometry::Mesh<TSpectral, TFloat, TMeshFloat>* newMesh, BVHBuildOptions buildOptions)
+    {
+        (void)buildOptions;
+
+        this->mesh = newMesh;
+        this->mesh_ptr = static_cast<void*>(this->mesh); // Store type-erased pointer to Mesh
+
+        const auto& ellipsoid = this->mesh->getAnalyticEllipsoid();
+        this->aabb = AABB<TSpectral, TFloat>(vec3<TFloat>(ellipsoid.getMin()), vec3<TFloat>(ellipsoid.getMax()));
+    };
+
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void AnalyticBLAS<TSpectral, TFloat, TMeshFloat>::intersect(Ray<TSpectral, TMeshFloat>& ray)
+    {
+        this->mesh->getAnalyticEllipsoid().intersect(ray, this->mesh_ptr);
+    };
+
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    AABB<TSpectral, TFloat> AnalyticBLAS<TSpectral, TFloat, TMeshFloat>::getAABB()
+    {
+        return this->aabb;
+    };
+};
@@ -1,5 +1,6 @@
 #include <cstdint>
 #include <limits>
+#include <algorithm>
 
 #include "embree3/rtcore.h"
 
@@ -7,38 +8,137 @@
 #include "vira/spectral_data.hpp"
 #include "vira/geometry/triangle.hpp"
 #include "vira/geometry/vertex.hpp"
+#include "vira/geometry/quantization.hpp"
+#include "vira/geometry/analytic_ellipsoid.hpp"
 #include "vira/rendering/acceleration/embree_options.hpp"
+#include "vira/rendering/ray_statistics.hpp"
 
 namespace vira::rendering {
+    namespace detail {
+        // Embree user geometry callbacks for analytic ellipsoids.  The parametric longitude and latitude of the
+        // hit are stored in the u and v hit coordinates, from which the exact surface point is reconstructed.
+        template <IsSpectral TSpectral>
+        void analyticEllipsoidBounds(const RTCBoundsFunctionArguments* args)
+        {
+            const auto* ellipsoid = static_cast<const vira::geometry::AnalyticEllipsoid<TSpectral, float>*>(args->geometryUserPtr);
+            RTCBounds* bounds = args->bounds_o;
+            bounds->lower_x = -ellipsoid->radii[0];
+            bounds->lower_y = -ellipsoid->radii[1];
+            bounds->lower_z = -ellipsoid->radii[2];
+            bounds->upper_x = ellipsoid->radii[0];
+            bounds->upper_y = ellipsoid->radii[1];
+            bounds->upper_z = ellipsoid->radii[2];
+        };
+
+        template <IsSpectral TSpectral>
+        void analyticEllipsoidIntersect(const RTCIntersectFunctionNArguments* args)
+        {
+            const auto* ellipsoid = static_cast<const vira::geometry::AnalyticEllipsoid<TSpectral, float>*>(args->geometryUserPtr);
+            RTCRayN* rays = RTCRayHitN_RayN(args->rayhit, args->N);
+            RTCHitN* hits = RTCRayHitN_HitN(args->rayhit, args->N);
+
+            for (unsigned int i = 0; i < args->N; ++i) {
+                if (args->valid[i] == 0) {
+                    continue;
+                }
+
+                vec3<float> origin{ RTCRayN_org_x(rays, args->N, i), RTCRayN_org_y(rays, args->N, i), RTCRayN_org_z(rays, args->N, i) };
+                vec3<float> direction{ RTCRayN_dir_x(rays, args->N, i), RTCRayN_dir_y(rays, args->N, i), RTCRayN_dir_z(rays, args->N, i) };
+
+                float t;
+                vec2<float> angles;
+                if (ellipsoid->intersect(origin, direction, RTCRayN_tnear(rays, args->N, i), RTCRayN_tfar(rays, args->N, i), t, angles)) {
+                    Normal normal = ellipsoid->surfaceVertex(angles).normal;
+
+                    RTCRayN_tfar(rays, args->N, i) = t;
+                    RTCHitN_Ng_x(hits, args->N, i) = normal[0];
+                    RTCHitN_Ng_y(hits, args->N, i) = normal[1];
+                    RTCHitN_Ng_z(hits, args->N, i) = normal[2];
+                    RTCHitN_u(hits, args->N, i) = angles[0];
+                    RTCHitN_v(hits, args->N, i) = angles[1];
+                    RTCHitN_primID(hits, args->N, i) = args->primID;
+                    RTCHitN_geomID(hits, args->N, i) = args->geomID;
+                    for (unsigned int level = 0; level < RTC_MAX_INSTANCE_LEVEL_COUNT; ++level) {
+                        RTCHitN_instID(hits, args->N, i, level) = args->context->instID[level];
+                    }
+                }
+            }
+        };
+
+        template <IsSpectral TSpectral>
+        void analyticEllipsoidOccluded(const RTCOccludedFunctionNArguments* args)
+        {
+            const auto* ellipsoid = static_cast<const vira::geometry::AnalyticEllipsoid<TSpectral, float>*>(args->geometryUserPtr);
+            RTCRayN* rays = args->ray;
+
+            for (unsigned int i = 0; i < args->N; ++i) {
+                if (args->valid[i] == 0) {
+                    continue;
+                }
+
+                vec3<float> origin{ RTCRayN_org_x(rays, args->N, i), RTCRayN_org_y(rays, args->N, i), RTCRayN_org_z(rays, args->N, i) };
+                vec3<float> direction{ RTCRayN_dir_x(rays, args->N, i), RTCRayN_dir_y(rays, args->N, i), RTCRayN_dir_z(rays, args->N, i) };
+
+                float t;
+                vec2<float> angles;
+                if (ellipsoid->intersect(origin, direction, RTCRayN_tnear(rays, args->N, i), RTCRayN_tfar(rays, args->N, i), t, angles)) {
+                    RTCRayN_tfar(rays, args->N, i) = -std::numeric_limits<float>::infinity();
+                }
+            }
+        };
+    };
+
     template <IsSpectral TSpectral, IsFloat TFloat>
     EmbreeBLAS<TSpectral, TFloat>::EmbreeBLAS(RTCDevice device, vira::geometry::Mesh<TSpectral, TFloat, float>* newMesh, BVHBuildOptions buildOptions)
     {
         (void)buildOptions;
 
-        // Initialize Embree data structures:
-        scene = rtcNewScene(device);
-        geom = rtcNewGeometry(device, RTC_GEOMETRY_TYPE_TRIANGLE);
-
         this->mesh = newMesh;
         this->mesh_ptr = static_cast<void*>(this->mesh); // Store type-erased pointer to Mesh
 
-        auto vertexBuffer = this->mesh->getVertexBuffer();
-        auto indexBuffer = this->mesh->getIndexBuffer();
-
-        // Create shared geometry buffer:
-        unsigned int slotVert = 0;
-        const void* vPtr = vertexBuffer.data();
-        size_t byteOffsetVert = 0;
-        size_t byteStrideVert = sizeof(vira::geometry::Vertex<TSpectral, float>);
-        size_t itemCountVert = vertexBuffer.size();
-        rtcSetSharedGeometryBuffer(geom, RTC_BUFFER_TYPE_VERTEX, slotVert, RTC_FORMAT_FLOAT3, vPtr, byteOffsetVert, byteStrideVert, itemCountVert);
-
-        unsigned int slotInd = 0;
-        const void* iPtr = indexBuffer.data();
-        size_t byteOffsetInd = 0;
-        size_t byteStrideInd = 3 * sizeof(uint32_t);
-        size_t itemCountInd = indexBuffer.size() / 3;
-        rtcSetSharedGeometryBuffer(geom, RTC_BUFFER_TYPE_INDEX, slotInd, RTC_FORMAT_UINT3, iPtr, byteOffsetInd, byteStrideInd, itemCountInd);
+        // Initialize Embree data structures:
+        scene = rtcNewScene(device);
+        if (this->mesh->isAnalytic()) {
+            // Analytic meshes are a single user-defined primitive:
+            geom = rtcNewGeometry(device, RTC_GEOMETRY_TYPE_USER);
+            rtcSetGeometryUserPrimitiveCount(geom, 1);
+            rtcSetGeometryUserData(geom, const_cast<void*>(static_cast<const void*>(&this->mesh->getAnalyticEllipsoid())));
+            rtcSetGeometryBoundsFunction(geom, detail::analyticEllipsoidBounds<TSpectral>, nullptr);
+            rtcSetGeometryIntersectFunction(geom, detail::analyticEllipsoidIntersect<TSpectral>);
+            rtcSetGeometryOccludedFunction(geom, detail::analyticEllipsoidOccluded<TSpectral>);
+        }
+        else {
+            geom = rtcNewGeometry(device, RTC_GEOMETRY_TYPE_TRIANGLE);
+
+            // Re-compacts a compact mesh whose vertices have been modified:
+            this->mesh->constructTriangles();
+
+            const auto& vertexBuffer = this->mesh->getVertexBuffer();
+
+            // Create shared geometry buffer:
+            unsigned int slotVert = 0;
+            const void* vPtr = vertexBuffer.data();
+            size_t byteOffsetVert = 0;
+            size_t byteStrideVert = sizeof(vira::geometry::Vertex<TSpectral, float>);
+            size_t itemCountVert = vertexBuffer.size();
+            rtcSetSharedGeometryBuffer(geom, RTC_BUFFER_TYPE_VERTEX, slotVert, RTC_FORMAT_FLOAT3, vPtr, byteOffsetVert, byteStrideVert, itemCountVert);
+
+            unsigned int slotInd = 0;
+            size_t byteStrideInd = 3 * sizeof(uint32_t);
+            size_t itemCountInd = this->mesh->getNumTriangles();
+            if (this->mesh->isCompact()) {
+                // Embree has no 16-bit triangle index format, so the IndexBuffer16 is widened into a buffer owned by Embree:
+                const IndexBuffer16& indexBuffer16 = this->mesh->getIndexBuffer16();
+                uint32_t* iPtr = static_cast<uint32_t*>(rtcSetNewGeometryBuffer(geom, RTC_BUFFER_TYPE_INDEX, slotInd, RTC_FORMAT_UINT3, byteStrideInd, itemCountInd));
+                std::copy(indexBuffer16.begin(), indexBuffer16.end(), iPtr);
+            }
+            else {
+                const auto& indexBuffer = this->mesh->getIndexBuffer();
+                const void* iPtr = indexBuffer.data();
+                size_t byteOffsetInd = 0;
+                rtcSetSharedGeometryBuffer(geom, RTC_BUFFER_TYPE_INDEX, slotInd, RTC_FORMAT_UINT3, iPtr, byteOffsetInd, byteStrideInd, itemCountInd);
+            }
+        }
 
 
 
@@ -94,10 +194,19 @@ namespace vira::rendering {
 
         // Perform intersection:
         rtcIntersect1(scene, &context, &embreeRay);
+        if (RayCounters* counters = activeRayCounters()) {
+            counters->embree_queries++;
+        }
 
-        if (embreeRay.hit.geomID != RTC_INVALID_GEOMETRY_ID) {
+        if (embreeRay.hit.geomID != RTC_INVALID_GEOMETRY_ID && this->mesh->isAnalytic()) {
+            this->mesh->getAnalyticEllipsoid().setInteraction(ray.hit, vec2<float>{ embreeRay.hit.u, embreeRay.hit.v });
+            ray.hit.t = embreeRay.ray.tfar;
+            ray.hit.mesh_ptr = this->mesh_ptr;
+        }
+        else if (embreeRay.hit.geomID != RTC_INVALID_GEOMETRY_ID) {
             ray.hit.tri_id = embreeRay.hit.primID;
-            const vira::geometry::Triangle<TSpectral, float>& tri = this->mesh->getTriangle(ray.hit.tri_id);
+            vira::geometry::Triangle<TSpectral, float> scratch;
+            const vira::geometry::Triangle<TSpectral, float>& tri = this->mesh->getTriangle(ray.hit.tri_id, scratch);
 
             // TODO Why is this winding order offet?
             // Are w[3] values being calculated incorrectly?
@@ -148,11 +257,17 @@ namespace vira::rendering {
         }
 
         RTCRayHitSelector<N>::intersect(valid, scene, &context, &embreeRays);
+        if (RayCounters* counters = activeRayCounters()) {
+            for (size_t i = 0; i < N; ++i) {
+                counters->embree_queries += (valid[i] != 0) ? 1 : 0;
+            }
+        }
 
         for (size_t i = 0; i < N; ++i) {
             if (embreeRays.hit.geomID[i] != RTC_INVALID_GEOMETRY_ID) {
                 rayPacket[i].hit.triID = embreeRays.hit.primID[i];
-                const vira::geometry::Triangle<TSpectral, float>& tri = this->mesh->getTriangle(rayPacket[i].hit.triID);
+                vira::geometry::Triangle<TSpectral, float> scratch;
+                const vira::geometry::Triangle<TSpectral, float>& tri = this->mesh->getTriangle(rayPacket[i].hit.triID, scratch);
 
                 // TODO Why is this winding order offet?
                 // Are w[3] values being calculated incorrectly?
@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <stdexcept>
 #include <array>
+#include <unordered_map>
 
 #include "embree3/rtcore.h"
 
@@ -14,6 +15,7 @@
 #include "vira/rendering/acceleration/aabb.hpp"
 #include "vira/rendering/acceleration/embree_blas.hpp"
 #include "vira/rendering/acceleration/embree_options.hpp"
+#include "vira/rendering/ray_statistics.hpp"
 
 namespace vira::rendering {
     template <IsSpectral TSpectral>
@@ -48,6 +50,7 @@ namespace vira::rendering {
         : TLAS<TSpectral, float, float>(std::move(other))
         , global_scene_(other.global_scene_)
         , instance_array_(std::move(other.instance_array_))
+        , instance_geometry_ids_(std::move(other.instance_geometry_ids_))
     {
         // Invalidate the moved-from object so its destructor won't release the scene
         other.global_scene_ = nullptr;
@@ -66,6 +69,7 @@ namespace vira::rendering {
             TLAS<TSpectral, float, float>::operator=(std::move(other));
             global_scene_ = other.global_scene_;
             instance_array_ = std::move(other.instance_array_);
+            instance_geometry_ids_ = std::move(other.instance_geometry_ids_);
 
             // Invalidate the moved-from object
             other.global_scene_ = nullptr;
@@ -82,14 +86,7 @@ namespace vira::rendering {
         rtcSetGeometryTimeStepCount(rtc_instance, 1);
 
         // Assign the transformation to the RTC instance:
-        mat4<float> modelMatrix = instance->getModelMatrix();
-        float transform[16];
-        for (int i = 0; i < 4; ++i) {
-            for (int j = 0; j < 4; ++j) {
-                transform[i * 4 + j] = modelMatrix[i][j];
-            }
-        }
-        rtcSetGeometryTransform(rtc_instance, 0, RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR, transform);
+        setInstanceTransform(rtc_instance, instance);
 
         // Commit and attach
         rtcCommitGeometry(rtc_instance);
@@ -104,6 +101,7 @@ namespace vira::rendering {
         mesh_data.mesh = mesh;
         mesh_data.instance = instance;
         instance_array_[rtc_instance_id] = mesh_data;
+        instance_geometry_ids_[instance] = rtc_instance_id;
 
         rtcReleaseGeometry(rtc_instance);
     };
@@ -114,6 +112,49 @@ namespace vira::rendering {
         rtcCommitScene(this->global_scene_);
     };
 
+    /**
+     * @brief Updates the transformations of instances which have moved and recommits the scene
+     * @param instances The instances whose transformations have changed
+     * @return true (instances which are not part of the TLAS, such as those hidden by the LoD manager, are ignored)
+     *
+     * @details Only the modified instance geometries are recommitted, so Embree refits the top level rather
+     *          than rebuilding every instance.
+     */
+    template <IsSpectral TSpectral>
+    bool EmbreeTLAS<TSpectral>::updateInstances(const std::vector<const vira::scene::Instance<TSpectral, float, float>*>& instances)
+    {
+        bool modified = false;
+        for (const auto* instance : instances) {
+            auto it = instance_geometry_ids_.find(instance);
+            if (it == instance_geometry_ids_.end()) {
+                continue;
+            }
+
+            RTCGeometry rtc_instance = rtcGetGeometry(global_scene_, it->second);
+            setInstanceTransform(rtc_instance, instance);
+            rtcCommitGeometry(rtc_instance);
+            modified = true;
+        }
+
+        if (modified) {
+            rtcCommitScene(global_scene_);
+        }
+        return true;
+    };
+
+    template <IsSpectral TSpectral>
+    void EmbreeTLAS<TSpectral>::setInstanceTransform(RTCGeometry rtc_instance, const vira::scene::Instance<TSpectral, float, float>* instance)
+    {
+        mat4<float> modelMatrix = instance->getModelMatrix();
+        float transform[16];
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                transform[i * 4 + j] = modelMatrix[i][j];
+            }
+        }
+        rtcSetGeometryTransform(rtc_instance, 0, RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR, transform);
+    };
+
     template <IsSpectral TSpectral>
     thread_local RTCIntersectContext EmbreeTLAS<TSpectral>::context_;
 
@@ -124,6 +165,19 @@ namespace vira::rendering {
         rtcInitIntersectContext(&context_);
     };
 
+    /**
+     * @brief Returns the number of bytes held by the instance tables
+     * @details The Embree scene itself is allocated by the device, and is measured by the Scene's EmbreeMemoryMonitor.
+     */
+    template <IsSpectral TSpectral>
+    size_t EmbreeTLAS<TSpectral>::getMemoryUsage() const
+    {
+        using GeometryIDEntry = typename decltype(instance_geometry_ids_)::value_type;
+        return instance_array_.capacity() * sizeof(InstanceMeshData<TSpectral>)
+            + instance_geometry_ids_.size() * (sizeof(GeometryIDEntry) + sizeof(void*))
+            + instance_geometry_ids_.bucket_count() * sizeof(void*);
+    };
+
     template <IsSpectral TSpectral>
     void EmbreeTLAS<TSpectral>::intersect(Ray<TSpectral, float>& ray)
     {
@@ -140,6 +194,9 @@ namespace vira::rendering {
 
         // Perform intersection:
         rtcIntersect1(global_scene_, &context_, &embreeRay);
+        if (RayCounters* counters = activeRayCounters()) {
+            counters->embree_queries++;
+        }
 
         if (embreeRay.hit.geomID != RTC_INVALID_GEOMETRY_ID) {
             ray.hit.tri_id = embreeRay.hit.primID;
@@ -151,7 +208,15 @@ namespace vira::rendering {
 
             ray.hit.t = embreeRay.ray.tfar;
 
-            const vira::geometry::Triangle<TSpectral, float>& tri = mesh->getTriangle(ray.hit.tri_id);
+            if (mesh->isAnalytic()) {
+                mesh->getAnalyticEllipsoid().setInteraction(ray.hit, vec2<float>{ embreeRay.hit.u, embreeRay.hit.v });
+                ray.hit.mesh_ptr = mesh;
+                ray.hit.instance_ptr = instance;
+                return;
+            }
+
+            vira::geometry::Triangle<TSpectral, float> scratch;
+            const vira::geometry::Triangle<TSpectral, float>& tri = mesh->getTriangle(ray.hit.tri_id, scratch);
             ray.hit.face_normal = tri.face_normal;
 
             // TODO Why is this winding order offet?
@@ -1,6 +1,10 @@
+#include <cmath>
 #include <cstdint>
 #include <memory>
 #include <vector>
+#include <algorithm>
+#include <array>
+#include <stdexcept>
 
 #include "vira/vec.hpp"
 #include "vira/spectral_data.hpp"
@@ -9,13 +13,12 @@
 #include "vira/geometry/triangle.hpp"
 #include "vira/geometry/mesh.hpp"
 #include "vira/rendering/acceleration/aabb.hpp"
+#include "vira/rendering/ray_statistics.hpp"
 
 namespace vira::rendering {
     template <IsSpectral TSpectral>
     ViraBLAS<TSpectral>::ViraBLAS(vira::geometry::Mesh<TSpectral, double, double>* newMesh, BVHBuildOptions buildOptions)
     {
-        (void)buildOptions;
-
         this->mesh = newMesh;
         this->mesh_ptr = static_cast<void*>(this->mesh); // Store type-erased pointer to Mesh
 
@@ -26,11 +29,46 @@ namespace vira::rendering {
         bvhNode = new ViraBLASNode<TSpectral>[numTriangles * 2 - 1];
 
         triIdx = new size_t[numTriangles];
-        for (size_t i = 0; i < numTriangles; i++) {
-            triIdx[i] = i;
+        if (buildOptions.cluster_leaves && !this->mesh->getClusters().empty()) {
+            this->buildFromClusters();
+        }
+        else {
+            for (size_t i = 0; i < numTriangles; i++) {
+                triIdx[i] = i;
+            }
+
+            this->build();
         }
+    };
+
+    /**
+     * @brief Restores a previously built BVH (such as one read from a SceneSnapshot)
+     * @param newMesh The mesh the hierarchy was built for
+     * @param nodes The nodes of the hierarchy
+     * @param nodeCount Number of nodes
+     * @param triangleIndices Triangle indices referenced by the leaf nodes (one per triangle of the mesh)
+     */
+    template <IsSpectral TSpectral>
+    ViraBLAS<TSpectral>::ViraBLAS(vira::geometry::Mesh<TSpectral, double, double>* newMesh, const ViraBLASNode<TSpectral>* nodes, size_t nodeCount, const size_t* triangleIndices)
+    {
+        this->mesh = newMesh;
+        this->mesh_ptr = static_cast<void*>(this->mesh); // Store type-erased pointer to Mesh
+
+        this->mesh->constructTriangles();
+
+        numTriangles = this->mesh->getNumTriangles();
+        if (numTriangles == 0 || nodeCount == 0 || nodeCount > 2 * numTriangles - 1) {
+            throw std::runtime_error("Stored BVH does not match the number of triangles in the mesh");
+        }
+
+        bvhNode = new ViraBLASNode<TSpectral>[numTriangles * 2 - 1];
+        std::copy(nodes, nodes + nodeCount, bvhNode);
+        nodesUsed = nodeCount;
+
+        triIdx = new size_t[numTriangles];
+        std::copy(triangleIndices, triangleIndices + numTriangles, triIdx);
 
-        this->build();
+        this->aabb = bvhNode[0].aabb;
     };
 
     template <IsSpectral TSpectral>
@@ -40,6 +78,21 @@ namespace vira::rendering {
         delete[] triIdx;
     };
 
+    /**
+     * @brief Returns the number of bytes allocated for the node and triangle index arrays
+     * @details Nodes are allocated for the worst case (2N - 1 for N triangles), regardless of how many are used.
+     */
+    template <IsSpectral TSpectral>
+    size_t ViraBLAS<TSpectral>::getMemoryUsage() const
+    {
+        if (bvhNode == nullptr) {
+            return 0;
+        }
+
+        return (2 * numTriangles - 1) * sizeof(ViraBLASNode<TSpectral>) + numTriangles * sizeof(size_t)
+            + clusterBounds.capacity() * sizeof(AABB<TSpectral, double>) + clusterIdx.capacity() * sizeof(size_t);
+    };
+
     template <IsSpectral TSpectral>
     void ViraBLAS<TSpectral>::build()
     {
@@ -54,21 +107,211 @@ namespace vira::rendering {
         this->aabb = root.aabb;
     };
 
+    /**
+     * @brief Builds the BVH using the mesh's triangle clusters as prebuilt leaves
+     *
+     * @details The upper levels of the hierarchy are built with binned SAH over the (spatially coherent)
+     *          clusters, which are far fewer than triangles.  Each resulting leaf is then refined with the
+     *          triangle-level builder, which only ever operates on a handful of clusters at a time.
+     */
+    template <IsSpectral TSpectral>
+    void ViraBLAS<TSpectral>::buildFromClusters()
+    {
+        const auto& clusters = this->mesh->getClusters();
+        const std::vector<uint32_t>& order = this->mesh->getClusterOrder();
+        size_t numClusters = clusters.size();
+
+        // Compute the bounds of each cluster (triangles with non-finite vertices, such as DEM no-data regions, are excluded):
+        clusterBounds.assign(numClusters, AABB<TSpectral, double>{});
+        clusterIdx.resize(numClusters);
+        for (size_t c = 0; c < numClusters; ++c) {
+            clusterIdx[c] = c;
+            for (size_t k = clusters[c].first_triangle; k < clusters[c].first_triangle + clusters[c].triangle_count; ++k) {
+                std::array<vec3<double>, 3> positions = this->mesh->getTrianglePositions(order[k]);
+                if (std::isinf(positions[0][0]) || std::isinf(positions[1][0]) || std::isinf(positions[2][0])) {
+                    continue;
+                }
+                clusterBounds[c].grow(positions[0]);
+                clusterBounds[c].grow(positions[1]);
+                clusterBounds[c].grow(positions[2]);
+            }
+        }
+
+        // Build the upper levels over clusters (leftFirst/triCount refer to clusterIdx during this stage):
+        ViraBLASNode<TSpectral>& root = bvhNode[0];
+        root.leftFirst = 0;
+        root.triCount = numClusters;
+        for (size_t c = 0; c < numClusters; ++c) {
+            root.aabb.grow(clusterBounds[c]);
+        }
+        subdivideClusters(0);
+
+        // Lay out the triangles in cluster order:
+        std::vector<size_t> clusterStart(numClusters + 1);
+        size_t offset = 0;
+        for (size_t k = 0; k < numClusters; ++k) {
+            const auto& cluster = clusters[clusterIdx[k]];
+            clusterStart[k] = offset;
+            for (size_t j = 0; j < cluster.triangle_count; ++j) {
+                triIdx[offset++] = order[cluster.first_triangle + j];
+            }
+        }
+        clusterStart[numClusters] = offset;
+
+        // Convert leaves to triangle ranges, and refine them at triangle granularity:
+        size_t clusterNodes = nodesUsed;
+        for (size_t n = 0; n < clusterNodes; ++n) {
+            ViraBLASNode<TSpectral>& node = bvhNode[n];
+            if (node.triCount > 0) {
+                size_t first = node.leftFirst;
+                node.leftFirst = clusterStart[first];
+                node.triCount = clusterStart[first + node.triCount] - clusterStart[first];
+            }
+        }
+        for (size_t n = 0; n < clusterNodes; ++n) {
+            if (bvhNode[n].triCount > 0) {
+                subdivide(n);
+            }
+        }
+
+        this->aabb = root.aabb;
+
+        clusterBounds = std::vector<AABB<TSpectral, double>>{};
+        clusterIdx = std::vector<size_t>{};
+    };
+
+    template <IsSpectral TSpectral>
+    void ViraBLAS<TSpectral>::subdivideClusters(size_t nodeIdx)
+    {
+        ViraBLASNode<TSpectral>& node = bvhNode[nodeIdx];
+        if (node.triCount <= 1) {
+            return;
+        }
+
+        const auto& clusters = this->mesh->getClusters();
+
+        // Find the longest axis:
+        int a = 0;
+        vec3<double> extent = node.aabb.max() - node.aabb.min();
+        if (extent.y > extent.x) {
+            a = 1;
+        }
+        if (extent.z > extent[a]) {
+            a = 2;
+        }
+
+        // Calculate the centroid bounds (cluster bounding sphere centers only use valid triangles):
+        double boundsMin = std::numeric_limits<double>::infinity();
+        double boundsMax = -std::numeric_limits<double>::infinity();
+        for (size_t i = 0; i < node.triCount; i++) {
+            double centroid = clusters[clusterIdx[node.leftFirst + i]].center[a];
+            boundsMin = std::min(boundsMin, centroid);
+            boundsMax = std::max(boundsMax, centroid);
+        }
+        if (!(boundsMax > boundsMin)) {
+            return;
+        }
+
+        // Populate the bins:
+        const size_t BINS = 8;
+        Bin bin[BINS];
+        double scale = BINS / (boundsMax - boundsMin);
+        for (size_t i = 0; i < node.triCount; i++) {
+            size_t c = clusterIdx[node.leftFirst + i];
+            size_t binIdx = std::min(BINS - 1, static_cast<size_t>((clusters[c].center[a] - boundsMin) * scale));
+            bin[binIdx].triCount++;
+            bin[binIdx].bounds.grow(clusterBounds[c]);
+        }
+
+        // Evaluate the SAH cost of the planes between the bins:
+        double leftArea[BINS - 1];
+        double rightArea[BINS - 1];
+        size_t leftCount[BINS - 1];
+        size_t rightCount[BINS - 1];
+        AABB<TSpectral, double> leftBox, rightBox;
+        size_t leftSum = 0, rightSum = 0;
+        for (size_t i = 0; i < BINS - 1; i++) {
+            leftSum += bin[i].triCount;
+            leftCount[i] = leftSum;
+            leftBox.grow(bin[i].bounds);
+            leftArea[i] = leftBox.area();
+            rightSum += bin[BINS - 1 - i].triCount;
+            rightCount[BINS - 2 - i] = rightSum;
+            rightBox.grow(bin[BINS - 1 - i].bounds);
+            rightArea[BINS - 2 - i] = rightBox.area();
+        }
+
+        double bestCost = std::numeric_limits<double>::max();
+        double splitPos = boundsMin;
+        scale = (boundsMax - boundsMin) / BINS;
+        for (size_t i = 0; i < BINS - 1; i++) {
+            double planeCost = static_cast<double>(leftCount[i]) * leftArea[i] + static_cast<double>(rightCount[i]) * rightArea[i];
+            if (planeCost < bestCost) {
+                splitPos = boundsMin + scale * static_cast<double>(i + 1);
+                bestCost = planeCost;
+            }
+        }
+
+        // Keep the node as a leaf if no split improves on it:
+        if (bestCost >= calculateNodeCost(node)) {
+            return;
+        }
+
+        // In-place partition of the clusters:
+        size_t i = node.leftFirst;
+        size_t end = i + node.triCount;
+        while (i < end) {
+            if (clusters[clusterIdx[i]].center[a] < splitPos) {
+                i++;
+            }
+            else {
+                std::swap(clusterIdx[i], clusterIdx[--end]);
+            }
+        }
+
+        size_t leftClusters = i - node.leftFirst;
+        if (leftClusters == 0 || leftClusters == node.triCount) {
+            return;
+        }
+
+        // Create the child nodes:
+        size_t leftChildIdx = nodesUsed++;
+        size_t rightChildIdx = nodesUsed++;
+        bvhNode[leftChildIdx].leftFirst = node.leftFirst;
+        bvhNode[leftChildIdx].triCount = leftClusters;
+        bvhNode[rightChildIdx].leftFirst = i;
+        bvhNode[rightChildIdx].triCount = node.triCount - leftClusters;
+        node.leftFirst = leftChildIdx;
+        node.triCount = 0;
+
+        for (size_t child : { leftChildIdx, rightChildIdx }) {
+            ViraBLASNode<TSpectral>& childNode = bvhNode[child];
+            for (size_t k = 0; k < childNode.triCount; ++k) {
+                childNode.aabb.grow(clusterBounds[clusterIdx[childNode.leftFirst + k]]);
+            }
+        }
+
+        subdivideClusters(leftChildIdx);
+        subdivideClusters(rightChildIdx);
+    };
+
     template <IsSpectral TSpectral>
     void ViraBLAS<TSpectral>::intersect(Ray<TSpectral, double>& ray)
     {
         ViraBLASNode<TSpectral>* node = &bvhNode[0];
         ViraBLASNode<TSpectral>* stack[64];
         size_t stackPtr = 0;
+        uint64_t nodesVisited = 0;
+        uint64_t triangleTests = 0;
         while (1)
         {
+            nodesVisited++;
             if (node->isLeaf())
             {
+                triangleTests += node->triCount;
                 for (size_t i = 0; i < node->triCount; i++) {
                     auto triIndex = triIdx[node->leftFirst + i];
-                    const vira::geometry::Triangle<TSpectral, double>& tri = this->mesh->getTriangle(triIndex);
-
-                    tri.intersect(ray, triIndex, this->mesh_ptr);
+                    this->mesh->intersectTriangle(ray, triIndex, this->mesh_ptr);
                 }
                 if (stackPtr == 0) {
                     break;
@@ -105,6 +348,10 @@ namespace vira::rendering {
             }
         }
 
+        if (RayCounters* counters = activeRayCounters()) {
+            counters->blas_nodes += nodesVisited;
+            counters->triangle_tests += triangleTests;
+        }
     };
 
     template <IsSpectral TSpectral>
@@ -121,10 +368,10 @@ namespace vira::rendering {
         for (size_t first = node.leftFirst, i = 0; i < node.triCount; i++)
         {
             size_t index = triIdx[first + i];
-            const vira::geometry::Triangle<TSpectral, double>& tri = this->mesh->getTriangle(index);
-            node.aabb.grow(tri.vert[0].position);
-            node.aabb.grow(tri.vert[1].position);
-            node.aabb.grow(tri.vert[2].position);
+            std::array<vec3<double>, 3> positions = this->mesh->getTrianglePositions(index);
+            node.aabb.grow(positions[0]);
+            node.aabb.grow(positions[1]);
+            node.aabb.grow(positions[2]);
         }
     };
 
@@ -150,7 +397,7 @@ namespace vira::rendering {
         size_t i = node.leftFirst;
         size_t j = i + node.triCount - 1;
         while (i <= j) {
-            if (this->mesh->getTriangle(triIdx[i]).centroid[axis] < splitPos) {
+            if (triangleCentroid(triIdx[i])[axis] < splitPos) {
                 i++;
             }
             else {
@@ -202,9 +449,9 @@ namespace vira::rendering {
         double boundsMax = -std::numeric_limits<float>::infinity();
         for (size_t i = 0; i < node.triCount; i++)
         {
-            const vira::geometry::Triangle<TSpectral, double>& tri = this->mesh->getTriangle(triIdx[node.leftFirst + i]);
-            boundsMin = std::min(boundsMin, tri.centroid[a]);
-            boundsMax = std::max(boundsMax, tri.centroid[a]);
+            vec3<double> centroid = triangleCentroid(triIdx[node.leftFirst + i]);
+            boundsMin = std::min(boundsMin, centroid[a]);
+            boundsMax = std::max(boundsMax, centroid[a]);
         }
 
         // Populate the bins
@@ -213,12 +460,13 @@ namespace vira::rendering {
         double scale = BINS / (boundsMax - boundsMin);
         for (size_t i = 0; i < node.triCount; i++) {
             size_t triID = triIdx[node.leftFirst + i];
-            const vira::geometry::Triangle<TSpectral, double>& tri = this->mesh->getTriangle(triID);
-            size_t binIdx = std::min(BINS - 1, static_cast<size_t>((tri.centroid[a] - boundsMin) * scale));
+            std::array<vec3<double>, 3> positions = this->mesh->getTrianglePositions(triID);
+            vec3<double> centroid = double{ 1.f / 3.f } * (positions[0] + positions[1] + positions[2]);
+            size_t binIdx = std::min(BINS - 1, static_cast<size_t>((centroid[a] - boundsMin) * scale));
             bin[binIdx].triCount++;
-            bin[binIdx].bounds.grow(tri.vert[0].position);
-            bin[binIdx].bounds.grow(tri.vert[1].position);
-            bin[binIdx].bounds.grow(tri.vert[2].position);
+            bin[binIdx].bounds.grow(positions[0]);
+            bin[binIdx].bounds.grow(positions[1]);
+            bin[binIdx].bounds.grow(positions[2]);
         }
 
         // Gather data for the planes between the bins
@@ -260,18 +508,19 @@ namespace vira::rendering {
         AABB<TSpectral, double> leftBox, rightBox;
         size_t leftCount = 0, rightCount = 0;
         for (size_t i = 0; i < node.triCount; i++) {
-            const vira::geometry::Triangle<TSpectral, double>& tri = this->mesh->getTriangle(triIdx[node.leftFirst + i]);
-            if (tri.centroid[axis] < pos) {
+            std::array<vec3<double>, 3> positions = this->mesh->getTrianglePositions(triIdx[node.leftFirst + i]);
+            vec3<double> centroid = double{ 1.f / 3.f } * (positions[0] + positions[1] + positions[2]);
+            if (centroid[axis] < pos) {
                 leftCount++;
-                leftBox.grow(tri.vert[0].position);
-                leftBox.grow(tri.vert[1].position);
-                leftBox.grow(tri.vert[2].position);
+                leftBox.grow(positions[0]);
+                leftBox.grow(positions[1]);
+                leftBox.grow(positions[2]);
             }
             else {
                 rightCount++;
-                rightBox.grow(tri.vert[0].position);
-                rightBox.grow(tri.vert[1].position);
-                rightBox.grow(tri.vert[2].position);
+                rightBox.grow(positions[0]);
+                rightBox.grow(positions[1]);
+                rightBox.grow(positions[2]);
             }
         }
         double cost = leftCount * leftBox.area() + rightCount * rightBox.area();
@@ -283,6 +532,13 @@ namespace vira::rendering {
         }
     };
 
+    template <IsSpectral TSpectral>
+    vec3<double> ViraBLAS<TSpectral>::triangleCentroid(size_t index) const
+    {
+        std::array<vec3<double>, 3> positions = this->mesh->getTrianglePositions(index);
+        return double{ 1.f / 3.f } * (positions[0] + positions[1] + positions[2]);
+    };
+
     template <IsSpectral TSpectral>
     double ViraBLAS<TSpectral>::calculateNodeCost(ViraBLASNode<TSpectral>& node)
     {
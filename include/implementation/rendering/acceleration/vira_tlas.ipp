@@ -8,6 +8,7 @@
 #include "vira/constraints.hpp"
 #include "vira/rendering/acceleration/nodes.hpp"
 #include "vira/rendering/ray.hpp"
+#include "vira/rendering/ray_statistics.hpp"
 
 namespace vira::rendering {
     template <IsSpectral TSpectral, IsFloat TMeshFloat>
@@ -26,6 +27,19 @@ namespace vira::rendering {
         delete[] tlasNode;
     };
 
+    /**
+     * @brief Returns the number of bytes allocated for the nodes and leaves
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    size_t ViraTLAS<TSpectral, TMeshFloat>::getMemoryUsage() const
+    {
+        if (tlasNode == nullptr) {
+            return 0;
+        }
+
+        return 2 * leafs.size() * sizeof(ViraTLASNode<TSpectral>) + leafs.capacity() * sizeof(TLASLeaf<TSpectral, double, TMeshFloat>);
+    };
+
     template <IsSpectral TSpectral, IsFloat TMeshFloat>
     void ViraTLAS<TSpectral, TMeshFloat>::build()
     {
@@ -105,8 +119,10 @@ namespace vira::rendering {
         ViraTLASNode<TSpectral>* node = &tlasNode[0];
         ViraTLASNode<TSpectral>* stack[64];
         size_t stackPtr = 0;
+        uint64_t nodesVisited = 0;
 
         while (true) {
+            nodesVisited++;
             if (node->isLeaf()) {
                 leafs[node->leafID].intersect(ray);
                 if (stackPtr == 0) {
@@ -144,5 +160,9 @@ namespace vira::rendering {
                 }
             }
         }
+
+        if (RayCounters* counters = activeRayCounters()) {
+            counters->tlas_nodes += nodesVisited;
+        }
     };
 };
\ No newline at end of file
@@ -1,9 +1,12 @@
 #include <memory>
+#include <array>
 #include <limits>
 #include <random>
 #include <stdexcept>
 #include <iostream>
 #include <chrono>
+#include <atomic>
+#include <cstdint>
 
 #include "tbb/parallel_for.h"
 #include "tbb/blocked_range2d.h"
@@ -19,22 +22,64 @@
 #include "vira/images/image.hpp"
 #include "vira/rendering/acceleration/embree_options.hpp"
 #include "vira/rendering/cpu_denoise.hpp"
+#include "vira/rendering/cpu_rasterizer.hpp"
+#include "vira/rendering/visibility_buffer.hpp"
+#include "vira/rendering/shadow_map.hpp"
+#include "vira/rendering/render_control.hpp"
+#include "vira/rendering/ray_statistics.hpp"
 #include "vira/utils/utils.hpp"
 #include "vira/utils/print_utils.hpp"
+#include "vira/utils/profiler.hpp"
 
 #include "vira/debug.hpp"
 
 namespace vira::rendering {
+    /**
+     * @brief Initializes the camera and builds the acceleration structure, then renders the scene
+     * @param camera The camera to render from
+     * @param scene The Scene to render
+     */
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     void CPUPathTracer<TSpectral, TFloat, TMeshFloat>::render(vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, vira::Scene<TSpectral, TFloat, TMeshFloat>& scene)
     {
-        vira::debug::tbb_debug(); // Only has effect in Debug mode (switches to single threaded)
-
         // Build the acceleration structure:
         camera.initialize();
 
         scene.buildTLAS();
 
+        this->render(static_cast<const vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>&>(camera), static_cast<const vira::Scene<TSpectral, TFloat, TMeshFloat>&>(scene));
+    };
+
+    /**
+     * @brief Renders the scene without modifying the Scene or the camera
+     * @param camera An initialized camera
+     * @param scene A Scene whose acceleration structure has been built
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void CPUPathTracer<TSpectral, TFloat, TMeshFloat>::render(const vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, const vira::Scene<TSpectral, TFloat, TMeshFloat>& scene)
+    {
+        VIRA_PROFILE_ZONE("CPUPathTracer::render");
+
+        vira::debug::tbb_debug(); // Only has effect in Debug mode (switches to single threaded)
+
+        // Resolve primary visibility by rasterization:
+        if (options.raster_primary) {
+            VIRA_PROFILE_ZONE("CPUPathTracer::rasterizePrimary");
+            rasterizePrimaryVisibility(camera, scene);
+        }
+        else {
+            visibility_buffer_.clear();
+        }
+
+        // Update the cached shadow maps of distant lights (these only contain triangles, so shadows are traced if the scene has analytic meshes):
+        if (options.shadow_cache && renderPasses.simulate_lighting && !scene.hasAnalyticMeshes()) {
+            VIRA_PROFILE_ZONE("CPUPathTracer::updateShadowCache");
+            shadow_cache_.update(scene, camera, options.shadow_cache_maps, true, options.shadow_cache_tolerance);
+        }
+        else {
+            shadow_cache_.clear();
+        }
+
         // Begin path tracing:
         std::chrono::high_resolution_clock::time_point start_time;
         std::chrono::high_resolution_clock::time_point stop_time;
@@ -43,7 +88,12 @@ namespace vira::rendering {
             start_time = std::chrono::high_resolution_clock::now();
         }
 
-        renderPasses.initializeImages(camera.getResolution());
+        if (control != nullptr) {
+            control->accessPasses([&] { renderPasses.initializeImages(camera.getResolution()); });
+        }
+        else {
+            renderPasses.initializeImages(camera.getResolution());
+        }
 
         // Initialize:
         vira::images::Resolution resolution = camera.getResolution();
@@ -51,6 +101,7 @@ namespace vira::rendering {
         // Progress tracking seutp:
         const int64_t totalPixels = static_cast<int64_t>(resolution.x) * resolution.y;
         std::atomic<int64_t> processedPixels{ 0 };
+        std::atomic<int64_t> tracedPixels{ 0 };
         std::atomic<int64_t> lastReportedProgress{ 0 };
         const int64_t percentageUpdate = 10;
         const int64_t progressUpdateInterval = std::max(percentageUpdate, totalPixels / percentageUpdate); // Update every 10%
@@ -60,33 +111,79 @@ namespace vira::rendering {
             progressBar = vira::print::makeProgressBar("Rendering");
         }
 
+        if (control != nullptr) {
+            control->begin(static_cast<size_t>(totalPixels));
+        }
+
+        // Ray-tracing statistics (optional):
+        std::unique_ptr<RayStatisticsCollector> statisticsCollector;
+        if (options.collect_statistics) {
+            statisticsCollector = std::make_unique<RayStatisticsCollector>(options.samples);
+        }
+        statistics = RayStatistics{};
+        const auto trace_start = std::chrono::steady_clock::now();
+
         // Begin ray-tracing:
         if (options.tracingType == UNIDIRECTIONAL) {
+            // Seed std::random_device once per render (avoiding entropy pool depletion):
+            const uint32_t render_seed = std::random_device{}();
+
+            VIRA_PROFILE_ZONE("CPUPathTracer::trace");
             tbb::parallel_for(tbb::blocked_range2d<int>(0, resolution.y, 0, resolution.x), [&](const tbb::blocked_range2d<int>& r) {
-                // Initialize RNG once per thread (avoiding using std::random_device because of entropy pool depletion
-                static thread_local std::mt19937 rng = []() {
-                    auto seed = std::hash<std::thread::id>{}(std::this_thread::get_id()) ^ static_cast<size_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
-                    return std::mt19937(static_cast<std::mt19937::result_type>(seed));
-                    }();
+                VIRA_PROFILE_ZONE("CPUPathTracer::traceTile");
+
+                // Each tile owns its RNG, so no generator state is shared between threads or between concurrent renders:
+                std::seed_seq tile_seed{ render_seed, static_cast<uint32_t>(r.rows().begin()), static_cast<uint32_t>(r.cols().begin()) };
+                std::mt19937 rng(tile_seed);
                 std::uniform_real_distribution<float> distribution(0.f, 1.f);
 
                 scene.initializeTLASThreads();
 
+                RayStatisticsCollector::Scope statisticsScope(statisticsCollector.get());
+
                 // Local counter for batch updates
                 int localPixelCount = 0;
                 const int batchSize = 64;
 
-                for (int i = static_cast<int>(r.cols().begin()), i_end = static_cast<int>(r.cols().end()); i < i_end; i++) {
+                size_t controlPixels = 0;
+                size_t controlSamples = 0;
+
+                // A controlled render accumulates the tile locally, so the passes are locked once per tile rather than once per pixel:
+                std::vector<DataPayload<TSpectral, TFloat>> tilePayloads;
+                if (control != nullptr) {
+                    tilePayloads.reserve(r.rows().size() * r.cols().size());
+                }
+
+                bool cancelled = false;
+                for (int i = static_cast<int>(r.cols().begin()), i_end = static_cast<int>(r.cols().end()); i < i_end && !cancelled; i++) {
                     for (int j = static_cast<int>(r.rows().begin()), j_end = static_cast<int>(r.rows().end()); j < j_end; j++) {
+                        if (control != nullptr && control->isCancelled()) {
+                            cancelled = true;
+                            break;
+                        }
+
                         DataPayload<TSpectral, TFloat> dataPayload(i, j);
 
                         // Perform unidirectional (backwards) path tracing:
                         dataPayload.total_radiance = this->unidirectional(camera, scene, dataPayload, rng, distribution);
 
                         vira::debug::check_no_nan(dataPayload.total_radiance, "NaN detected in unidirectional path tracing");
+                        statisticsScope.addPixel(dataPayload.sample);
 
                         // Update additional buffers:
-                        renderPasses.updateImages(dataPayload);
+                        if (control != nullptr) {
+                            tilePayloads.push_back(dataPayload);
+
+                            controlSamples += dataPayload.sample;
+                            if (++controlPixels == static_cast<size_t>(batchSize)) {
+                                control->update(controlPixels, controlSamples);
+                                controlPixels = 0;
+                                controlSamples = 0;
+                            }
+                        }
+                        else {
+                            renderPasses.updateImages(dataPayload);
+                        }
 
                         // Progress tracking:
                         if (vira::getPrintStatus() && progressBar && (++localPixelCount % batchSize == 0)) {
@@ -105,7 +202,21 @@ namespace vira::rendering {
                     }
                 }
 
+                // Write the traced pixels (including those traced before a cancellation):
+                if (control != nullptr && !tilePayloads.empty()) {
+                    tracedPixels.fetch_add(static_cast<int64_t>(tilePayloads.size()), std::memory_order_relaxed);
+                    control->writePixels([&] {
+                        for (const auto& payload : tilePayloads) {
+                            renderPasses.updateImages(payload);
+                        }
+                        });
+                }
+
                 // Handle remaining pixels in the batch
+                if (control != nullptr && controlPixels > 0) {
+                    control->update(controlPixels, controlSamples);
+                }
+
                 if (vira::getPrintStatus() && progressBar && localPixelCount > 0) {
                     int64_t newProcessed = processedPixels.fetch_add(localPixelCount, std::memory_order_relaxed) + localPixelCount;
                     int64_t expected = lastReportedProgress.load();
@@ -121,36 +232,56 @@ namespace vira::rendering {
             throw std::runtime_error("Invalid path tracing type selected");
         }
 
-        if (options.denoise) {
-            vira::images::Image<TSpectral>& albedo = renderPasses.albedo;
-            vira::images::Image<float>& depth = renderPasses.depth;
-            vira::images::Image<TSpectral>& direct = renderPasses.direct_radiance;
-            vira::images::Image<TSpectral>& indirect = renderPasses.indirect_radiance;
-            vira::images::Image<vec3<float>>& normal = renderPasses.normal_global;
+        if (statisticsCollector != nullptr) {
+            double trace_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - trace_start).count();
+            statistics = statisticsCollector->finish(trace_seconds);
+        }
 
-            denoiseSpectralRadianceEATWT<TSpectral>(direct, indirect, albedo, depth, normal, denoiserOptions);
+        // A render cancelled before every pixel was traced keeps its partial passes, but skips the (expensive) denoising and PSF convolution:
+        partial = (control != nullptr) && (tracedPixels.load() < totalPixels);
+        const bool cancelled = partial;
 
-            renderPasses.total_radiance = direct + indirect;
-        }
+        // Post-process the passes (exclusively, so snapshots never observe a partially processed image):
+        auto postProcess = [&]() {
+            if (options.denoise && !cancelled) {
+                VIRA_PROFILE_ZONE("CPUPathTracer::denoise");
+                vira::images::Image<TSpectral>& albedo = renderPasses.albedo;
+                vira::images::Image<float>& depth = renderPasses.depth;
+                vira::images::Image<TSpectral>& direct = renderPasses.direct_radiance;
+                vira::images::Image<TSpectral>& indirect = renderPasses.indirect_radiance;
+                vira::images::Image<vec3<float>>& normal = renderPasses.normal_global;
 
-        // Convert radiance to received power:
-        if (renderPasses.simulate_lighting) {
+                denoiseSpectralRadianceEATWT<TSpectral>(direct, indirect, albedo, depth, normal, denoiserOptions);
 
-            tbb::parallel_for(tbb::blocked_range2d<int>(0, resolution.y, 0, resolution.x), [&](const tbb::blocked_range2d<int>& r) {
-                for (int i = static_cast<int>(r.cols().begin()), i_end = static_cast<int>(r.cols().end()); i < i_end; i++) {
-                    for (int j = static_cast<int>(r.rows().begin()), j_end = static_cast<int>(r.rows().end()); j < j_end; j++) {
-                        renderPasses.received_power(i, j) = camera.calculateReceivedPower(renderPasses.total_radiance(i, j), i, j);
+                renderPasses.total_radiance = direct + indirect;
+            }
+
+            // Convert radiance to received power:
+            if (renderPasses.simulate_lighting) {
+                VIRA_PROFILE_ZONE("CPUPathTracer::receivedPower");
+                tbb::parallel_for(tbb::blocked_range2d<int>(0, resolution.y, 0, resolution.x), [&](const tbb::blocked_range2d<int>& r) {
+                    for (int i = static_cast<int>(r.cols().begin()), i_end = static_cast<int>(r.cols().end()); i < i_end; i++) {
+                        for (int j = static_cast<int>(r.rows().begin()), j_end = static_cast<int>(r.rows().end()); j < j_end; j++) {
+                            renderPasses.received_power(i, j) = camera.calculateReceivedPower(renderPasses.total_radiance(i, j), i, j);
+                        }
                     }
-                }
-                });
-        }
+                    });
+            }
 
-        if (camera.hasPSF()) {
-            // TODO Use maxReceivedPower and minimumPower:
-            TSpectral maxReceivedPower{ 0 };
-            float minimumPower = 0;
-            vira::images::Image<TSpectral> kernel = camera.psf().getKernel(maxReceivedPower, minimumPower);
-            renderPasses.received_power.convolve(kernel, true);
+            if (camera.hasPSF() && !cancelled) {
+                // TODO Use maxReceivedPower and minimumPower:
+                TSpectral maxReceivedPower{ 0 };
+                float minimumPower = 0;
+                vira::images::Image<TSpectral> kernel = camera.psf().getKernel(maxReceivedPower, minimumPower);
+                renderPasses.received_power.convolve(kernel, true);
+            }
+        };
+
+        if (control != nullptr) {
+            control->accessPasses(postProcess);
+        }
+        else {
+            postProcess();
         }
 
         if (vira::getPrintStatus()) {
@@ -158,16 +289,39 @@ namespace vira::rendering {
             auto duration = duration_cast<std::chrono::milliseconds>(stop_time - start_time);
             vira::print::updateProgressBar(progressBar, "Completed (" + std::to_string(duration.count()) + " ms)", 100.0f);
         }
+
+        if (vira::getPrintStatus() && statisticsCollector != nullptr) {
+            std::cout << statistics.format() << std::flush;
+        }
     };
 
 
 
 
+    /**
+     * @brief Copies the render passes, which may belong to a render in progress
+     * @return The passes as currently accumulated.  Pixels not yet traced hold their default values.
+     * @details May be called from any thread (including a progress callback) while render() runs, provided
+     *          a RenderControl is attached.  Without a control, it must not be called during rendering.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    RenderPasses<TSpectral, TFloat> CPUPathTracer<TSpectral, TFloat, TMeshFloat>::snapshotPasses()
+    {
+        if (control == nullptr) {
+            return renderPasses;
+        }
+
+        RenderPasses<TSpectral, TFloat> snapshot;
+        control->accessPasses([&] { snapshot = renderPasses; });
+        return snapshot;
+    };
+
+
     // =================================== //
     // === Path Tracer Implementations === //
     // =================================== //
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
-    TSpectral CPUPathTracer<TSpectral, TFloat, TMeshFloat>::unidirectional(cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, vira::Scene<TSpectral, TFloat, TMeshFloat>& scene,
+    TSpectral CPUPathTracer<TSpectral, TFloat, TMeshFloat>::unidirectional(const cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, const vira::Scene<TSpectral, TFloat, TMeshFloat>& scene,
         DataPayload<TSpectral, TFloat>& dataPayload, std::mt19937& rng, std::uniform_real_distribution<float>& dist)
     {
         float s1 = 0.f;
@@ -242,7 +396,7 @@ namespace vira::rendering {
     };
 
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
-    TSpectral CPUPathTracer<TSpectral, TFloat, TMeshFloat>::simulatePath(cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, vira::Scene<TSpectral, TFloat, TMeshFloat>& scene,
+    TSpectral CPUPathTracer<TSpectral, TFloat, TMeshFloat>::simulatePath(const cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, const vira::Scene<TSpectral, TFloat, TMeshFloat>& scene,
         Ray<TSpectral, TFloat>& ray, DataPayload<TSpectral, TFloat>& dataPayload, std::mt19937& rng, std::uniform_real_distribution<float>& dist)
     {
         const auto& background = scene.getBackgroundEmission();
@@ -250,8 +404,25 @@ namespace vira::rendering {
         TSpectral pathRadiance{ 0 };
         dataPayload.throughput = TSpectral{ 1 };
         for (dataPayload.bounce = 0; dataPayload.bounce < options.bounces + 1; dataPayload.bounce++) {
-            // Perform ray intersection:
-            scene.intersect(ray);
+            // Perform ray intersection (taking primary hits from the visibility buffer when available):
+            bool resolved = false;
+            if (dataPayload.bounce == 0 && !visibility_buffer_.empty()) {
+                resolved = resolvePrimaryHit(ray, dataPayload.i, dataPayload.j);
+            }
+            if (!resolved) {
+                scene.intersect(ray);
+            }
+            if (RayCounters* counters = activeRayCounters()) {
+                if (resolved) {
+                    counters->visibility_hits++;
+                }
+                else if (dataPayload.bounce == 0) {
+                    counters->primary_rays++;
+                }
+                else {
+                    counters->indirect_rays++;
+                }
+            }
 
             if (std::isinf(ray.hit.t)) {
                 if (renderPasses.simulate_lighting && options.show_background) {
@@ -277,7 +448,7 @@ namespace vira::rendering {
     };
 
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
-    TSpectral CPUPathTracer<TSpectral, TFloat, TMeshFloat>::processIntersection(cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, vira::Scene<TSpectral, TFloat, TMeshFloat>& scene,
+    TSpectral CPUPathTracer<TSpectral, TFloat, TMeshFloat>::processIntersection(const cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, const vira::Scene<TSpectral, TFloat, TMeshFloat>& scene,
         Ray<TSpectral, TFloat>& ray, DataPayload<TSpectral, TFloat>& dataPayload, std::mt19937& rng, std::uniform_real_distribution<float>& dist)
     {
         // Extract the Mesh pointer:
@@ -396,7 +567,8 @@ namespace vira::rendering {
             }
 
             // DIRECT LIGHTING (Light Sampling):
-            for (auto& light : lights) {
+            for (size_t light_index = 0; light_index < lights.size(); ++light_index) {
+                auto& light = lights[light_index];
                 Ray<TSpectral, TFloat> sample_ray;
                 float light_pdf = 0;
                 float distance;
@@ -405,10 +577,20 @@ namespace vira::rendering {
                 TSpectral light_radiance = light->sample(intersection_global, sample_ray, distance, light_pdf, rng, dist);
 
                 if (light_pdf > 0) {
-                    // Check for shadows
-                    scene.intersect(sample_ray);
+                    // Check for shadows (using the cached shadow map where it covers the point):
+                    float shadow = 1.f;
+                    if (shadow_cache_.covers(light_index, intersection_global)) {
+                        shadow = shadow_cache_.visibility(light_index, intersection_global, normalize(normal_matrix * ray.hit.face_normal));
+                    }
+                    else {
+                        scene.intersect(sample_ray);
+                        shadow = (sample_ray.hit.t > distance) ? 1.f : 0.f;
+                        if (RayCounters* counters = activeRayCounters()) {
+                            counters->shadow_rays++;
+                        }
+                    }
 
-                    if (sample_ray.hit.t > distance) { // Not in shadow
+                    if (shadow > 0) { // Not in shadow
                         vec3<TFloat> L_global = sample_ray.direction;
 
                         // Evaluate BSDF for this light direction
@@ -422,7 +604,7 @@ namespace vira::rendering {
                         float weight = PowerHeuristic(1, light_pdf, 1, material_pdf);
 
                         // Add contribution
-                        radiance += dataPayload.throughput * bsdfValue * light_radiance * cos_theta * weight / light_pdf;
+                        radiance += shadow * dataPayload.throughput * bsdfValue * light_radiance * cos_theta * weight / light_pdf;
                     }
                 }
             }
@@ -468,6 +650,168 @@ namespace vira::rendering {
         return radiance;
     };
 
+    // ================================= //
+    // === Hybrid Primary Visibility === //
+    // ================================= //
+    /**
+     * @brief Rasterizes the scene into the visibility buffer used to resolve primary hits
+     * @param camera The camera being rendered
+     * @param scene The scene being rendered
+     * @details Backface and normal-cone culling are disabled so that the rasterizer reports the
+     *          same first surface as the ray tracer.  If validate_raster_primary is set, the primary
+     *          ray through every resolved pixel sample location is also traced, and pixels where the
+     *          two disagree are reported and cleared from the visibility buffer (so that they fall
+     *          back to being traced).
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void CPUPathTracer<TSpectral, TFloat, TMeshFloat>::rasterizePrimaryVisibility(const cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, const vira::Scene<TSpectral, TFloat, TMeshFloat>& scene)
+    {
+        CPURasterizerOptions rasterizer_options;
+        rasterizer_options.normal_cone_culling = false;
+        rasterizer_options.backface_culling = false;
+        rasterizer_options.save_visibility = true;
+
+        CPURasterizer<TSpectral, TFloat, TMeshFloat> rasterizer(rasterizer_options);
+        rasterizer.render(camera, scene);
+        visibility_buffer_ = std::move(rasterizer.visibilityBuffer);
+
+        if (!options.validate_raster_primary) {
+            return;
+        }
+
+        vira::images::Resolution resolution = camera.getResolution();
+        std::atomic<size_t> mismatches{ 0 };
+        tbb::parallel_for(tbb::blocked_range2d<int>(0, resolution.y, 0, resolution.x), [&](const tbb::blocked_range2d<int>& r) {
+            scene.initializeTLASThreads();
+
+            size_t local_mismatches = 0;
+            for (int i = static_cast<int>(r.cols().begin()), i_end = static_cast<int>(r.cols().end()); i < i_end; i++) {
+                for (int j = static_cast<int>(r.rows().begin()), j_end = static_cast<int>(r.rows().end()); j < j_end; j++) {
+                    // Unresolved pixels are always traced:
+                    if (visibility_buffer_.isUnresolved(i, j)) {
+                        continue;
+                    }
+
+                    Ray<TSpectral, TFloat> ray = camera.pixelToRay(Pixel(static_cast<float>(i), static_cast<float>(j)));
+                    scene.intersect(ray);
+
+                    auto& sample = visibility_buffer_(i, j);
+                    bool traced_hit = !std::isinf(ray.hit.t);
+                    bool agrees = (traced_hit == sample.hit());
+                    if (agrees && traced_hit) {
+                        agrees = (ray.hit.template getInstancePtr<TMeshFloat>() == sample.instance) && (ray.hit.tri_id == sample.triangle_index);
+                    }
+
+                    if (!agrees) {
+                        sample = VisibilitySample<TSpectral, TFloat, TMeshFloat>{};
+                        local_mismatches++;
+                    }
+                }
+            }
+            mismatches.fetch_add(local_mismatches, std::memory_order_relaxed);
+            });
+
+        if (vira::getPrintStatus()) {
+            size_t total_pixels = static_cast<size_t>(resolution.x) * static_cast<size_t>(resolution.y);
+            float percentage = 100.f * static_cast<float>(mismatches.load()) / static_cast<float>(std::max(total_pixels, size_t{ 1 }));
+            std::cout << vira::print::VIRA_INDENT << "Raster/traced primary visibility mismatches: " << mismatches.load() << " pixels (" << percentage << "%)\n" << std::flush;
+        }
+    };
+
+    /**
+     * @brief Resolves the primary hit of a ray from the visibility buffer
+     * @param ray The primary ray of pixel (i, j), sampled anywhere within [i, i+1) x [j, j+1)
+     * @param i,j The pixel being rendered
+     * @return true if the hit was resolved, false if the ray must be traced
+     * @details The rasterizer samples pixels at their integer coordinates, which are the corners of the region
+     *          a jittered sample is drawn from.  The triangles recorded at those four samples are intersected
+     *          and the nearest hit is kept.  The ray is traced instead if any of the four samples is unresolved,
+     *          saw the background, or lies outside of the image, or if none of the triangles are hit.
+     *
+     *          The result matches the traced hit except where geometry covers part of the pixel without
+     *          covering any of its corner samples (such as sub-pixel triangles).  validate_raster_primary
+     *          measures the disagreement at the pixel sample locations.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    bool CPUPathTracer<TSpectral, TFloat, TMeshFloat>::resolvePrimaryHit(Ray<TSpectral, TFloat>& ray, int i, int j)
+    {
+        vira::images::Resolution resolution = visibility_buffer_.getResolution();
+        if (i + 1 >= resolution.x || j + 1 >= resolution.y) {
+            return false;
+        }
+
+        // Gather the distinct triangles recorded at the corners of the sample region:
+        std::array<const VisibilitySample<TSpectral, TFloat, TMeshFloat>*, 4> candidates{};
+        size_t candidate_count = 0;
+        for (int dj = 0; dj < 2; ++dj) {
+            for (int di = 0; di < 2; ++di) {
+                if (visibility_buffer_.isUnresolved(i + di, j + dj)) {
+                    return false;
+                }
+
+                const auto& sample = visibility_buffer_(i + di, j + dj);
+                if (!sample.hit()) {
+                    return false;
+                }
+
+                bool duplicate = false;
+                for (size_t k = 0; k < candidate_count; ++k) {
+                    if (candidates[k]->instance == sample.instance && candidates[k]->triangle_index == sample.triangle_index) {
+                        duplicate = true;
+                        break;
+                    }
+                }
+                if (!duplicate) {
+                    candidates[candidate_count++] = &sample;
+                }
+            }
+        }
+
+        // Keep the nearest intersection:
+        bool resolved = false;
+        for (size_t k = 0; k < candidate_count; ++k) {
+            Ray<TSpectral, TFloat> candidate_ray = ray;
+            if (intersectVisibility(candidate_ray, *candidates[k]) && candidate_ray.hit.t < ray.hit.t) {
+                ray.hit = candidate_ray.hit;
+                resolved = true;
+            }
+        }
+
+        return resolved;
+    };
+
+    /**
+     * @brief Intersects a ray with the triangle recorded by a visibility buffer sample
+     * @param ray The primary ray of the pixel (in the global frame)
+     * @param sample The rasterized surface visible through the pixel
+     * @return true if the ray intersects the recorded triangle
+     * @details The recorded triangle is intersected exactly (rather than using the image-space
+     *          barycentric coordinates), so the interaction is computed in the same way as one produced
+     *          by tracing the ray through the acceleration structure.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    bool CPUPathTracer<TSpectral, TFloat, TMeshFloat>::intersectVisibility(Ray<TSpectral, TFloat>& ray, const VisibilitySample<TSpectral, TFloat, TMeshFloat>& sample)
+    {
+        // Transform the ray into the local frame of the instance:
+        mat4<TFloat> global_to_local = inverse(sample.instance->getModelMatrix());
+        vec3<TFloat> local_origin = transformPoint(global_to_local, ray.origin);
+        vec3<TFloat> local_direction = transformDirection(global_to_local, ray.direction);
+        TFloat contraction = length(local_direction);
+
+        Ray<TSpectral, TMeshFloat> local_ray(vec3<TMeshFloat>{ local_origin }, vec3<TMeshFloat>{ local_direction / contraction });
+
+        // Intersect the recorded triangle:
+        sample.mesh->intersectTriangle(local_ray, sample.triangle_index, static_cast<void*>(sample.mesh));
+        if (std::isinf(local_ray.hit.t)) {
+            return false;
+        }
+
+        ray.hit = local_ray.hit;
+        ray.hit.t = ray.hit.t / contraction;
+        ray.hit.instance_ptr = sample.instance;
+        return true;
+    };
+
     // TODO Rework with MIS bugs (and consider moving if it is kept)
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     float CPUPathTracer<TSpectral, TFloat, TMeshFloat>::PowerHeuristic(int numf, float fPdf, int numg, float gPdf) {
@@ -1,4 +1,5 @@
 #include <memory>
+#include <array>
 #include <vector>
 #include <algorithm>
 #include <cstddef>
@@ -14,9 +15,14 @@
 #include "vira/cameras/camera.hpp"
 #include "vira/geometry/vertex.hpp"
 #include "vira/geometry/triangle.hpp"
+#include "vira/geometry/triangle_cluster.hpp"
 #include "vira/images/image.hpp"
+#include "vira/rendering/tiled_rasterization.hpp"
+#include "vira/rendering/visibility_buffer.hpp"
+#include "vira/rendering/shadow_map.hpp"
 #include "vira/utils/utils.hpp"
 #include "vira/utils/print_utils.hpp"
+#include "vira/utils/profiler.hpp"
 
 namespace vira::rendering {
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
@@ -26,6 +32,11 @@ namespace vira::rendering {
 
     };
 
+    /**
+     * @brief Initializes the camera and updates the scene graph caches, then rasterizes the Scene
+     * @param camera The camera to render from
+     * @param scene The Scene to render
+     */
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     void CPURasterizer<TSpectral, TFloat, TMeshFloat>::render(vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, vira::Scene<TSpectral, TFloat, TMeshFloat>& scene)
     {
@@ -33,6 +44,19 @@ namespace vira::rendering {
 
         scene.processSceneGraph();
 
+        this->render(static_cast<const vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>&>(camera), static_cast<const vira::Scene<TSpectral, TFloat, TMeshFloat>&>(scene));
+    };
+
+    /**
+     * @brief Rasterizes a Scene without modifying it or the camera
+     * @param camera An initialized camera
+     * @param scene A Scene whose scene graph caches are up to date
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void CPURasterizer<TSpectral, TFloat, TMeshFloat>::render(const vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, const vira::Scene<TSpectral, TFloat, TMeshFloat>& scene)
+    {
+        VIRA_PROFILE_ZONE("CPURasterizer::render");
+
         std::chrono::high_resolution_clock::time_point start_time;
         std::chrono::high_resolution_clock::time_point stop_time;
         if (vira::getPrintStatus()) {
@@ -46,15 +70,52 @@ namespace vira::rendering {
         vira::images::Resolution resolution = camera.getResolution();
         mat4<TFloat> viewMatrix = camera.getViewMatrix();
         mat3<TFloat> cameraNormalMatrix = camera.getViewNormalMatrix();
+        TFloat near_plane = static_cast<TFloat>(options.near_plane);
+
+        // Initialize the hierarchical depth buffer:
+        HierarchicalDepthBuffer* hiz = nullptr;
+        if (options.hierarchical_depth) {
+            hierarchical_depth_.initialize(resolution);
+            hiz = &hierarchical_depth_;
+        }
+
+        // Initialize the visibility buffer:
+        if (options.save_visibility) {
+            visibilityBuffer.initialize(resolution);
+        }
+        else {
+            visibilityBuffer.clear();
+        }
 
         auto& lights = scene.light_cache_;
 
+        // Render the shadow maps (these are reused if nothing affecting them has changed):
+        if (renderPasses.simulate_lighting && options.shadows) {
+            shadow_maps_.update(scene, camera, options.shadow_maps);
+        }
+        else {
+            shadow_maps_.clear();
+        }
+
         // Loop over models in the tile:
         for (const auto& [meshID, meshData] : scene.meshes_) {
             auto& mesh = meshData.mesh;
             bool smoothShading = mesh->getSmoothShading();
 
+            // Mesh-level bounds used for instance culling:
+            vira::rendering::AABB<TSpectral, TFloat> aabb = mesh->getAABB();
+            vec3<TFloat> aabb_center = aabb.center();
+            TFloat aabb_radius = length(aabb.extent()) / 2;
+            bool finite_bounds = std::isfinite(aabb_radius);
+
+            float cone_angle = mesh->getConeAngle();
+            vec3<float> N_cone = mesh->getNormal();
+
             for (auto& instance_data : meshData.instances) {
+                // Skip instances the LoD manager has determined to not be visible:
+                if (!instance_data.visibility) {
+                    continue;
+                }
 
                 // Extract the instance information:
                 vira::scene::Instance<TSpectral, TFloat, TMeshFloat>* instance = instance_data.instance;
@@ -63,92 +124,143 @@ namespace vira::rendering {
 
                 mat4<TFloat> model2camera = viewMatrix * modelMatrix;
 
-                // Loop over material groups in the model:
-                const std::vector<vira::geometry::Triangle<TSpectral, TMeshFloat>>& triangleBuffer = mesh->getTriangles();
+                // Frustum culling:
+                if (options.frustum_culling && finite_bounds && !camera.obbInView(aabb.toOBB(model2camera))) {
+                    continue;
+                }
 
-                // Loop over triangles:
-                size_t triangleID = 0;
-                for (const vira::geometry::Triangle<TSpectral, TMeshFloat>& tri : triangleBuffer) {
-                    triangleID++;
+                // Analytic meshes are not rasterized, so mark the pixels they may cover as needing to be traced:
+                if (mesh->isAnalytic()) {
+                    if (options.save_visibility) {
+                        markUnresolvedBounds(camera, aabb.toOBB(model2camera));
+                    }
+                    continue;
+                }
 
-                    // Check if triangle is valid (TODO this shouldn't be necessary?)
-                    if (std::isinf(tri.vert[0].position[0]) || std::isinf(tri.vert[1].position[0]) || std::isinf(tri.vert[2].position[0])) {
+                // Normal-cone culling (the whole instance faces away from the camera):
+                vec3<TFloat> camera_local = instance->globalToLocal(camera.getGlobalPosition());
+                if (options.normal_cone_culling && length(N_cone) > 0) {
+                    if (vira::geometry::normalConeBackfacing(N_cone, cone_angle, aabb_center, aabb_radius, camera_local)) {
                         continue;
                     }
+                }
+
+                // Loop over material groups in the model:
+                vira::geometry::Triangle<TSpectral, TMeshFloat> scratch; // Triangles of compact meshes are assembled here
+                vec3<TMeshFloat> camera_local_mesh{ camera_local };
 
-                    // Transform points from local model space to camera space:
-                    std::array<vira::geometry::Vertex<TSpectral, TMeshFloat>, 3> vert_camera;
-                    vert_camera[0].position = vira::transformPoint(model2camera, tri.vert[0].position);
-                    vert_camera[1].position = vira::transformPoint(model2camera, tri.vert[1].position);
-                    vert_camera[2].position = vira::transformPoint(model2camera, tri.vert[2].position);
+                const std::vector<uint32_t>& clusterOrder = mesh->getClusterOrder();
 
-                    // Determine if the points are behind the camera:
-                    if (camera.behind(vert_camera[0].position) ||
-                        camera.behind(vert_camera[1].position) ||
-                        camera.behind(vert_camera[2].position)) {
+                // Loop over triangle clusters:
+                for (const vira::geometry::TriangleCluster<TMeshFloat>& cluster : mesh->getClusters()) {
+                    if (options.backface_culling && vira::geometry::normalConeBackfacing(cluster.cone_axis, cluster.cone_angle, cluster.center, cluster.radius, camera_local_mesh)) {
                         continue;
                     }
 
-                    // Project points to image space:
-                    auto p0 = camera.projectCameraPoint(vert_camera[0].position);
-                    auto p1 = camera.projectCameraPoint(vert_camera[1].position);
-                    auto p2 = camera.projectCameraPoint(vert_camera[2].position);
-
-                    // Calculate the search bounds:
-                    int startX_f = static_cast<int>(std::floor(std::min(p0.x, std::min(p1.x, p2.x))));
-                    int startY_f = static_cast<int>(std::floor(std::min(p0.y, std::min(p1.y, p2.y))));
-                    int stopX_f = static_cast<int>(std::ceil(std::max(p0.x, std::max(p1.x, p2.x))));
-                    int stopY_f = static_cast<int>(std::ceil(std::max(p0.y, std::max(p1.y, p2.y))));
-
-                    // Image-space bounds of the triangle are outside of the image:
-                    int resX = resolution.x;
-                    int resY = resolution.y;
-                    if ((stopX_f < 0) ||
-                        (startX_f > resX) ||
-                        (stopY_f < 0) ||
-                        (startY_f > resY)) {
-                        continue;
+                    // Cluster-level frustum culling:
+                    if (options.frustum_culling && std::isfinite(cluster.radius)) {
+                        vec3<TFloat> cluster_center{ cluster.center };
+                        vec3<TFloat> cluster_extent{ static_cast<TFloat>(cluster.radius) };
+                        vira::rendering::AABB<TSpectral, TFloat> cluster_aabb(cluster_center - cluster_extent, cluster_center + cluster_extent);
+                        if (!camera.obbInView(cluster_aabb.toOBB(model2camera))) {
+                            continue;
+                        }
                     }
 
-                    // Clamp bounds to the image space:
-                    int startX = std::clamp(startX_f, 0, resX);
-                    int startY = std::clamp(startY_f, 0, resY);
-                    int stopX = std::clamp(stopX_f, 0, resX);
-                    int stopY = std::clamp(stopY_f, 0, resY);
-
-                    // Calculate the depth:
-                    float d0 = static_cast<float>(length(vert_camera[0].position));
-                    float d1 = static_cast<float>(length(vert_camera[1].position));
-                    float d2 = static_cast<float>(length(vert_camera[2].position));
-
-                    // Calculate size of the triangle:
-                    float area = vira::geometry::edgeFunction(p0, p1, p2);
-                    float e01 = length(p1 - p0);
-                    float e02 = length(p2 - p0);
-                    float e12 = length(p2 - p1);
-                    float triangleSize = std::max(e01, std::max(e02, e12));
-
-                    // Loop over triangle bounds:
-                    for (int X = startX; X < stopX; X++) {
-                        for (int Y = startY; Y < stopY; Y++) {
-
-                            // Barycentric coordinates:
-                            vec2<float> point{ X, Y };
-                            std::array<TMeshFloat, 3> w;
-                            w[0] = vira::geometry::edgeFunction(p1, p2, point) / area;
-                            w[1] = vira::geometry::edgeFunction(p2, p0, point) / area;
-                            w[2] = vira::geometry::edgeFunction(p0, p1, point) / area;
-
-                            // If within a triangle:
-                            if (w[0] >= 0 && w[1] >= 0 && w[2] >= 0) {
-                                float previous_depth = renderPasses.depth(X, Y);
-                                float current_depth = (w[0] * d0) + (w[1] * d1) + (w[2] * d2);
-
-                                // Get the material:
-                                vira::materials::Material<TSpectral>* material = mesh->material_cache_[tri.material_cache_index];
-
-                                if (current_depth < previous_depth) {
-                                    renderPasses.depth(X, Y) = current_depth;
+                    // Loop over triangles:
+                    for (size_t k = cluster.first_triangle; k < cluster.first_triangle + cluster.triangle_count; ++k) {
+                        size_t triangleIndex = clusterOrder[k];
+                        const vira::geometry::Triangle<TSpectral, TMeshFloat>& tri = mesh->getTriangle(triangleIndex, scratch);
+                        size_t triangleID = triangleIndex + 1;
+
+                        // Check if triangle is valid (TODO this shouldn't be necessary?)
+                        if (std::isinf(tri.vert[0].position[0]) || std::isinf(tri.vert[1].position[0]) || std::isinf(tri.vert[2].position[0])) {
+                            continue;
+                        }
+
+                        // Transform points from local model space to camera space:
+                        std::array<vec3<TFloat>, 3> vert_camera;
+                        std::array<TFloat, 3> near_distance;
+                        for (size_t c = 0; c < 3; ++c) {
+                            vert_camera[c] = vira::transformPoint(model2camera, vec3<TFloat>{ tri.vert[c].position });
+                            near_distance[c] = camera.boresightDistance(vert_camera[c]) - near_plane;
+                        }
+
+                        // Clip the triangle against the near plane:
+                        std::array<ClippedVertex<TFloat>, 4> polygon;
+                        size_t polygon_size = clipNearPlane(vert_camera, near_distance, polygon);
+                        if (polygon_size < 3) {
+                            continue;
+                        }
+                        bool clipped = (near_distance[0] < 0) || (near_distance[1] < 0) || (near_distance[2] < 0);
+
+                        // Get the material:
+                        vira::materials::Material<TSpectral>* material = mesh->material_cache_[tri.material_cache_index];
+
+                        // Rasterize the clipped polygon as a triangle fan:
+                        for (size_t fan = 1; fan + 1 < polygon_size; ++fan) {
+                            const std::array<const ClippedVertex<TFloat>*, 3> sub{ &polygon[0], &polygon[fan], &polygon[fan + 1] };
+
+                            // Project points to image space:
+                            auto p0 = camera.projectCameraPoint(sub[0]->position);
+                            auto p1 = camera.projectCameraPoint(sub[1]->position);
+                            auto p2 = camera.projectCameraPoint(sub[2]->position);
+
+                            // Calculate the search bounds (limited first, as vertices near the near plane may project arbitrarily far away):
+                            int resX = resolution.x;
+                            int resY = resolution.y;
+                            float limitX = static_cast<float>(resX + 1);
+                            float limitY = static_cast<float>(resY + 1);
+                            int startX_f = static_cast<int>(std::floor(std::clamp(std::min(p0.x, std::min(p1.x, p2.x)), -1.f, limitX)));
+                            int startY_f = static_cast<int>(std::floor(std::clamp(std::min(p0.y, std::min(p1.y, p2.y)), -1.f, limitY)));
+                            int stopX_f = static_cast<int>(std::ceil(std::clamp(std::max(p0.x, std::max(p1.x, p2.x)), -1.f, limitX)));
+                            int stopY_f = static_cast<int>(std::ceil(std::clamp(std::max(p0.y, std::max(p1.y, p2.y)), -1.f, limitY)));
+
+                            // Image-space bounds of the triangle are outside of the image:
+                            if ((stopX_f < 0) ||
+                                (startX_f > resX) ||
+                                (stopY_f < 0) ||
+                                (startY_f > resY)) {
+                                continue;
+                            }
+
+                            // Clamp bounds to the image space:
+                            int startX = std::clamp(startX_f, 0, resX);
+                            int startY = std::clamp(startY_f, 0, resY);
+                            int stopX = std::clamp(stopX_f, 0, resX);
+                            int stopY = std::clamp(stopY_f, 0, resY);
+
+                            // Calculate the depth:
+                            float d0 = static_cast<float>(length(sub[0]->position));
+                            float d1 = static_cast<float>(length(sub[1]->position));
+                            float d2 = static_cast<float>(length(sub[2]->position));
+
+                            // Calculate size of the triangle:
+                            float e01 = length(p1 - p0);
+                            float e02 = length(p2 - p0);
+                            float e12 = length(p2 - p1);
+                            float triangleSize = std::max(e01, std::max(e02, e12));
+
+                            // Rasterize the triangle over its bounds:
+                            TriangleSetup setup(p0, p1, p2, d0, d1, d2);
+                            rasterizeTriangle(setup, startX, startY, stopX, stopY, renderPasses.depth, hiz, [&](int X, int Y, const std::array<float, 3>& w_sub, float current_depth)
+                                {
+                                    // Barycentric coordinates within the unclipped triangle:
+                                    std::array<float, 3> w_f{ 0, 0, 0 };
+                                    for (size_t v = 0; v < 3; ++v) {
+                                        for (size_t c = 0; c < 3; ++c) {
+                                            w_f[c] += w_sub[v] * sub[v]->w[c];
+                                        }
+                                    }
+
+                                    std::array<TMeshFloat, 3> w{ static_cast<TMeshFloat>(w_f[0]), static_cast<TMeshFloat>(w_f[1]), static_cast<TMeshFloat>(w_f[2]) };
+
+                                    if (options.save_visibility) {
+                                        visibilityBuffer(X, Y) = VisibilitySample<TSpectral, TFloat, TMeshFloat>{ instance, mesh.get(), triangleIndex, w_f };
+                                        if (clipped) {
+                                            visibilityBuffer.markUnresolved(X, Y);
+                                        }
+                                    }
 
                                     // Compute uv-coordinates:
                                     vec2<float> uv =
@@ -204,9 +316,9 @@ namespace vira::rendering {
                                     dataPayload.albedo = albedo;
 
                                     vec3<TFloat> frag_camera =
-                                        w[0] * vert_camera[0].position +
-                                        w[1] * vert_camera[1].position +
-                                        w[2] * vert_camera[2].position;
+                                        static_cast<TFloat>(w[0]) * vert_camera[0] +
+                                        static_cast<TFloat>(w[1]) * vert_camera[1] +
+                                        static_cast<TFloat>(w[2]) * vert_camera[2];
 
                                     vec3<TFloat> frag_global = camera.localToGlobal(frag_camera);
 
@@ -219,10 +331,23 @@ namespace vira::rendering {
 
                                     if (renderPasses.simulate_lighting) {
                                         vec3<float> V_global = normalize(-frag_global);
+                                        vec3<float> N_face = tri.face_normal;
+                                        vec3<float> N_face_global = normalize(normalMatrix * N_face);
 
                                         // Evaluate material:
                                         TSpectral fragRadiance{ 0 };
-                                        for (auto& light : lights) {
+                                        for (size_t lightIndex = 0; lightIndex < lights.size(); ++lightIndex) {
+                                            auto& light = lights[lightIndex];
+
+                                            // Look up the shadowing of the fragment:
+                                            float shadow = 1.f;
+                                            if (shadow_maps_.hasMap(lightIndex)) {
+                                                shadow = shadow_maps_.visibility(lightIndex, frag_global, N_face_global);
+                                                if (shadow == 0) {
+                                                    continue;
+                                                }
+                                            }
+
                                             Ray<TSpectral, TFloat> sample_ray;
                                             float distance;
                                             float lightPDF;
@@ -230,7 +355,7 @@ namespace vira::rendering {
                                             TSpectral radiance = light->sample(frag_global, sample_ray, distance, lightPDF);
                                             vec3<TFloat>& L_global = sample_ray.direction;
                                             TSpectral bsdfValue = material->evaluateBSDF(uv, N_global, L_global, V_global, albedo) / lightPDF;
-                                            fragRadiance += radiance * bsdfValue;
+                                            fragRadiance += shadow * radiance * bsdfValue;
                                         }
 
                                         dataPayload.total_radiance = fragRadiance;
@@ -242,8 +367,7 @@ namespace vira::rendering {
 
                                     // Update additional buffers:
                                     renderPasses.updateImages(dataPayload);
-                                }
-                            }
+                                });
                         }
                     }
                 }
@@ -277,6 +401,51 @@ namespace vira::rendering {
     };
 
 
+    /**
+     * @brief Marks the image-space bounds of a camera-space box as unresolved in the visibility buffer
+     * @param camera The camera being rendered
+     * @param obb The box, in the camera frame
+     * @details Used for geometry which the rasterizer does not draw (analytic meshes).  The bounds of the
+     *          projected corners are padded by a pixel (to cover lens distortion), and the whole image is
+     *          marked if any corner lies behind the near plane.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void CPURasterizer<TSpectral, TFloat, TMeshFloat>::markUnresolvedBounds(const vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, const OBB<TFloat>& obb)
+    {
+        vira::images::Resolution resolution = camera.getResolution();
+        TFloat near_plane = static_cast<TFloat>(options.near_plane);
+
+        float min_x = std::numeric_limits<float>::infinity();
+        float min_y = std::numeric_limits<float>::infinity();
+        float max_x = -std::numeric_limits<float>::infinity();
+        float max_y = -std::numeric_limits<float>::infinity();
+        for (const vec3<TFloat>& corner : obb.getCorners()) {
+            if (camera.boresightDistance(corner) < near_plane) {
+                visibilityBuffer.markUnresolved(0, 0, resolution.x, resolution.y);
+                return;
+            }
+
+            Pixel p = camera.projectCameraPoint(corner);
+            min_x = std::min(min_x, p.x);
+            min_y = std::min(min_y, p.y);
+            max_x = std::max(max_x, p.x);
+            max_y = std::max(max_y, p.y);
+        }
+
+        if (!std::isfinite(min_x) || !std::isfinite(min_y) || !std::isfinite(max_x) || !std::isfinite(max_y)) {
+            visibilityBuffer.markUnresolved(0, 0, resolution.x, resolution.y);
+            return;
+        }
+
+        float limitX = static_cast<float>(resolution.x);
+        float limitY = static_cast<float>(resolution.y);
+        int startX = static_cast<int>(std::floor(std::clamp(min_x, -1.f, limitX))) - 1;
+        int startY = static_cast<int>(std::floor(std::clamp(min_y, -1.f, limitY))) - 1;
+        int stopX = static_cast<int>(std::ceil(std::clamp(max_x, -1.f, limitX))) + 2;
+        int stopY = static_cast<int>(std::ceil(std::clamp(max_y, -1.f, limitY))) + 2;
+        visibilityBuffer.markUnresolved(startX, startY, stopX, stopY);
+    };
+
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     bool CPURasterizer<TSpectral, TFloat, TMeshFloat>::inFrame(Pixel& p, vira::images::Resolution& resolution)
     {
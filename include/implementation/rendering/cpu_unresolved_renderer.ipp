@@ -12,6 +12,7 @@
 #include "vira/unresolved/star_light.hpp"
 #include "vira/images/resolution.hpp"
 #include "vira/images/image.hpp"
+#include "vira/utils/profiler.hpp"
 
 namespace vira::rendering {
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
@@ -21,13 +22,33 @@ namespace vira::rendering {
 
     };
 
+    /**
+     * @brief Updates the scene graph caches and initializes the camera, then renders the unresolved objects
+     * @param camera The camera to render from
+     * @param scene The Scene to render
+     */
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     void CPUUnresolvedRenderer<TSpectral, TFloat, TMeshFloat>::render(vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, vira::Scene<TSpectral, TFloat, TMeshFloat>& scene)
     {
-        vira::debug::tbb_debug(); // Only has effect in Debug mode (switches to single threaded)
-
         scene.processSceneGraph();
 
+        camera.initialize();
+
+        this->render(static_cast<const vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>&>(camera), static_cast<const vira::Scene<TSpectral, TFloat, TMeshFloat>&>(scene));
+    };
+
+    /**
+     * @brief Renders the unresolved objects and stars without modifying the Scene or the camera
+     * @param camera An initialized camera
+     * @param scene A Scene whose scene graph caches are up to date
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void CPUUnresolvedRenderer<TSpectral, TFloat, TMeshFloat>::render(const vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, const vira::Scene<TSpectral, TFloat, TMeshFloat>& scene)
+    {
+        VIRA_PROFILE_ZONE("CPUUnresolvedRenderer::render");
+
+        vira::debug::tbb_debug(); // Only has effect in Debug mode (switches to single threaded)
+
         // Get the stars and unresolved objects:
         const std::vector<vira::unresolved::StarLight<TSpectral, TFloat>>& stars = scene.getStarLight();
 
@@ -40,8 +61,6 @@ namespace vira::rendering {
             return;
         }
 
-        camera.initialize();
-
         // Begin path tracing:
         std::chrono::high_resolution_clock::time_point start_time;
         std::chrono::high_resolution_clock::time_point stop_time;
@@ -178,7 +197,7 @@ namespace vira::rendering {
     };
 
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
-    void CPUUnresolvedRenderer<TSpectral, TFloat, TMeshFloat>::processRegion(const vira::images::ROI& roi, vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, const std::vector<vira::vec3<TFloat>>& vectors, const std::vector<TSpectral>& irradiances, float minimumPower)
+    void CPUUnresolvedRenderer<TSpectral, TFloat, TMeshFloat>::processRegion(const vira::images::ROI& roi, const vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, const std::vector<vira::vec3<TFloat>>& vectors, const std::vector<TSpectral>& irradiances, float minimumPower)
     {
         std::vector<ProjectedPoint<TSpectral>> points = findPointsInRegion(roi, camera, vectors, irradiances, minimumPower);
 
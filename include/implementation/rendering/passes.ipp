@@ -6,6 +6,20 @@
 #include "vira/constraints.hpp"
 
 namespace vira::rendering {
+    /**
+     * @brief Returns the number of bytes held by all of the passes
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat>
+    size_t RenderPasses<TSpectral, TFloat>::getMemoryUsage() const
+    {
+        return depth.getMemoryUsage() + alpha.getMemoryUsage() + albedo.getMemoryUsage()
+            + normal_global.getMemoryUsage() + normal_camera.getMemoryUsage()
+            + instance_id.getMemoryUsage() + mesh_id.getMemoryUsage() + triangle_id.getMemoryUsage() + material_id.getMemoryUsage()
+            + received_power.getMemoryUsage() + total_radiance.getMemoryUsage() + direct_radiance.getMemoryUsage() + indirect_radiance.getMemoryUsage()
+            + velocity_global.getMemoryUsage() + velocity_camera.getMemoryUsage()
+            + triangle_size.getMemoryUsage();
+    };
+
     template <IsSpectral TSpectral, IsFloat TFloat>
     void RenderPasses<TSpectral, TFloat>::resetImages()
     {
@@ -0,0 +1,189 @@
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "tbb/enumerable_thread_specific.h"
+
+namespace vira::rendering {
+    inline RayCounters& RayCounters::operator+=(const RayCounters& other)
+    {
+        primary_rays += other.primary_rays;
+        visibility_hits += other.visibility_hits;
+        shadow_rays += other.shadow_rays;
+        indirect_rays += other.indirect_rays;
+        tlas_nodes += other.tlas_nodes;
+        blas_nodes += other.blas_nodes;
+        triangle_tests += other.triangle_tests;
+        embree_queries += other.embree_queries;
+        return *this;
+    };
+
+    /**
+     * @brief Returns the counters the calling thread should add to, or nullptr if statistics are not being collected
+     */
+    inline RayCounters*& activeRayCounters()
+    {
+        thread_local RayCounters* counters = nullptr;
+        return counters;
+    };
+
+
+
+    // ===================== //
+    // === RayStatistics === //
+    // ===================== //
+    inline double RayStatistics::raysPerSecond() const
+    {
+        return (trace_seconds > 0) ? static_cast<double>(totals.tracedRays()) / trace_seconds : 0;
+    };
+
+    inline double RayStatistics::primaryRaysPerSecond() const
+    {
+        return (trace_seconds > 0) ? static_cast<double>(totals.primary_rays) / trace_seconds : 0;
+    };
+
+    inline double RayStatistics::shadowRaysPerSecond() const
+    {
+        return (trace_seconds > 0) ? static_cast<double>(totals.shadow_rays) / trace_seconds : 0;
+    };
+
+    inline double RayStatistics::indirectRaysPerSecond() const
+    {
+        return (trace_seconds > 0) ? static_cast<double>(totals.indirect_rays) / trace_seconds : 0;
+    };
+
+    /**
+     * @brief Returns the mean number of (software) TLAS and BLAS nodes visited per traced ray
+     */
+    inline double RayStatistics::nodesPerRay() const
+    {
+        uint64_t rays = totals.tracedRays();
+        return (rays > 0) ? static_cast<double>(totals.tlas_nodes + totals.blas_nodes) / static_cast<double>(rays) : 0;
+    };
+
+    /**
+     * @brief Returns the mean number of (software) ray-triangle tests per traced ray
+     */
+    inline double RayStatistics::trianglesPerRay() const
+    {
+        uint64_t rays = totals.tracedRays();
+        return (rays > 0) ? static_cast<double>(totals.triangle_tests) / static_cast<double>(rays) : 0;
+    };
+
+    inline double RayStatistics::meanSamplesPerPixel() const
+    {
+        uint64_t samples = 0;
+        for (size_t n = 0; n < spp_histogram.size(); ++n) {
+            samples += n * spp_histogram[n];
+        }
+        return (pixels > 0) ? static_cast<double>(samples) / static_cast<double>(pixels) : 0;
+    };
+
+    /**
+     * @brief Formats the statistics as a human readable report
+     */
+    inline std::string RayStatistics::format() const
+    {
+        std::ostringstream ss;
+        ss << std::fixed << std::setprecision(2);
+
+        ss << "Trace time:        " << trace_seconds * 1000 << " ms\n";
+        ss << "Primary rays:      " << totals.primary_rays << " (" << primaryRaysPerSecond() / 1e6 << " Mrays/s)\n";
+        if (totals.visibility_hits > 0) {
+            ss << "Visibility hits:   " << totals.visibility_hits << "\n";
+        }
+        ss << "Shadow rays:       " << totals.shadow_rays << " (" << shadowRaysPerSecond() / 1e6 << " Mrays/s)\n";
+        ss << "Indirect rays:     " << totals.indirect_rays << " (" << indirectRaysPerSecond() / 1e6 << " Mrays/s)\n";
+        ss << "Total:             " << totals.tracedRays() << " (" << raysPerSecond() / 1e6 << " Mrays/s)\n";
+
+        if (totals.embree_queries > 0) {
+            ss << "Embree queries:    " << totals.embree_queries << "\n";
+        }
+        if (totals.tlas_nodes + totals.blas_nodes > 0) {
+            ss << "Nodes per ray:     " << nodesPerRay() << " (TLAS " << totals.tlas_nodes << ", BLAS " << totals.blas_nodes << ")\n";
+            ss << "Triangles per ray: " << trianglesPerRay() << "\n";
+        }
+
+        ss << "Mean spp:          " << meanSamplesPerPixel() << "\n";
+        ss << "spp histogram:\n";
+        for (size_t n = 0; n < spp_histogram.size(); ++n) {
+            if (spp_histogram[n] > 0) {
+                ss << "    " << std::setw(6) << n << ": " << spp_histogram[n] << "\n";
+            }
+        }
+
+        return ss.str();
+    };
+
+
+
+    // ============================== //
+    // === RayStatisticsCollector === //
+    // ============================== //
+    /**
+     * @brief Constructs an empty collector
+     * @param max_samples Largest number of samples a pixel may take (the size of the spp histogram, minus one)
+     */
+    inline RayStatisticsCollector::RayStatisticsCollector(size_t max_samples) :
+        max_samples_{ max_samples },
+        local_{ [max_samples]() { return LocalStatistics{ RayCounters{}, std::vector<uint64_t>(max_samples + 1, 0) }; } }
+    {
+    };
+
+    /**
+     * @brief Combines the statistics recorded by every thread
+     * @param trace_seconds Wall-clock duration of the traced stage
+     */
+    inline RayStatistics RayStatisticsCollector::finish(double trace_seconds)
+    {
+        RayStatistics statistics;
+        statistics.trace_seconds = trace_seconds;
+        statistics.spp_histogram.assign(max_samples_ + 1, 0);
+
+        for (const LocalStatistics& local : local_) {
+            statistics.totals += local.counters;
+            for (size_t n = 0; n < local.spp_histogram.size(); ++n) {
+                statistics.spp_histogram[n] += local.spp_histogram[n];
+                statistics.pixels += local.spp_histogram[n];
+            }
+        }
+
+        return statistics;
+    };
+
+    /**
+     * @brief Directs the calling thread's ray counters to the collector until the scope ends
+     * @param collector The collector to record to (if nullptr, the scope has no effect)
+     */
+    inline RayStatisticsCollector::Scope::Scope(RayStatisticsCollector* collector)
+    {
+        if (collector != nullptr) {
+            LocalStatistics& local = collector->local_.local();
+            previous_ = activeRayCounters();
+            histogram_ = &local.spp_histogram;
+            activeRayCounters() = &local.counters;
+        }
+    };
+
+    inline RayStatisticsCollector::Scope::~Scope()
+    {
+        if (histogram_ != nullptr) {
+            activeRayCounters() = previous_;
+        }
+    };
+
+    /**
+     * @brief Records the number of samples taken by a completed pixel
+     */
+    inline void RayStatisticsCollector::Scope::addPixel(size_t samples)
+    {
+        if (histogram_ != nullptr) {
+            size_t bin = std::min(samples, histogram_->size() - 1);
+            (*histogram_)[bin]++;
+        }
+    };
+};
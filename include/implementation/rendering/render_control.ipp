@@ -0,0 +1,118 @@
+#include <cstddef>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <utility>
+
+#include "tbb/spin_rw_mutex.h"
+
+namespace vira::rendering {
+    /**
+     * @brief Clears a pending cancellation and the recorded progress
+     * @details Must not be called while a render using this control is in progress.
+     */
+    inline void RenderControl::reset()
+    {
+        cancelled_.store(false, std::memory_order_relaxed);
+        pixels_done_.store(0, std::memory_order_relaxed);
+        samples_done_.store(0, std::memory_order_relaxed);
+        total_pixels_.store(0, std::memory_order_relaxed);
+        next_report_.store(0, std::memory_order_relaxed);
+    };
+
+    /**
+     * @brief Sets a function to be called as a render progresses
+     * @param callback Function receiving the current progress
+     * @param interval Fraction of the image completed between calls
+     * @details The callback is invoked from the renderer's worker threads, but never by two threads at
+     *          once.  It should return quickly, as the calling thread stops tracing while it runs.  The
+     *          callback may call cancel().
+     *          Must not be called while a render using this control is in progress.
+     */
+    inline void RenderControl::setProgressCallback(ProgressCallback callback, float interval)
+    {
+        callback_ = std::move(callback);
+        interval_ = std::clamp(interval, 0.f, 1.f);
+    };
+
+    /**
+     * @brief Returns the progress of the current (or most recent) render
+     */
+    inline RenderProgress RenderControl::getProgress() const
+    {
+        RenderProgress progress;
+        progress.pixels_done = pixels_done_.load(std::memory_order_relaxed);
+        progress.total_pixels = total_pixels_.load(std::memory_order_relaxed);
+        progress.samples_done = samples_done_.load(std::memory_order_relaxed);
+        return progress;
+    };
+
+    /**
+     * @brief Resets the progress at the start of a render
+     * @param total_pixels Number of pixels that will be rendered
+     */
+    inline void RenderControl::begin(size_t total_pixels)
+    {
+        pixels_done_.store(0, std::memory_order_relaxed);
+        samples_done_.store(0, std::memory_order_relaxed);
+        total_pixels_.store(total_pixels, std::memory_order_relaxed);
+        next_report_.store(0, std::memory_order_relaxed);
+    };
+
+    /**
+     * @brief Records completed work, and invokes the progress callback if an interval has elapsed
+     * @param pixels Number of newly completed pixels
+     * @param samples Number of samples traced for those pixels
+     * @details Renderers should call this in batches, rather than once per pixel.
+     */
+    inline void RenderControl::update(size_t pixels, size_t samples)
+    {
+        size_t done = pixels_done_.fetch_add(pixels, std::memory_order_relaxed) + pixels;
+        samples_done_.fetch_add(samples, std::memory_order_relaxed);
+
+        if (!callback_) {
+            return;
+        }
+
+        size_t total = total_pixels_.load(std::memory_order_relaxed);
+        size_t step = std::max<size_t>(1, static_cast<size_t>(interval_ * static_cast<float>(total)));
+
+        // The final update is always reported:
+        if (done < total) {
+            size_t next = next_report_.load(std::memory_order_relaxed);
+            if (done < next) {
+                return;
+            }
+            if (!next_report_.compare_exchange_strong(next, done + step, std::memory_order_relaxed)) {
+                return; // Another thread is reporting this interval
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(callback_mutex_);
+        callback_(this->getProgress());
+    };
+
+    /**
+     * @brief Executes a function writing pixels of the render passes
+     * @param f Function to execute
+     * @details Any number of threads may write (disjoint pixels) at once, while accessPasses() waits for them.
+     */
+    template <typename F>
+    void RenderControl::writePixels(F&& f)
+    {
+        tbb::spin_rw_mutex::scoped_lock lock(passes_mutex_, false);
+        f();
+    };
+
+    /**
+     * @brief Executes a function with exclusive access to the render passes
+     * @param f Function to execute
+     * @details Used for (re)allocating the passes, and for taking consistent snapshots of a render in progress.
+     */
+    template <typename F>
+    void RenderControl::accessPasses(F&& f)
+    {
+        tbb::spin_rw_mutex::scoped_lock lock(passes_mutex_, true);
+        f();
+    };
+};
@@ -0,0 +1,579 @@
+#include <array>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <tuple>
+
+#include "vira/math.hpp"
+#include "vira/vec.hpp"
+#include "vira/constraints.hpp"
+#include "vira/images/image.hpp"
+#include "vira/images/resolution.hpp"
+#include "vira/cameras/camera.hpp"
+#include "vira/geometry/triangle.hpp"
+#include "vira/rendering/acceleration/aabb.hpp"
+#include "vira/rendering/tiled_rasterization.hpp"
+
+namespace vira::rendering {
+    /**
+     * @brief Configures the light-space projection and clears the depth map
+     * @param light_position Global position of the light
+     * @param center Global center of the bounding sphere of the shadow receiving geometry
+     * @param radius Radius of the bounding sphere of the shadow receiving geometry
+     * @param resolution Width (and height) of the depth map in texels
+     * @param orthographic Use an orthographic (directional) projection rather than a perspective one
+     * @details A perspective map cannot be constructed for a light inside of the bounding sphere, in which
+     *          case the map is marked invalid and all points are treated as being lit.
+     */
+    template <IsFloat TFloat>
+    void ShadowMap<TFloat>::initialize(const vec3<TFloat>& light_position, const vec3<TFloat>& center, TFloat radius, int resolution, bool orthographic)
+    {
+        resolution_ = resolution;
+        orthographic_ = orthographic;
+        center_ = center;
+        radius_ = radius;
+
+        vec3<TFloat> light_to_center = center - light_position;
+        TFloat distance = length(light_to_center);
+
+        valid_ = (resolution > 0) && std::isfinite(radius) && (radius > 0) && (distance > 0);
+        if (!orthographic && distance <= radius) {
+            valid_ = false;
+        }
+        if (!valid_) {
+            depth_ = vira::images::Image<float>{};
+            return;
+        }
+
+        // Construct the light-space basis:
+        w_ = light_to_center / distance;
+        vec3<TFloat> arbitrary = (std::abs(w_[0]) < TFloat{ 0.9 }) ? vec3<TFloat>(1, 0, 0) : vec3<TFloat>(0, 1, 0);
+        u_ = normalize(cross(arbitrary, w_));
+        v_ = cross(w_, u_);
+
+        if (orthographic_) {
+            origin_ = center - radius * w_;
+        }
+        else {
+            origin_ = light_position;
+            tan_half_angle_ = std::tan(std::asin(radius / distance));
+        }
+
+        vira::images::Resolution map_resolution(resolution, resolution);
+        depth_ = vira::images::Image<float>(map_resolution, std::numeric_limits<float>::infinity());
+        hierarchical_depth_.initialize(map_resolution);
+    };
+
+    /**
+     * @brief Projects a global point into the depth map
+     * @param point Global position
+     * @param[out] pixel Texel coordinates of the point
+     * @param[out] depth Light-space depth of the point
+     * @return false if the point cannot be projected (i.e. it is behind a perspective light)
+     */
+    template <IsFloat TFloat>
+    bool ShadowMap<TFloat>::project(const vec3<TFloat>& point, Pixel& pixel, float& depth) const
+    {
+        TFloat half_resolution = static_cast<TFloat>(resolution_) / 2;
+        if (orthographic_) {
+            vec3<TFloat> offset = point - center_;
+            pixel.x = static_cast<float>((dot(offset, u_) / radius_ + 1) * half_resolution);
+            pixel.y = static_cast<float>((dot(offset, v_) / radius_ + 1) * half_resolution);
+            depth = static_cast<float>(dot(point - origin_, w_));
+            return true;
+        }
+
+        vec3<TFloat> offset = point - origin_;
+        TFloat z = dot(offset, w_);
+        if (z <= 0) {
+            return false;
+        }
+
+        TFloat scale = 1 / (z * tan_half_angle_);
+        pixel.x = static_cast<float>((dot(offset, u_) * scale + 1) * half_resolution);
+        pixel.y = static_cast<float>((dot(offset, v_) * scale + 1) * half_resolution);
+        depth = static_cast<float>(length(offset));
+        return true;
+    };
+
+    /**
+     * @brief Computes the world-space footprint of a single texel at the given depth
+     */
+    template <IsFloat TFloat>
+    float ShadowMap<TFloat>::texelSize(float depth) const
+    {
+        if (orthographic_) {
+            return static_cast<float>(2 * radius_) / static_cast<float>(resolution_);
+        }
+        return 2.f * depth * static_cast<float>(tan_half_angle_) / static_cast<float>(resolution_);
+    };
+
+    /**
+     * @brief Writes the depth of a global-space triangle into the depth map
+     * @param points Global positions of the triangle vertices
+     */
+    template <IsFloat TFloat>
+    void ShadowMap<TFloat>::rasterize(const std::array<vec3<TFloat>, 3>& points)
+    {
+        if (!valid_) {
+            return;
+        }
+
+        std::array<Pixel, 3> p;
+        std::array<float, 3> d;
+        for (size_t k = 0; k < 3; ++k) {
+            if (!project(points[k], p[k], d[k])) {
+                return;
+            }
+        }
+
+        // Calculate the search bounds:
+        int startX = static_cast<int>(std::floor(std::min(p[0].x, std::min(p[1].x, p[2].x))));
+        int startY = static_cast<int>(std::floor(std::min(p[0].y, std::min(p[1].y, p[2].y))));
+        int stopX = static_cast<int>(std::ceil(std::max(p[0].x, std::max(p[1].x, p[2].x))));
+        int stopY = static_cast<int>(std::ceil(std::max(p[0].y, std::max(p[1].y, p[2].y))));
+        if (stopX < 0 || startX > resolution_ || stopY < 0 || startY > resolution_) {
+            return;
+        }
+
+        startX = std::clamp(startX, 0, resolution_);
+        startY = std::clamp(startY, 0, resolution_);
+        stopX = std::clamp(stopX, 0, resolution_);
+        stopY = std::clamp(stopY, 0, resolution_);
+
+        TriangleSetup setup(p[0], p[1], p[2], d[0], d[1], d[2]);
+        rasterizeTriangle(setup, startX, startY, stopX, stopY, depth_, &hierarchical_depth_, [](int, int, const std::array<float, 3>&, float) {});
+    };
+
+    /**
+     * @brief Computes the fraction of a point which is visible to the light
+     * @param point Global position of the shading point
+     * @param normal Global geometric normal of the surface at the shading point
+     * @param pcf_radius Half-width of the PCF kernel in texels (0 performs a single comparison)
+     * @param bias Normal offset and depth tolerance, in texels
+     * @return Visibility in [0,1], where 1 is fully lit
+     * @details The lookup point is offset along the surface normal by the bias to avoid self-shadowing
+     *          ("shadow acne") on surfaces at grazing angles to the light.  Points outside of the map are lit.
+     */
+    template <IsFloat TFloat>
+    float ShadowMap<TFloat>::visibility(const vec3<TFloat>& point, const vec3<float>& normal, int pcf_radius, float bias) const
+    {
+        if (!valid_) {
+            return 1.f;
+        }
+        pcf_radius = std::max(pcf_radius, 0);
+
+        Pixel pixel;
+        float depth;
+        if (!project(point, pixel, depth)) {
+            return 1.f;
+        }
+
+        float offset = bias * texelSize(depth);
+        vec3<TFloat> lookup_point = point + static_cast<TFloat>(offset) * vec3<TFloat>{ normal };
+        if (!project(lookup_point, pixel, depth)) {
+            return 1.f;
+        }
+        float tolerance = bias * texelSize(depth);
+
+        int X = static_cast<int>(std::lround(pixel.x));
+        int Y = static_cast<int>(std::lround(pixel.y));
+
+        size_t lit = 0;
+        size_t total = 0;
+        for (int dy = -pcf_radius; dy <= pcf_radius; ++dy) {
+            for (int dx = -pcf_radius; dx <= pcf_radius; ++dx) {
+                int x = X + dx;
+                int y = Y + dy;
+                total++;
+                if (x < 0 || y < 0 || x >= resolution_ || y >= resolution_) {
+                    lit++;
+                }
+                else if (depth - tolerance <= depth_(x, y)) {
+                    lit++;
+                }
+            }
+        }
+
+        return static_cast<float>(lit) / static_cast<float>(total);
+    };
+
+    /**
+     * @brief Checks if a point lies within the region covered by the depth map
+     * @param point Global position
+     * @return false if the map is invalid, or the point projects outside of it
+     */
+    template <IsFloat TFloat>
+    bool ShadowMap<TFloat>::covers(const vec3<TFloat>& point) const
+    {
+        if (!valid_) {
+            return false;
+        }
+
+        Pixel pixel;
+        float depth;
+        if (!project(point, pixel, depth)) {
+            return false;
+        }
+
+        float size = static_cast<float>(resolution_);
+        return (pixel.x >= 0) && (pixel.y >= 0) && (pixel.x < size) && (pixel.y < size);
+    };
+
+
+    // ========================= //
+    // === Scene Shadow Maps === //
+    // ========================= //
+    /**
+     * @brief Re-renders the shadow maps if they are no longer valid for the scene and view
+     * @param scene The scene to be shadowed
+     * @param camera The camera whose view the maps are fitted to (must be initialized)
+     * @param options The shadow map options
+     * @param distant_only Only render maps for distant (orthographic) lights
+     * @param tolerance Change in the direction of a distant light (degrees) below which its map is reused
+     * @return true if the shadow maps were re-rendered
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    bool SceneShadowMaps<TSpectral, TFloat, TMeshFloat>::update(const vira::Scene<TSpectral, TFloat, TMeshFloat>& scene, const vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera,
+        const ShadowMapOptions& options, bool distant_only, float tolerance)
+    {
+        auto& lights = scene.light_cache_;
+
+        bool rebuild = (maps_.size() != lights.size()) ||
+            (distant_only != distant_only_) ||
+            (options.resolution != options_.resolution) ||
+            (options.distant_light_ratio != options_.distant_light_ratio) ||
+            (options.receiver_margin != options_.receiver_margin) ||
+            castersChanged(collectCasters(scene), static_cast<TFloat>(options.caster_tolerance) * texel_size_);
+
+        // The receivers in view must remain inside of the maps, which should not be much larger than needed:
+        vec3<TFloat> receiver_center{ 0 };
+        TFloat receiver_radius = 0;
+        if (!rebuild && computeReceiverBounds(scene, camera, receiver_center, receiver_radius)) {
+            TFloat reach = length(receiver_center - center_) + receiver_radius;
+            rebuild = (radius_ <= 0) || (reach > radius_) || (2 * (1 + static_cast<TFloat>(options.receiver_margin)) * receiver_radius < radius_);
+        }
+
+        TFloat distant_radius = static_cast<TFloat>(options.distant_light_ratio) * radius_;
+        for (size_t lightIndex = 0; !rebuild && lightIndex < lights.size(); ++lightIndex) {
+            vec3<TFloat> light_position = lights[lightIndex]->getGlobalPosition();
+            bool distant = length(light_position - center_) > distant_radius;
+            const ShadowMap<TFloat>& map = maps_[lightIndex];
+
+            if (map.isValid() && map.isOrthographic()) {
+                // Distant lights only invalidate their map when their direction changes:
+                vec3<TFloat> direction = normalize(center_ - light_position);
+                TFloat cos_angle = std::clamp(dot(direction, map.getDirection()), TFloat{ -1 }, TFloat{ 1 });
+                rebuild = !distant || (RAD2DEG<TFloat>() * std::acos(cos_angle) > static_cast<TFloat>(tolerance));
+            }
+            else if (distant_only_) {
+                rebuild = distant;
+            }
+            else {
+                rebuild = (light_position != light_positions_[lightIndex]);
+            }
+        }
+
+        options_.pcf_radius = options.pcf_radius;
+        options_.bias = options.bias;
+        options_.caster_tolerance = options.caster_tolerance;
+
+        if (rebuild) {
+            build(scene, camera, options, distant_only);
+        }
+        return rebuild;
+    };
+
+    /**
+     * @brief Renders a shadow map for every light in the scene
+     * @param scene The scene to be shadowed
+     * @param camera The camera whose view the maps are fitted to (must be initialized)
+     * @param options The shadow map options
+     * @param distant_only Only render maps for distant (orthographic) lights
+     * @details Each map covers the bounding sphere of the receivers in view, and every shadow casting instance
+     *          (including those outside of the camera view) whose bounds overlap a map is rasterized into it.
+     *          Lights far from the receivers (relative to their bounding radius) use an orthographic projection,
+     *          while nearby lights use a perspective projection.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void SceneShadowMaps<TSpectral, TFloat, TMeshFloat>::build(const vira::Scene<TSpectral, TFloat, TMeshFloat>& scene, const vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera,
+        const ShadowMapOptions& options, bool distant_only)
+    {
+        auto& lights = scene.light_cache_;
+
+        options_ = options;
+        distant_only_ = distant_only;
+        casters_ = collectCasters(scene);
+        texel_size_ = 0;
+        maps_.assign(lights.size(), ShadowMap<TFloat>{});
+        light_positions_.assign(lights.size(), vec3<TFloat>{ 0 });
+
+        auto castsShadow = [](const auto& instance_data) { return instance_data.visibility || instance_data.casting_shadow; };
+        auto validTriangle = [](const std::array<vec3<TMeshFloat>, 3>& positions) {
+            return !(std::isinf(positions[0][0]) || std::isinf(positions[1][0]) || std::isinf(positions[2][0]));
+            };
+
+        // Fit the maps to the receivers in view:
+        center_ = vec3<TFloat>{ 0 };
+        radius_ = 0;
+        if (!computeReceiverBounds(scene, camera, center_, radius_)) {
+            radius_ = 0;
+            return;
+        }
+        radius_ *= (1 + static_cast<TFloat>(options.receiver_margin));
+
+        // Configure the light projections:
+        bool any_valid = false;
+        for (size_t lightIndex = 0; lightIndex < lights.size(); ++lightIndex) {
+            vec3<TFloat> light_position = lights[lightIndex]->getGlobalPosition();
+            light_positions_[lightIndex] = light_position;
+
+            bool orthographic = length(light_position - center_) > static_cast<TFloat>(options.distant_light_ratio) * radius_;
+            if (distant_only && !orthographic) {
+                continue;
+            }
+
+            ShadowMap<TFloat>& map = maps_[lightIndex];
+            map.initialize(light_position, center_, radius_, options.resolution, orthographic);
+            if (map.isValid()) {
+                // Casters are compared against the finest texel of any map:
+                TFloat texel_size = static_cast<TFloat>(map.texelSize(static_cast<float>(length(center_ - light_position))));
+                texel_size_ = any_valid ? std::min(texel_size_, texel_size) : texel_size;
+                any_valid = true;
+            }
+        }
+        if (!any_valid) {
+            return;
+        }
+
+        // Rasterize the shadow casting geometry into each map:
+        std::vector<ShadowMap<TFloat>*> overlapping;
+        for (const auto& [meshID, meshData] : scene.meshes_) {
+            auto& mesh = meshData.mesh;
+            vira::rendering::AABB<TSpectral, TFloat> mesh_aabb = mesh->getAABB();
+            bool finite_bounds = std::isfinite(length(mesh_aabb.extent()));
+
+            for (const auto& instance_data : meshData.instances) {
+                if (!castsShadow(instance_data)) {
+                    continue;
+                }
+
+                mat4<TFloat> modelMatrix = instance_data.instance->getModelMatrix();
+
+                // Skip maps which the (orthographic) footprint of the instance does not overlap:
+                overlapping.clear();
+                vira::rendering::AABB<TSpectral, TFloat> instance_aabb = mesh_aabb.applyTransformation(modelMatrix);
+                vec3<TFloat> instance_center = instance_aabb.center();
+                TFloat instance_radius = length(instance_aabb.extent()) / 2;
+                for (auto& map : maps_) {
+                    if (!map.isValid()) {
+                        continue;
+                    }
+                    if (finite_bounds && map.isOrthographic()) {
+                        vec3<TFloat> offset = instance_center - center_;
+                        vec3<TFloat> along = dot(offset, map.getDirection()) * map.getDirection();
+                        if (length(offset - along) > radius_ + instance_radius) {
+                            continue;
+                        }
+                    }
+                    overlapping.push_back(&map);
+                }
+                if (overlapping.empty()) {
+                    continue;
+                }
+
+                for (size_t t = 0; t < mesh->getNumTriangles(); ++t) {
+                    std::array<vec3<TMeshFloat>, 3> positions = mesh->getTrianglePositions(t);
+                    if (!validTriangle(positions)) {
+                        continue;
+                    }
+
+                    std::array<vec3<TFloat>, 3> points{
+                        vira::transformPoint(modelMatrix, vec3<TFloat>{ positions[0] }),
+                        vira::transformPoint(modelMatrix, vec3<TFloat>{ positions[1] }),
+                        vira::transformPoint(modelMatrix, vec3<TFloat>{ positions[2] })
+                    };
+
+                    for (ShadowMap<TFloat>* map : overlapping) {
+                        map->rasterize(points);
+                    }
+                }
+            }
+        }
+    };
+
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void SceneShadowMaps<TSpectral, TFloat, TMeshFloat>::clear()
+    {
+        maps_.clear();
+        light_positions_.clear();
+        casters_.clear();
+        texel_size_ = 0;
+    };
+
+    /**
+     * @brief Checks if a point is covered by the shadow map of a light
+     * @param light_index Index of the light (in the scene light cache)
+     * @param point Global position of the shading point
+     * @return false if the light has no shadow map, or the point lies outside of it
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    bool SceneShadowMaps<TSpectral, TFloat, TMeshFloat>::covers(size_t light_index, const vec3<TFloat>& point) const
+    {
+        return hasMap(light_index) && maps_[light_index].covers(point);
+    };
+
+    /**
+     * @brief Computes the fraction of a point which is visible to a light
+     * @param light_index Index of the light (in the scene light cache)
+     * @param point Global position of the shading point
+     * @param normal Global geometric normal of the surface at the shading point
+     * @return Visibility in [0,1], where 1 is fully lit (or the light has no shadow map)
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    float SceneShadowMaps<TSpectral, TFloat, TMeshFloat>::visibility(size_t light_index, const vec3<TFloat>& point, const vec3<float>& normal) const
+    {
+        if (!hasMap(light_index)) {
+            return 1.f;
+        }
+        return maps_[light_index].visibility(point, normal, options_.pcf_radius, options_.bias);
+    };
+
+    /**
+     * @brief Records the state of every shadow casting instance, ordered by mesh and instance ID
+     * @details Analytic meshes are not drawn into the maps, and so are not recorded.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    std::vector<typename SceneShadowMaps<TSpectral, TFloat, TMeshFloat>::ShadowCaster> SceneShadowMaps<TSpectral, TFloat, TMeshFloat>::collectCasters(const vira::Scene<TSpectral, TFloat, TMeshFloat>& scene) const
+    {
+        std::vector<ShadowCaster> casters;
+        for (const auto& [meshID, meshData] : scene.meshes_) {
+            auto& mesh = meshData.mesh;
+            if (mesh->isAnalytic()) {
+                continue;
+            }
+
+            vira::rendering::AABB<TSpectral, TFloat> mesh_aabb = mesh->getAABB();
+            vec3<TFloat> furthest = glm::max(abs(mesh_aabb.min()), abs(mesh_aabb.max()));
+
+            for (const auto& instance_data : meshData.instances) {
+                if (!(instance_data.visibility || instance_data.casting_shadow)) {
+                    continue;
+                }
+
+                ShadowCaster caster;
+                caster.mesh_id = static_cast<uint64_t>(meshID.id());
+                caster.instance_id = static_cast<uint64_t>(instance_data.instance->getID().id());
+                caster.gsd = mesh->getGSD();
+                caster.triangle_count = mesh->getNumTriangles();
+                caster.radius = length(furthest);
+                caster.transformation = instance_data.instance->getModelMatrix();
+                casters.push_back(caster);
+            }
+        }
+
+        std::sort(casters.begin(), casters.end(), [](const ShadowCaster& a, const ShadowCaster& b) {
+            return std::tie(a.mesh_id, a.instance_id) < std::tie(b.mesh_id, b.instance_id);
+            });
+        return casters;
+    };
+
+    /**
+     * @brief Checks if the shadow casters have changed since the maps were rendered
+     * @param casters The current shadow casters (as returned by collectCasters())
+     * @param tolerance Displacement (meters) of a caster below which it is considered unchanged
+     * @return true if a caster was added, removed, changed mesh or LoD level, or moved by more than the tolerance
+     * @details The displacement of any point of a caster is bounded by the change in translation plus the
+     *          (Frobenius) norm of the change in the linear part of its transformation, scaled by the radius of
+     *          its mesh.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    bool SceneShadowMaps<TSpectral, TFloat, TMeshFloat>::castersChanged(const std::vector<ShadowCaster>& casters, TFloat tolerance) const
+    {
+        if (casters.size() != casters_.size()) {
+            return true;
+        }
+
+        for (size_t i = 0; i < casters.size(); ++i) {
+            const ShadowCaster& current = casters[i];
+            const ShadowCaster& rendered = casters_[i];
+            if (current.mesh_id != rendered.mesh_id || current.instance_id != rendered.instance_id ||
+                current.gsd != rendered.gsd || current.triangle_count != rendered.triangle_count) {
+                return true;
+            }
+
+            vec3<TFloat> translation_change{ current.transformation[3] - rendered.transformation[3] };
+            TFloat linear_change = 0;
+            for (int col = 0; col < 3; ++col) {
+                for (int row = 0; row < 3; ++row) {
+                    TFloat delta = current.transformation[col][row] - rendered.transformation[col][row];
+                    linear_change += delta * delta;
+                }
+            }
+
+            TFloat displacement = length(translation_change);
+            if (linear_change > 0) {
+                displacement += std::sqrt(linear_change) * current.radius;
+            }
+            if (!(displacement <= tolerance)) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    /**
+     * @brief Computes the bounding sphere of the shadow receivers in view of a camera
+     * @param scene The scene to be shadowed
+     * @param camera The camera (must be initialized)
+     * @param[out] center Global center of the bounding sphere
+     * @param[out] radius Radius of the bounding sphere
+     * @return false if no receivers are in view
+     * @details Receivers are the instances marked visible whose bounds intersect the view frustum.  Meshes with
+     *          no-data vertices have non-finite bounds, and are bounded by their valid vertices instead.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    bool SceneShadowMaps<TSpectral, TFloat, TMeshFloat>::computeReceiverBounds(const vira::Scene<TSpectral, TFloat, TMeshFloat>& scene, const vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera,
+        vec3<TFloat>& center, TFloat& radius) const
+    {
+        mat4<TFloat> viewMatrix = camera.getViewMatrix();
+
+        vira::rendering::AABB<TSpectral, TFloat> receiver_aabb;
+        for (const auto& [meshID, meshData] : scene.meshes_) {
+            auto& mesh = meshData.mesh;
+            vira::rendering::AABB<TSpectral, TFloat> mesh_aabb = mesh->getAABB();
+            if (!std::isfinite(length(mesh_aabb.extent()))) {
+                mesh_aabb = vira::rendering::AABB<TSpectral, TFloat>{};
+                for (size_t t = 0; t < mesh->getNumTriangles(); ++t) {
+                    for (const auto& position : mesh->getTrianglePositions(t)) {
+                        if (!std::isinf(position[0])) {
+                            mesh_aabb.grow(vec3<TFloat>{ position });
+                        }
+                    }
+                }
+                if (!std::isfinite(length(mesh_aabb.extent()))) {
+                    continue;
+                }
+            }
+
+            for (const auto& instance_data : meshData.instances) {
+                if (!instance_data.visibility) {
+                    continue;
+                }
+
+                mat4<TFloat> modelMatrix = instance_data.instance->getModelMatrix();
+                if (!camera.obbInView(mesh_aabb.toOBB(viewMatrix * modelMatrix))) {
+                    continue;
+                }
+                receiver_aabb.grow(mesh_aabb.applyTransformation(modelMatrix));
+            }
+        }
+
+        center = receiver_aabb.center();
+        radius = length(receiver_aabb.extent()) / 2;
+        return std::isfinite(radius) && (radius > 0);
+    };
+};
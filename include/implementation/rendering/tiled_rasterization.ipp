@@ -0,0 +1,234 @@
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "vira/vec.hpp"
+#include "vira/constraints.hpp"
+#include "vira/images/image.hpp"
+#include "vira/images/resolution.hpp"
+
+namespace vira::rendering {
+    // ====================== //
+    // === Triangle Setup === //
+    // ====================== //
+    inline TriangleSetup::TriangleSetup(const Pixel& p0, const Pixel& p1, const Pixel& p2, float d0, float d1, float d2)
+    {
+        float area = (p2.x - p0.x) * (p1.y - p0.y) - (p2.y - p0.y) * (p1.x - p0.x);
+        if (area == 0 || !std::isfinite(area)) {
+            degenerate = true;
+            return;
+        }
+        float inv_area = 1.f / area;
+
+        // Edge i is opposite to vertex i (matching the barycentric ordering of edgeFunction):
+        const std::array<Pixel, 3> a{ p1, p2, p0 };
+        const std::array<Pixel, 3> b{ p2, p0, p1 };
+        for (size_t i = 0; i < 3; ++i) {
+            A[i] = (b[i].y - a[i].y) * inv_area;
+            B[i] = -(b[i].x - a[i].x) * inv_area;
+            C[i] = (a[i].y * (b[i].x - a[i].x) - a[i].x * (b[i].y - a[i].y)) * inv_area;
+        }
+
+        depth = { d0, d1, d2 };
+        min_depth = std::min(d0, std::min(d1, d2));
+    };
+
+
+    // ================================= //
+    // === Hierarchical Depth Buffer === //
+    // ================================= //
+    inline void HierarchicalDepthBuffer::initialize(vira::images::Resolution resolution)
+    {
+        resolution_ = resolution;
+        blocks_x_ = (resolution.x + RASTER_BLOCK_SIZE - 1) / RASTER_BLOCK_SIZE;
+        blocks_y_ = (resolution.y + RASTER_BLOCK_SIZE - 1) / RASTER_BLOCK_SIZE;
+        max_depth_.assign(static_cast<size_t>(blocks_x_ * blocks_y_), std::numeric_limits<float>::infinity());
+    };
+
+    inline void HierarchicalDepthBuffer::update(const vira::images::Image<float>& depth, int bx, int by)
+    {
+        int x0 = bx * RASTER_BLOCK_SIZE;
+        int y0 = by * RASTER_BLOCK_SIZE;
+        int x1 = std::min(x0 + RASTER_BLOCK_SIZE, resolution_.x);
+        int y1 = std::min(y0 + RASTER_BLOCK_SIZE, resolution_.y);
+
+        float max_depth = 0;
+        for (int Y = y0; Y < y1; ++Y) {
+            for (int X = x0; X < x1; ++X) {
+                max_depth = std::max(max_depth, depth(X, Y));
+            }
+        }
+        max_depth_[static_cast<size_t>(by * blocks_x_ + bx)] = max_depth;
+    };
+
+
+    // =========================== //
+    // === Near-Plane Clipping === //
+    // =========================== //
+    /**
+     * @brief Clips a camera-space triangle against the near plane
+     * @param positions Camera-space positions of the triangle vertices
+     * @param distances Signed distance of each vertex in front of the near plane
+     * @param[out] polygon Vertices of the clipped polygon, in the winding order of the triangle
+     * @return Number of vertices in the clipped polygon (0 if the triangle is entirely clipped, otherwise 3 or 4)
+     *
+     * @details Each output vertex records its barycentric coordinates within the unclipped triangle, so that
+     *          fragments of the clipped polygon can be mapped back to the original vertex attributes.  A four
+     *          vertex polygon is rasterized as the fan (0, 1, 2), (0, 2, 3).
+     */
+    template <IsFloat TFloat>
+    size_t clipNearPlane(const std::array<vec3<TFloat>, 3>& positions, const std::array<TFloat, 3>& distances, std::array<ClippedVertex<TFloat>, 4>& polygon)
+    {
+        size_t count = 0;
+        for (size_t k = 0; k < 3; ++k) {
+            size_t next = (k + 1) % 3;
+            bool inside = distances[k] >= 0;
+            bool next_inside = distances[next] >= 0;
+
+            if (inside) {
+                polygon[count].position = positions[k];
+                polygon[count].w = { 0, 0, 0 };
+                polygon[count].w[k] = 1;
+                count++;
+            }
+
+            // The edge crosses the near plane:
+            if (inside != next_inside) {
+                TFloat s = distances[k] / (distances[k] - distances[next]);
+                polygon[count].position = positions[k] + s * (positions[next] - positions[k]);
+                polygon[count].w = { 0, 0, 0 };
+                polygon[count].w[k] = static_cast<float>(1 - s);
+                polygon[count].w[next] = static_cast<float>(s);
+                count++;
+            }
+        }
+
+        return count;
+    };
+
+
+    // ============================== //
+    // === Triangle Rasterization === //
+    // ============================== //
+    /**
+     * @brief Rasterizes a triangle using coarse block traversal and 8-wide edge evaluation
+     * @param setup Pre-computed edge functions and vertex depths of the triangle
+     * @param startX,startY,stopX,stopY Clamped image-space bounds of the triangle
+     * @param depth Depth image to test against and write to
+     * @param hiz Optional hierarchical depth buffer (may be nullptr)
+     * @param fragment Callable invoked as fragment(X, Y, w, depth) for every fragment passing the depth test
+     *
+     * @details Blocks which lie fully outside of any edge, or fully behind the hierarchical depth buffer,
+     *          are rejected without per-pixel work.  Blocks which lie fully inside all three edges skip the
+     *          per-pixel coverage test.  Within a block, each row is evaluated as RASTER_BLOCK_SIZE lanes
+     *          which are laid out for compiler auto-vectorization.
+     */
+    template <typename TFragmentFunction>
+    void rasterizeTriangle(const TriangleSetup& setup, int startX, int startY, int stopX, int stopY,
+        vira::images::Image<float>& depth, HierarchicalDepthBuffer* hiz, TFragmentFunction&& fragment)
+    {
+        if (setup.degenerate || stopX <= startX || stopY <= startY) {
+            return;
+        }
+
+        // Per-lane offsets of the edge functions (constant for the whole triangle):
+        std::array<std::array<float, RASTER_BLOCK_SIZE>, 3> lane_offset;
+        for (size_t e = 0; e < 3; ++e) {
+            for (int k = 0; k < RASTER_BLOCK_SIZE; ++k) {
+                lane_offset[e][static_cast<size_t>(k)] = setup.A[e] * static_cast<float>(k);
+            }
+        }
+
+        int bx_start = startX / RASTER_BLOCK_SIZE;
+        int by_start = startY / RASTER_BLOCK_SIZE;
+        int bx_stop = (stopX - 1) / RASTER_BLOCK_SIZE;
+        int by_stop = (stopY - 1) / RASTER_BLOCK_SIZE;
+
+        for (int by = by_start; by <= by_stop; ++by) {
+            int y0 = std::max(by * RASTER_BLOCK_SIZE, startY);
+            int y1 = std::min(by * RASTER_BLOCK_SIZE + RASTER_BLOCK_SIZE, stopY);
+
+            for (int bx = bx_start; bx <= bx_stop; ++bx) {
+                int x0 = std::max(bx * RASTER_BLOCK_SIZE, startX);
+                int x1 = std::min(bx * RASTER_BLOCK_SIZE + RASTER_BLOCK_SIZE, stopX);
+
+                // Early depth rejection:
+                if (hiz != nullptr && setup.min_depth >= hiz->getMaxDepth(bx, by)) {
+                    continue;
+                }
+
+                // Classify the block against each edge using its corner samples:
+                float fx0 = static_cast<float>(x0);
+                float fy0 = static_cast<float>(y0);
+                float fx1 = static_cast<float>(x1 - 1);
+                float fy1 = static_cast<float>(y1 - 1);
+
+                bool reject = false;
+                bool accept = true;
+                for (size_t e = 0; e < 3; ++e) {
+                    float c00 = setup.evaluate(e, fx0, fy0);
+                    float c10 = setup.evaluate(e, fx1, fy0);
+                    float c01 = setup.evaluate(e, fx0, fy1);
+                    float c11 = setup.evaluate(e, fx1, fy1);
+
+                    float max_corner = std::max(std::max(c00, c10), std::max(c01, c11));
+                    float min_corner = std::min(std::min(c00, c10), std::min(c01, c11));
+                    if (max_corner < 0) {
+                        reject = true;
+                        break;
+                    }
+                    if (min_corner < 0) {
+                        accept = false;
+                    }
+                }
+                if (reject) {
+                    continue;
+                }
+
+                // Evaluate the block row-by-row with incremental stepping:
+                std::array<float, 3> row_start{ setup.evaluate(0, fx0, fy0), setup.evaluate(1, fx0, fy0), setup.evaluate(2, fx0, fy0) };
+                int lanes = x1 - x0;
+                bool written = false;
+
+                for (int Y = y0; Y < y1; ++Y) {
+                    std::array<float, RASTER_BLOCK_SIZE> w0;
+                    std::array<float, RASTER_BLOCK_SIZE> w1;
+                    std::array<float, RASTER_BLOCK_SIZE> w2;
+                    std::array<float, RASTER_BLOCK_SIZE> z;
+                    for (size_t k = 0; k < static_cast<size_t>(RASTER_BLOCK_SIZE); ++k) {
+                        w0[k] = row_start[0] + lane_offset[0][k];
+                        w1[k] = row_start[1] + lane_offset[1][k];
+                        w2[k] = row_start[2] + lane_offset[2][k];
+                        z[k] = w0[k] * setup.depth[0] + w1[k] * setup.depth[1] + w2[k] * setup.depth[2];
+                    }
+
+                    for (int k = 0; k < lanes; ++k) {
+                        size_t lane = static_cast<size_t>(k);
+                        if (!accept && (w0[lane] < 0 || w1[lane] < 0 || w2[lane] < 0)) {
+                            continue;
+                        }
+
+                        int X = x0 + k;
+                        float& previous_depth = depth(X, Y);
+                        if (z[lane] < previous_depth) {
+                            previous_depth = z[lane];
+                            fragment(X, Y, std::array<float, 3>{ w0[lane], w1[lane], w2[lane] }, z[lane]);
+                            written = true;
+                        }
+                    }
+
+                    row_start[0] += setup.B[0];
+                    row_start[1] += setup.B[1];
+                    row_start[2] += setup.B[2];
+                }
+
+                if (written && hiz != nullptr) {
+                    hiz->update(depth, bx, by);
+                }
+            }
+        }
+    };
+};
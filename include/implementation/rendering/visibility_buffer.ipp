@@ -0,0 +1,37 @@
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "vira/constraints.hpp"
+#include "vira/images/resolution.hpp"
+
+namespace vira::rendering {
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void VisibilityBuffer<TSpectral, TFloat, TMeshFloat>::initialize(vira::images::Resolution resolution)
+    {
+        resolution_ = resolution;
+        samples_.assign(static_cast<size_t>(resolution.x) * static_cast<size_t>(resolution.y), VisibilitySample<TSpectral, TFloat, TMeshFloat>{});
+        unresolved_.assign(samples_.size(), 0);
+    };
+
+    /**
+     * @brief Marks a rectangular region of pixels as unresolved
+     * @param startX,startY First pixel of the region (inclusive)
+     * @param stopX,stopY Last pixel of the region (exclusive)
+     * @details The region is clamped to the image.  Marks are never cleared by later samples, so a
+     *          region may be marked conservatively without knowing what else covers it.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void VisibilityBuffer<TSpectral, TFloat, TMeshFloat>::markUnresolved(int startX, int startY, int stopX, int stopY)
+    {
+        startX = std::clamp(startX, 0, resolution_.x);
+        startY = std::clamp(startY, 0, resolution_.y);
+        stopX = std::clamp(stopX, 0, resolution_.x);
+        stopY = std::clamp(stopY, 0, resolution_.y);
+
+        for (int j = startY; j < stopY; ++j) {
+            std::fill(unresolved_.begin() + (j * resolution_.x + startX), unresolved_.begin() + (j * resolution_.x + stopX), uint8_t{ 1 });
+        }
+    };
+};
@@ -964,7 +964,7 @@ namespace vira::vulkan {
         // == Index Buffer ==
 
         // Create buffer and allocate and bind memory
-        const IndexBuffer indexBuffer = mesh.getIndexBuffer();
+        const IndexBuffer indexBuffer = mesh.getIndices();
         uint32_t indexCount = static_cast<uint32_t>(mesh.getIndexCount());
         vk::MemoryPropertyFlags indexProperties = blasVertexProperties;
         vk::BufferUsageFlags indexUsage =   vk::BufferUsageFlagBits::eIndexBuffer | 
@@ -1115,11 +1115,11 @@ namespace vira::vulkan {
             
             // Retrieve mesh and mesh index buffer
             Mesh<TSpectral, TFloat, TMeshFloat>& mesh = *scene->getMeshes()[meshIndex];
-            IndexBuffer indexBuffer = mesh.getIndexBuffer();
+            IndexBuffer indexBuffer = mesh.getIndices();
 
             // Add indices and offsets
             indexOffsets.push_back(static_cast<uint32_t>(indexBuffer.size()));
-            indexVecs.push_back(mesh.getIndexBuffer());
+            indexVecs.push_back(mesh.getIndices());
 
             // Retrieve Mesh
             const std::vector<Pose<TFloat>>& meshGPs = scene->getMeshGlobalPoses()[meshIndex];
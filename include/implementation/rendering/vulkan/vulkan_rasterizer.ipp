@@ -289,7 +289,7 @@ namespace vira::vulkan {
         // =======================
 
         // Create Buffer
-        const IndexBuffer indexBuffer = mesh.getIndexBuffer();
+        const IndexBuffer indexBuffer = mesh.getIndices();
         
         // Set usage, size, and properties of Index Buffer
         uint32_t indexCount = static_cast<uint32_t>(mesh.getIndexCount());
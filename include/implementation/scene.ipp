@@ -1,7 +1,13 @@
 #include <memory>
+#include <vector>
+#include <unordered_set>
+#include <algorithm>
+#include <utility>
 #include <stdexcept>
 #include <filesystem>
 #include <chrono>
+#include <cstdint>
+#include <mutex>
 
 #include "embree3/rtcore.h"
 #ifdef _WIN32
@@ -37,6 +43,7 @@
 #include "vira/rendering/cpu_unresolved_renderer.hpp"
 
 #include "vira/utils/hash_utils.hpp"
+#include "vira/utils/profiler.hpp"
 
 namespace fs = std::filesystem;
 
@@ -89,10 +96,12 @@ namespace vira {
 
         for (auto& [meshID, meshData] : meshes_) {
             meshData.mesh->deviceFreed();
+            meshData.embree_bytes = 0;
         }
         if (rtc_device_ != nullptr) {
             rtcReleaseDevice(rtc_device_);
             rtc_device_ = nullptr;
+            embree_memory_.reset();
         }
     };
 
@@ -103,6 +112,37 @@ namespace vira {
         this->geometryInterface->saveGroup(group, filepath, format);
     };
 
+    /**
+     * @brief Writes a binary snapshot of the entire scene
+     * @param filepath Path of the snapshot file to write
+     * @param options Options controlling which precomputed data (BVHs, camera tables) is stored
+     *
+     * @see vira::quipu::SceneSnapshot
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void Scene<TSpectral, TFloat, TMeshFloat>::saveSnapshot(const fs::path& filepath, quipu::SceneSnapshotOptions options)
+    {
+        VIRA_PROFILE_ZONE("Scene::saveSnapshot");
+
+        quipu::SceneSnapshot<TSpectral, TFloat, TMeshFloat>::write(filepath, *this, options);
+    };
+
+    /**
+     * @brief Loads a binary snapshot (written with saveSnapshot()) into the scene
+     * @param filepath Path of the snapshot file
+     *
+     * @see vira::quipu::SceneSnapshot
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void Scene<TSpectral, TFloat, TMeshFloat>::loadSnapshot(const fs::path& filepath)
+    {
+        VIRA_PROFILE_ZONE("Scene::loadSnapshot");
+
+        this->concurrency_.execute([&] {
+            quipu::SceneSnapshot<TSpectral, TFloat, TMeshFloat>::load(filepath, *this);
+        });
+    };
+
 
     // ======================= //
     // === SPICE Interface === //
@@ -125,7 +165,66 @@ namespace vira {
     {
         this->ephemeris_time_ = newET;
 
-        this->updateSPICE(ephemeris_time_);
+        if (rebuild_frame_hierarchy_) {
+            buildFrameHierarchy();
+        }
+
+        frame_hierarchy_.updateSPICE(ephemeris_time_);
+        for (uint32_t index : frame_hierarchy_.getUpdatedFrames()) {
+            if (frame_instances_[index] != nullptr) {
+                this->markMoved(frame_instances_[index]);
+            }
+        }
+        this->is_modified_ = true;
+    };
+
+    /**
+     * @brief Flattens the scene graph into the ReferenceFrameHierarchy used by setSpiceET()
+     *
+     * @details The hierarchy is rebuilt lazily, only after nodes have been added, removed, or moved between
+     *          Groups.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void Scene<TSpectral, TFloat, TMeshFloat>::buildFrameHierarchy()
+    {
+        frame_hierarchy_.clear();
+        frame_instances_.clear();
+
+        frame_hierarchy_.addFrame(this);
+        frame_instances_.push_back(nullptr);
+
+        // Breadth-first traversal, so that parents always precede their children:
+        std::vector<std::pair<const GROUP*, uint32_t>> current_level{ { this, 0 } };
+        std::vector<std::pair<const GROUP*, uint32_t>> next_level;
+        while (!current_level.empty()) {
+            next_level.clear();
+            for (const auto& [group, group_index] : current_level) {
+                for (const auto& [camera_id, camera_entry] : group->cameras_) {
+                    frame_hierarchy_.addFrame(camera_entry.data.get(), group_index);
+                    frame_instances_.push_back(nullptr);
+                }
+                for (const auto& [instance_id, instance_entry] : group->instances_) {
+                    frame_hierarchy_.addFrame(instance_entry.data.get(), group_index);
+                    frame_instances_.push_back(instance_entry.data.get());
+                }
+                for (const auto& [light_id, light_entry] : group->lights_) {
+                    frame_hierarchy_.addFrame(light_entry.data.get(), group_index);
+                    frame_instances_.push_back(nullptr);
+                }
+                for (const auto& [unresolved_id, unresolved_entry] : group->unresolved_objects_) {
+                    frame_hierarchy_.addFrame(unresolved_entry.data.get(), group_index);
+                    frame_instances_.push_back(nullptr);
+                }
+                for (const auto& [group_id, child_group] : group->groups_) {
+                    uint32_t child_index = frame_hierarchy_.addFrame(child_group.data.get(), group_index);
+                    frame_instances_.push_back(nullptr);
+                    next_level.emplace_back(child_group.data.get(), child_index);
+                }
+            }
+            std::swap(current_level, next_level);
+        }
+
+        rebuild_frame_hierarchy_ = false;
     };
 
 
@@ -480,6 +579,28 @@ namespace vira {
         }
     };
 
+    /**
+     * @brief Adds a mesh represented by an analytic ellipsoid
+     * @param ellipsoid The ellipsoid, defined in the local frame of the mesh
+     * @param materialID The material to apply to the ellipsoid
+     * @param name Optional name of the mesh
+     * @return The ID of the new mesh
+     *
+     * @details Analytic meshes are intersected in closed form by both the Vira and Embree acceleration
+     *          structures, which is far cheaper than a tessellated sphere for distant bodies.  They are
+     *          instanced like any other mesh, but contain no triangles, so are not drawn by rasterizers.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    MeshID Scene<TSpectral, TFloat, TMeshFloat>::addEllipsoidMesh(geometry::AnalyticEllipsoid<TSpectral, TMeshFloat> ellipsoid, const MaterialID& materialID, std::string name)
+    {
+        auto newMesh = std::make_unique<MESH>(ellipsoid);
+
+        MeshID meshID = addMesh(std::move(newMesh), name);
+        (*this)[meshID].setMaterial(0, materialID);
+
+        return meshID;
+    };
+
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     bool Scene<TSpectral, TFloat, TMeshFloat>::removeMesh(const MeshID& meshID)
     {
@@ -512,6 +633,23 @@ namespace vira {
         return meshes_.find(meshID) != meshes_.end();
     }
 
+    /**
+     * @brief Checks if any instanced mesh is an analytic primitive
+     * @return true if an instance of an analytic mesh exists
+     * @details Rasterization based techniques (visibility buffers and shadow maps) only draw triangles,
+     *          so renderers use this to fall back to ray tracing where analytic geometry may be present.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    bool Scene<TSpectral, TFloat, TMeshFloat>::hasAnalyticMeshes() const
+    {
+        for (const auto& [meshID, meshData] : meshes_) {
+            if (meshData.mesh->isAnalytic() && !meshData.instances.empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
 
 
     // ===================== //
@@ -519,7 +657,11 @@ namespace vira {
     // ===================== //
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     geometry::LoadedMeshes<TFloat> Scene<TSpectral, TFloat, TMeshFloat>::loadGeometry(const fs::path& filepath, std::string format) {
-        return geometryInterface->load(*this, filepath, format);
+        VIRA_PROFILE_ZONE("Scene::loadGeometry");
+
+        return this->concurrency_.execute([&] {
+            return geometryInterface->load(*this, filepath, format);
+        });
     }
 
 
@@ -529,49 +671,67 @@ namespace vira {
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     void Scene<TSpectral, TFloat, TMeshFloat>::processSceneGraph()
     {
-        if (this->is_dirty_) {
-            std::chrono::high_resolution_clock::time_point start_time;
-            std::chrono::high_resolution_clock::time_point stop_time;
-            if (vira::getPrintStatus()) {
-                start_time = std::chrono::high_resolution_clock::now();
-                std::cout << "Pre-processing Scene Graph...\n" << std::flush;
-            }
+        VIRA_PROFILE_ZONE("Scene::processSceneGraph");
 
-            this->light_cache_.clear();
-            this->unresolved_cache_.clear();
+        std::lock_guard<std::recursive_mutex> lock(graph_mutex_);
 
-            // Reset instance cache and update material cache:
-            for (auto& [meshID, meshData] : meshes_) {
-                meshData.instances.clear();
+        this->concurrency_.execute([&] {
+            if (this->is_dirty_) {
+                std::chrono::high_resolution_clock::time_point start_time;
+                std::chrono::high_resolution_clock::time_point stop_time;
+                if (vira::getPrintStatus()) {
+                    start_time = std::chrono::high_resolution_clock::now();
+                    std::cout << "Pre-processing Scene Graph...\n" << std::flush;
+                }
 
-                for (size_t i = 0; i < meshData.mesh->materialIDs_.size(); ++i) {
-                    if (hasMaterial(meshData.mesh->materialIDs_[i])) {
-                        meshData.mesh->material_cache_[i] = materials_.at(meshData.mesh->materialIDs_[i]).data.get();
-                    }
-                    else {
-                        meshData.mesh->materialIDs_[i] = defaultMaterialID;
-                        meshData.mesh->material_cache_[i] = materials_.at(defaultMaterialID).data.get();
+                this->light_cache_.clear();
+                this->unresolved_cache_.clear();
+
+                // Reset instance cache and update material cache:
+                for (auto& [meshID, meshData] : meshes_) {
+                    meshData.instances.clear();
+
+                    for (size_t i = 0; i < meshData.mesh->materialIDs_.size(); ++i) {
+                        if (hasMaterial(meshData.mesh->materialIDs_[i])) {
+                            meshData.mesh->material_cache_[i] = materials_.at(meshData.mesh->materialIDs_[i]).data.get();
+                        }
+                        else {
+                            meshData.mesh->materialIDs_[i] = defaultMaterialID;
+                            meshData.mesh->material_cache_[i] = materials_.at(defaultMaterialID).data.get();
+                        }
                     }
                 }
-            }
 
-            // Check that SPICE Configuration is valid:
-            if (this->isConfiguredSpiceObject() && !this->isConfiguredSpiceFrame()) {
-                throw std::runtime_error("If using SPICE, Scene must be a fully defined Frame (Must provide both NAIF ID and FrameName)");
-            }
+                // Check that SPICE Configuration is valid:
+                if (this->isConfiguredSpiceObject() && !this->isConfiguredSpiceFrame()) {
+                    throw std::runtime_error("If using SPICE, Scene must be a fully defined Frame (Must provide both NAIF ID and FrameName)");
+                }
 
-            // Start traversal from the root (Scene) with identity transformState
-            recursivelyPopulateCaches(this);
+                // Start traversal from the root (Scene) with identity transformState
+                recursivelyPopulateCaches(this);
 
-            this->is_dirty_ = false;
-            rebuildTLAS = true;
+                this->is_dirty_ = false;
+                rebuildTLAS = true;
 
-            if (vira::getPrintStatus()) {
-                stop_time = std::chrono::high_resolution_clock::now();
-                auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(stop_time - start_time);
-                std::cout << vira::print::VIRA_INDENT << "Completed (" << duration.count() << " ms)\n" << std::flush;
+                // Individual changes are subsumed by the full rebuild:
+                this->moved_instances_.clear();
+                this->changed_instances_.clear();
+
+                if (vira::getPrintStatus()) {
+                    stop_time = std::chrono::high_resolution_clock::now();
+                    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(stop_time - start_time);
+                    std::cout << vira::print::VIRA_INDENT << "Completed (" << duration.count() << " ms)\n" << std::flush;
+                }
             }
-        }
+            else if (!this->moved_instances_.empty()) {
+                // Only transformations changed, so the caches remain valid and only the moved instances need to
+                // be reported to the TLAS:
+                this->changed_instances_.insert(this->changed_instances_.end(), this->moved_instances_.begin(), this->moved_instances_.end());
+                this->moved_instances_.clear();
+            }
+
+            this->is_modified_ = false;
+        });
     };
 
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
@@ -611,6 +771,116 @@ namespace vira {
         }
     }
 
+    /**
+     * @brief Adds a newly created Instance to the instance cache
+     * @param instance The Instance to be added
+     *
+     * @details Structural changes are applied to the caches as they happen, so that processSceneGraph() only
+     *          needs to traverse the scene graph when a Mesh or Material has changed.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void Scene<TSpectral, TFloat, TMeshFloat>::cacheInstance(INSTANCE* instance)
+    {
+        TransformData transform_data;
+        transform_data.instance = instance;
+        meshes_.at(instance->getMeshID()).instances.push_back(transform_data);
+
+        this->markGraphChanged();
+        rebuildTLAS = true;
+    }
+
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void Scene<TSpectral, TFloat, TMeshFloat>::cacheLight(LIGHT* light)
+    {
+        light_cache_.push_back(light);
+        this->markGraphChanged();
+    }
+
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void Scene<TSpectral, TFloat, TMeshFloat>::cacheUnresolved(UNRESOLVED* unresolved_object)
+    {
+        unresolved_cache_.push_back(unresolved_object);
+        this->markGraphChanged();
+    }
+
+    /**
+     * @brief Removes an Instance from the caches before it is destroyed
+     * @param instance The Instance being removed
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void Scene<TSpectral, TFloat, TMeshFloat>::releaseInstance(const INSTANCE* instance)
+    {
+        auto mesh_it = meshes_.find(instance->getMeshID());
+        if (mesh_it != meshes_.end()) {
+            std::erase_if(mesh_it->second.instances, [instance](const TransformData& transform_data) { return transform_data.instance == instance; });
+        }
+        std::erase(changed_instances_, instance);
+        moved_instances_.erase(instance);
+
+        this->markGraphChanged();
+        rebuildTLAS = true;
+    }
+
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void Scene<TSpectral, TFloat, TMeshFloat>::releaseLight(const LIGHT* light)
+    {
+        std::erase(light_cache_, light);
+        this->markGraphChanged();
+    }
+
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void Scene<TSpectral, TFloat, TMeshFloat>::releaseUnresolved(const UNRESOLVED* unresolved_object)
+    {
+        std::erase(unresolved_cache_, unresolved_object);
+        this->markGraphChanged();
+    }
+
+    /**
+     * @brief Removes every object within a Group's subtree from the caches before the Group is destroyed
+     * @param group The Group being removed
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void Scene<TSpectral, TFloat, TMeshFloat>::releaseGroup(const GROUP* group)
+    {
+        std::unordered_set<const INSTANCE*> instances;
+        std::unordered_set<const LIGHT*> lights;
+        std::unordered_set<const UNRESOLVED*> unresolved_objects;
+
+        std::vector<const GROUP*> stack{ group };
+        while (!stack.empty()) {
+            const GROUP* current = stack.back();
+            stack.pop_back();
+
+            for (const auto& [instance_id, instance_entry] : current->instances_) {
+                instances.insert(instance_entry.data.get());
+            }
+            for (const auto& [light_id, light_entry] : current->lights_) {
+                lights.insert(light_entry.data.get());
+            }
+            for (const auto& [unresolved_id, unresolved_entry] : current->unresolved_objects_) {
+                unresolved_objects.insert(unresolved_entry.data.get());
+            }
+            for (const auto& [group_id, child_group] : current->groups_) {
+                stack.push_back(child_group.data.get());
+            }
+        }
+
+        if (!instances.empty()) {
+            for (auto& [meshID, meshData] : meshes_) {
+                std::erase_if(meshData.instances, [&instances](const TransformData& transform_data) { return instances.contains(transform_data.instance); });
+            }
+            std::erase_if(changed_instances_, [&instances](const INSTANCE* instance) { return instances.contains(instance); });
+            for (const INSTANCE* instance : instances) {
+                moved_instances_.erase(instance);
+            }
+            rebuildTLAS = true;
+        }
+        std::erase_if(light_cache_, [&lights](const LIGHT* light) { return lights.contains(light); });
+        std::erase_if(unresolved_cache_, [&unresolved_objects](const UNRESOLVED* unresolved_object) { return unresolved_objects.contains(unresolved_object); });
+
+        this->markGraphChanged();
+    }
+
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     void Scene<TSpectral, TFloat, TMeshFloat>::updateMeshLoDs(bool parallelUpdate, size_t numToUpdate)
     {
@@ -711,104 +981,140 @@ namespace vira {
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     void Scene<TSpectral, TFloat, TMeshFloat>::buildTLAS()
     {
-        this->processSceneGraph();
+        VIRA_PROFILE_ZONE("Scene::buildTLAS");
 
-        constexpr const bool FULL_EMBREE_COMPATIBLE = std::same_as<TMeshFloat, float> and std::same_as<TFloat, float>;
-        constexpr const bool BLAS_EMBREE_COMPATIBLE = std::same_as<TMeshFloat, float> and !std::same_as<TFloat, float>;
+        std::lock_guard<std::recursive_mutex> lock(graph_mutex_);
 
-        if (rebuildTLAS) {
-            std::chrono::high_resolution_clock::time_point start_time;
-            std::chrono::high_resolution_clock::time_point stop_time;
-            if (vira::getPrintStatus()) {
-                std::cout << "Building Acceleration Structure...\n" << std::flush;
-                start_time = std::chrono::high_resolution_clock::now();
+        this->concurrency_.execute([&] {
+            this->processSceneGraph();
+
+            // Refit the existing TLAS if only instance transformations have changed:
+            if (!rebuildTLAS && !changed_instances_.empty()) {
+                if (tlas == nullptr || !tlas->updateInstances(changed_instances_)) {
+                    rebuildTLAS = true;
+                }
             }
+            changed_instances_.clear();
+
+            constexpr const bool FULL_EMBREE_COMPATIBLE = std::same_as<TMeshFloat, float> and std::same_as<TFloat, float>;
+            constexpr const bool BLAS_EMBREE_COMPATIBLE = std::same_as<TMeshFloat, float> and !std::same_as<TFloat, float>;
 
-            if constexpr (FULL_EMBREE_COMPATIBLE) {
-                if (rtc_device_ == nullptr) {
-                    rtc_device_ = rtcNewDevice(nullptr);
+            if (rebuildTLAS) {
+                std::chrono::high_resolution_clock::time_point start_time;
+                std::chrono::high_resolution_clock::time_point stop_time;
+                if (vira::getPrintStatus()) {
+                    std::cout << "Building Acceleration Structure...\n" << std::flush;
+                    start_time = std::chrono::high_resolution_clock::now();
                 }
 
-                auto embreeTLAS = std::make_unique<rendering::EmbreeTLAS<TSpectral>>(rtc_device_, bvhBuildOptions.embree_options);
+                if constexpr (FULL_EMBREE_COMPATIBLE) {
+                    if (rtc_device_ == nullptr) {
+                        rtc_device_ = rtcNewDevice(this->concurrency_.getEmbreeConfig().c_str());
+                        embree_memory_.attach(rtc_device_);
+                    }
 
-                // Loop over all meshes in the map
-                for (const auto& [meshID, mesh_data] : meshes_) {
-                    auto& mesh = mesh_data.mesh;
+                    auto embreeTLAS = std::make_unique<rendering::EmbreeTLAS<TSpectral>>(rtc_device_, bvhBuildOptions.embree_options);
 
-                    // Reconstruct base BVH if required:
-                    mesh->buildBVH(rtc_device_, bvhBuildOptions);
+                    // Loop over all meshes in the map
+                    for (auto& [meshID, mesh_data] : meshes_) {
+                        auto& mesh = mesh_data.mesh;
 
-                    // Loop over all global transformState instances for the current Mesh:
-                    for (auto& instance_data : mesh_data.instances) {
-                        // Only include instances which are visible:
-                        if (instance_data.visibility) {
-                            embreeTLAS->newInstance(rtc_device_, dynamic_cast<rendering::EmbreeBLAS<TSpectral, float>*>(mesh->bvh.get()), mesh.get(), instance_data.instance);
+                        // Reconstruct base BVH if required (attributing the device memory it allocates).  The previous
+                        // BLAS is released before sampling, so the bytes it frees are not subtracted from the new one:
+                        const bool rebuild_blas = mesh->modified;
+                        if (rebuild_blas) {
+                            mesh->bvh.reset();
+                        }
+                        const int64_t embree_before = embree_memory_.bytes();
+                        mesh->buildBVH(rtc_device_, bvhBuildOptions);
+                        if (rebuild_blas) {
+                            mesh_data.embree_bytes = static_cast<size_t>(std::max<int64_t>(0, embree_memory_.bytes() - embree_before));
+                        }
+
+                        // Loop over all global transformState instances for the current Mesh:
+                        for (auto& instance_data : mesh_data.instances) {
+                            // Only include instances which are visible:
+                            if (instance_data.visibility) {
+                                embreeTLAS->newInstance(rtc_device_, dynamic_cast<rendering::EmbreeBLAS<TSpectral, float>*>(mesh->bvh.get()), mesh.get(), instance_data.instance);
+                            }
                         }
                     }
-                }
 
-                // Build the new TLAS:
-                embreeTLAS->build();
+                    // Build the new TLAS:
+                    embreeTLAS->build();
 
-                tlas.reset();
-                tlas = std::move(embreeTLAS);
-            }
-            else if constexpr (BLAS_EMBREE_COMPATIBLE) {
-                if (rtc_device_ == nullptr) {
-                    rtc_device_ = rtcNewDevice(nullptr);
+                    tlas.reset();
+                    tlas = std::move(embreeTLAS);
                 }
+                else if constexpr (BLAS_EMBREE_COMPATIBLE) {
+                    if (rtc_device_ == nullptr) {
+                        rtc_device_ = rtcNewDevice(this->concurrency_.getEmbreeConfig().c_str());
+                        embree_memory_.attach(rtc_device_);
+                    }
 
-                std::vector<rendering::TLASLeaf<TSpectral, TFloat, TMeshFloat>> leafVec;
+                    std::vector<rendering::TLASLeaf<TSpectral, TFloat, TMeshFloat>> leafVec;
 
-                // Loop over all meshes:
-                for (const auto& [meshID, meshData] : meshes_) {
-                    auto& mesh = meshData.mesh;
+                    // Loop over all meshes:
+                    for (auto& [meshID, meshData] : meshes_) {
+                        auto& mesh = meshData.mesh;
 
-                    // Reconstruct base BVH if required:
-                    mesh->buildBVH(rtc_device_, bvhBuildOptions);
+                        // Reconstruct base BVH if required (attributing the device memory it allocates).  The previous
+                        // BLAS is released before sampling, so the bytes it frees are not subtracted from the new one:
+                        const bool rebuild_blas = mesh->modified;
+                        if (rebuild_blas) {
+                            mesh->bvh.reset();
+                        }
+                        const int64_t embree_before = embree_memory_.bytes();
+                        mesh->buildBVH(rtc_device_, bvhBuildOptions);
+                        if (rebuild_blas) {
+                            meshData.embree_bytes = static_cast<size_t>(std::max<int64_t>(0, embree_memory_.bytes() - embree_before));
+                        }
 
-                    // Loop over all global transformState instances for the current Mesh:
-                    for (auto& instance : meshData.instances) {
-                        if (instance.visibility) {
-                            auto leafNode = TLASLeaf<TSpectral, TFloat, TMeshFloat>(mesh->bvh.get(), instance.globalTransformState, meshID, instance.instanceID);
-                            leafVec.push_back(leafNode);
+                        // Loop over all global transformState instances for the current Mesh:
+                        for (auto& instance_data : meshData.instances) {
+                            if (instance_data.visibility) {
+                                auto leafNode = rendering::TLASLeaf<TSpectral, TFloat, TMeshFloat>(mesh->bvh.get(), instance_data.instance->getModelMatrix(), meshID, instance_data.instance->getID());
+                                leafVec.push_back(leafNode);
+                            }
                         }
                     }
-                }
 
-                // Construct the TLAS:
-                tlas = std::make_unique<rendering::ViraTLAS<TSpectral, TMeshFloat>>(leafVec);
-            }
-            else {
-                std::vector<rendering::TLASLeaf<TSpectral, TFloat, TMeshFloat>> leafVec;
+                    // Construct the TLAS:
+                    tlas = std::make_unique<rendering::ViraTLAS<TSpectral, TMeshFloat>>(leafVec);
+                }
+                else {
+                    std::vector<rendering::TLASLeaf<TSpectral, TFloat, TMeshFloat>> leafVec;
 
-                // Loop over all meshes:
-                for (const auto& [meshID, meshData] : meshes_) {
-                    auto& mesh = meshData.mesh;
+                    // Loop over all meshes:
+                    for (const auto& [meshID, meshData] : meshes_) {
+                        auto& mesh = meshData.mesh;
 
-                    // Reconstruct base BVH if required:
-                    mesh->buildBVH(bvhBuildOptions);
+                        // Reconstruct base BVH if required:
+                        mesh->buildBVH(bvhBuildOptions);
 
-                    // Loop over all global transformState instances for the current Mesh:
-                    for (auto& instance : meshData.instances) {
-                        auto leafNode = rendering::TLASLeaf<TSpectral, TFloat, TMeshFloat>(mesh->bvh.get(), instance.global_transform_state, meshID, instance.instance_id);
-                        leafVec.push_back(leafNode);
+                        // Loop over all global transformState instances for the current Mesh:
+                        for (auto& instance_data : meshData.instances) {
+                            if (instance_data.visibility) {
+                                auto leafNode = rendering::TLASLeaf<TSpectral, TFloat, TMeshFloat>(mesh->bvh.get(), instance_data.instance->getModelMatrix(), meshID, instance_data.instance->getID());
+                                leafVec.push_back(leafNode);
+                            }
+                        }
                     }
-                }
 
-                // Construct the TLAS:
-                tlas = std::make_unique<rendering::ViraTLAS<TSpectral, TMeshFloat>>(leafVec);
-            }
+                    // Construct the TLAS:
+                    tlas = std::make_unique<rendering::ViraTLAS<TSpectral, TMeshFloat>>(leafVec);
+                }
 
-            // Reset flag:
-            rebuildTLAS = false;
+                // Reset flag:
+                rebuildTLAS = false;
 
-            if (vira::getPrintStatus()) {
-                stop_time = std::chrono::high_resolution_clock::now();
-                auto duration = duration_cast<std::chrono::milliseconds>(stop_time - start_time);
-                std::cout << vira::print::VIRA_INDENT + "Completed (" << duration.count() << " ms)\n";
+                if (vira::getPrintStatus()) {
+                    stop_time = std::chrono::high_resolution_clock::now();
+                    auto duration = duration_cast<std::chrono::milliseconds>(stop_time - start_time);
+                    std::cout << vira::print::VIRA_INDENT + "Completed (" << duration.count() << " ms)\n";
+                }
             }
-        }
+        });
     };
 
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
@@ -822,74 +1128,212 @@ namespace vira {
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     vira::images::Image<float> Scene<TSpectral, TFloat, TMeshFloat>::unresolvedRender(const vira::CameraID& cameraID)
     {
-        auto& camera = this->operator[](cameraID);
-        this->unresolvedRenderer.render(camera, *this);
-        return camera.simulateSensor(unresolvedRenderer.renderPasses.unresolved_power);
+        return this->concurrency_.execute([&] {
+            auto& camera = this->operator[](cameraID);
+            this->unresolvedRenderer.render(camera, *this);
+            return camera.simulateSensor(unresolvedRenderer.renderPasses.unresolved_power, this->sensor_stream_++);
+        });
     };
 
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     vira::images::Image<ColorRGB> Scene<TSpectral, TFloat, TMeshFloat>::unresolvedRenderRGB(const vira::CameraID& cameraID)
     {
-        auto& camera = this->operator[](cameraID);
-        this->unresolvedRenderer.render(camera, *this);
-        return camera.simulateSensorRGB(unresolvedRenderer.renderPasses.unresolved_power);
+        return this->concurrency_.execute([&] {
+            auto& camera = this->operator[](cameraID);
+            this->unresolvedRenderer.render(camera, *this);
+            return camera.simulateSensorRGB(unresolvedRenderer.renderPasses.unresolved_power, this->sensor_stream_++);
+        });
     };
 
 
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     vira::images::Image<float> Scene<TSpectral, TFloat, TMeshFloat>::pathtraceRender(const vira::CameraID& cameraID)
     {
-        auto& camera = this->operator[](cameraID);
-        this->pathtracer.render(camera, *this);
-        return camera.simulateSensor(pathtracer.renderPasses.received_power);
+        return this->concurrency_.execute([&] {
+            auto& camera = this->operator[](cameraID);
+            this->pathtracer.render(camera, *this);
+            return camera.simulateSensor(pathtracer.renderPasses.received_power, this->sensor_stream_++);
+        });
     };
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     vira::images::Image<ColorRGB> Scene<TSpectral, TFloat, TMeshFloat>::pathtraceRenderRGB(const vira::CameraID& cameraID)
     {
-        auto& camera = this->operator[](cameraID);
-        this->pathtracer.render(camera, *this);
-        auto& powerImage = pathtracer.renderPasses.received_power;
-        return camera.simulateSensorRGB(powerImage);
+        return this->concurrency_.execute([&] {
+            auto& camera = this->operator[](cameraID);
+            this->pathtracer.render(camera, *this);
+            auto& powerImage = pathtracer.renderPasses.received_power;
+            return camera.simulateSensorRGB(powerImage, this->sensor_stream_++);
+        });
     };
 
 
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     vira::images::Image<float> Scene<TSpectral, TFloat, TMeshFloat>::rasterizeRender(const vira::CameraID& cameraID)
     {
-        auto& camera = this->operator[](cameraID);
-        this->rasterizer.render(camera, *this);
-        return camera.simulateSensor(rasterizer.renderPasses.received_power);
+        return this->concurrency_.execute([&] {
+            auto& camera = this->operator[](cameraID);
+            this->rasterizer.render(camera, *this);
+            return camera.simulateSensor(rasterizer.renderPasses.received_power, this->sensor_stream_++);
+        });
     };
 
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     vira::images::Image<ColorRGB> Scene<TSpectral, TFloat, TMeshFloat>::rasterizeRenderRGB(const vira::CameraID& cameraID)
     {
-        auto& camera = this->operator[](cameraID);
-        this->rasterizer.render(camera, *this);
-        return camera.simulateSensorRGB(rasterizer.renderPasses.received_power);
+        return this->concurrency_.execute([&] {
+            auto& camera = this->operator[](cameraID);
+            this->rasterizer.render(camera, *this);
+            return camera.simulateSensorRGB(rasterizer.renderPasses.received_power, this->sensor_stream_++);
+        });
     };
 
 
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     vira::images::Image<TSpectral> Scene<TSpectral, TFloat, TMeshFloat>::renderTotalPower(const vira::CameraID& cameraID)
     {
-        auto& camera = this->operator[](cameraID);
+        return this->concurrency_.execute([&] {
+            auto& camera = this->operator[](cameraID);
+
+            // Only re-run rendering if something in the Scene has been changed
+            // Avoiding this allows you to take multiple different exposures without re-rendering!
+            if (this->isDirty()) {
+                // Perform pathtracing:
+                pathtracer.render(camera, *this);
+
+                // A cancelled render is returned as is, but must not be reused by the next call:
+                if (pathtracer.partial) {
+                    this->markDirty();
+                    return pathtracer.renderPasses.received_power;
+                }
 
-        // Only re-run rendering if something in the Scene has been changed
-        // Avoiding this allows you to take multiple different exposures without re-rendering!
-        if (this->is_dirty_) {
-            // Perform pathtracing:
-            pathtracer.render(camera, *this);
+                // Render unresolved:
+                unresolvedRenderer.render(camera, *this);
+            }
 
-            // Render unresolved:
-            unresolvedRenderer.render(camera, *this);
-        }
+            // Compute the total power image:
+            return this->combinePower(pathtracer.renderPasses.received_power, unresolvedRenderer.renderPasses.unresolved_power);
+        });
+    };
 
-        // Compute the total power image:
-        //const vira::images::Image<float>& alphaImage = pathtracer.renderPasses.alphaImage;
-        const vira::images::Image<TSpectral>& received_power = pathtracer.renderPasses.received_power;
-        const vira::images::Image<TSpectral>& unresolved_power = unresolvedRenderer.renderPasses.unresolved_power;
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    vira::images::Image<float> Scene<TSpectral, TFloat, TMeshFloat>::render(const vira::CameraID& cameraID)
+    {
+        return this->concurrency_.execute([&] {
+            auto& camera = this->operator[](cameraID);
+            vira::images::Image<TSpectral> total_power = renderTotalPower(cameraID);
+            return camera.simulateSensor(total_power, this->sensor_stream_++);
+        });
+    };
+
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    vira::images::Image<ColorRGB> Scene<TSpectral, TFloat, TMeshFloat>::renderRGB(const vira::CameraID& cameraID)
+    {
+        return this->concurrency_.execute([&] {
+            auto& camera = this->operator[](cameraID);
+            vira::images::Image<TSpectral> total_power = renderTotalPower(cameraID);
+            return camera.simulateSensorRGB(total_power, this->sensor_stream_++);
+        });
+    };
+
+    /**
+     * @brief Updates the scene graph caches and acceleration structures, and initializes cameras, ahead of context renders
+     * @param cameraIDs The cameras that will be rendered through contexts
+     * @details The context overloads of render() never modify the Scene or its cameras, so this must be called
+     *          (from a single thread) after the Scene or any of the cameras is modified, and before they are used.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void Scene<TSpectral, TFloat, TMeshFloat>::prepareRender(const std::vector<vira::CameraID>& cameraIDs)
+    {
+        this->concurrency_.execute([&] {
+            this->buildTLAS();
+
+            for (const vira::CameraID& cameraID : cameraIDs) {
+                this->operator[](cameraID).initialize();
+            }
+        });
+    };
+
+    /**
+     * @brief Checks whether the Scene can be rendered through a context
+     * @return true if the scene graph caches and acceleration structures are up to date
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    bool Scene<TSpectral, TFloat, TMeshFloat>::isPrepared() const
+    {
+        return !this->isDirty() && changed_instances_.empty() && !rebuildTLAS && tlas != nullptr;
+    };
+
+    /**
+     * @brief Creates a render context whose renderers share the Scene's renderer options
+     * @return A new context, holding its own output images
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    rendering::RenderContext<TSpectral, TFloat, TMeshFloat> Scene<TSpectral, TFloat, TMeshFloat>::newRenderContext() const
+    {
+        rendering::RenderContext<TSpectral, TFloat, TMeshFloat> context;
+
+        context.pathtracer.options = pathtracer.options;
+        context.pathtracer.denoiserOptions = pathtracer.denoiserOptions;
+        context.pathtracer.renderPasses.simulate_lighting = pathtracer.renderPasses.simulate_lighting;
+        context.pathtracer.renderPasses.save_velocity = pathtracer.renderPasses.save_velocity;
+        context.pathtracer.renderPasses.save_triangle_size = pathtracer.renderPasses.save_triangle_size;
+
+        context.unresolvedRenderer.options = unresolvedRenderer.options;
+
+        return context;
+    };
+
+    /**
+     * @brief Renders the total power received by a camera, writing only to the given context
+     * @param cameraID The camera to render from
+     * @param context Renderers and output images used by this render
+     * @return Total spectral power received by each pixel
+     * @throws std::runtime_error if the Scene has not been prepared, or the camera has not been initialized (see prepareRender())
+     * @details Unlike renderTotalPower(cameraID), the Scene is always re-rendered.  Neither the Scene nor the camera
+     *          is modified, so any number of threads may call this concurrently (each with its own context), provided
+     *          the Scene and its cameras are not modified until every render has returned.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    vira::images::Image<TSpectral> Scene<TSpectral, TFloat, TMeshFloat>::renderTotalPower(const vira::CameraID& cameraID, rendering::RenderContext<TSpectral, TFloat, TMeshFloat>& context) const
+    {
+        return this->concurrency_.execute([&] {
+            const CAMERA& camera = this->operator[](cameraID);
+            if (!this->isPrepared()) {
+                throw std::runtime_error("Scene must be prepared with prepareRender() before rendering through a RenderContext");
+            }
+            if (!camera.isInitialized()) {
+                throw std::runtime_error("Camera must be initialized with prepareRender() before rendering through a RenderContext");
+            }
+
+            context.pathtracer.render(camera, *this);
+            if (context.pathtracer.partial) {
+                return context.pathtracer.renderPasses.received_power;
+            }
 
+            context.unresolvedRenderer.render(camera, *this);
+
+            return this->combinePower(context.pathtracer.renderPasses.received_power, context.unresolvedRenderer.renderPasses.unresolved_power);
+        });
+    };
+
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    vira::images::Image<float> Scene<TSpectral, TFloat, TMeshFloat>::render(const vira::CameraID& cameraID, rendering::RenderContext<TSpectral, TFloat, TMeshFloat>& context) const
+    {
+        vira::images::Image<TSpectral> total_power = renderTotalPower(cameraID, context);
+        return this->operator[](cameraID).simulateSensor(total_power, context.sensor_stream++);
+    };
+
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    vira::images::Image<ColorRGB> Scene<TSpectral, TFloat, TMeshFloat>::renderRGB(const vira::CameraID& cameraID, rendering::RenderContext<TSpectral, TFloat, TMeshFloat>& context) const
+    {
+        vira::images::Image<TSpectral> total_power = renderTotalPower(cameraID, context);
+        return this->operator[](cameraID).simulateSensorRGB(total_power, context.sensor_stream++);
+    };
+
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    vira::images::Image<TSpectral> Scene<TSpectral, TFloat, TMeshFloat>::combinePower(const vira::images::Image<TSpectral>& received_power, const vira::images::Image<TSpectral>& unresolved_power) const
+    {
+        //const vira::images::Image<float>& alphaImage = pathtracer.renderPasses.alphaImage;
         vira::images::Image<TSpectral> total_power;
         if (unresolved_power.size() == 0 && received_power.size() == 0) {
             return total_power;
@@ -914,22 +1358,6 @@ namespace vira {
         return total_power;
     };
 
-    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
-    vira::images::Image<float> Scene<TSpectral, TFloat, TMeshFloat>::render(const vira::CameraID& cameraID)
-    {
-        auto& camera = this->operator[](cameraID);
-        vira::images::Image<TSpectral> total_power = renderTotalPower(cameraID);
-        return camera.simulateSensor(total_power);
-    };
-
-    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
-    vira::images::Image<ColorRGB> Scene<TSpectral, TFloat, TMeshFloat>::renderRGB(const vira::CameraID& cameraID)
-    {
-        auto& camera = this->operator[](cameraID);
-        vira::images::Image<TSpectral> total_power = renderTotalPower(cameraID);
-        return camera.simulateSensorRGB(total_power);
-    };
-
 
     // ======================= //
     // === Graph Modifiers === //
@@ -1069,8 +1497,130 @@ namespace vira {
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     void Scene<TSpectral, TFloat, TMeshFloat>::updateLevelOfDetail(const vira::CameraID& cameraID)
     {
-        auto& camera = this->operator[](cameraID);
-        lodManager.update(camera, *this);
+        VIRA_PROFILE_ZONE("Scene::updateLevelOfDetail");
+
+        std::lock_guard<std::recursive_mutex> lock(graph_mutex_);
+
+        this->concurrency_.execute([&] {
+            auto& camera = this->operator[](cameraID);
+            lodManager.update(camera, *this);
+        });
+    };
+
+
+    // =================== //
+    // === Concurrency === //
+    // =================== //
+    /**
+     * @brief Limits the threads used by every parallel stage of the Scene
+     * @param options Thread count, NUMA placement, and pinning options
+     * @details Loading, scene graph processing, acceleration structure builds, level of detail updates, and
+     *          rendering performed through the Scene all execute inside its task arena.  Renderers invoked
+     *          directly (e.g. `scene.pathtracer.render(camera, scene)`) should be called from within
+     *          `getConcurrency().execute()`.
+     *
+     *          The Embree device is recreated with the new thread configuration, so acceleration structures
+     *          are rebuilt on the next render.
+     *
+     * @see vira::utils::ConcurrencyContext
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void Scene<TSpectral, TFloat, TMeshFloat>::setConcurrency(utils::ConcurrencyOptions options)
+    {
+        std::lock_guard<std::recursive_mutex> lock(graph_mutex_);
+
+        this->concurrency_.configure(options);
+
+        if (rtc_device_ != nullptr) {
+            this->tlas.reset();
+            this->rebuildTLAS = true;
+
+            // BLASs belong to the released device, so must be rebuilt:
+            for (auto& [meshID, meshData] : meshes_) {
+                meshData.mesh->deviceFreed();
+                meshData.mesh->modified = true;
+                meshData.embree_bytes = 0;
+            }
+            rtcReleaseDevice(rtc_device_);
+            rtc_device_ = nullptr;
+            embree_memory_.reset();
+        }
+    };
+
+
+    // ========================= //
+    // === Memory Accounting === //
+    // ========================= //
+    /**
+     * @brief Reports the memory held by the scene, by category, by mesh, and by instance
+     * @return The memory report
+     * @details Memory allocated by Embree is measured exactly through the device's memory monitor.  Each
+     *          mesh is attributed the device memory allocated while its BLAS was built, and the remainder
+     *          (the top level scene and Embree's internal caches) is attributed to the TLAS.
+     *
+     *          An instance's amortized bytes include an equal share of the mesh it instances, which is the
+     *          memory that would be released if every instance of the mesh were removed.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    utils::MemoryReport Scene<TSpectral, TFloat, TMeshFloat>::getMemoryReport() const
+    {
+        std::lock_guard<std::recursive_mutex> lock(graph_mutex_);
+
+        utils::MemoryReport report;
+
+        // Meshes and their instances:
+        size_t embree_blas_bytes = 0;
+        for (const auto& [meshID, meshData] : meshes_) {
+            utils::MeshMemoryUsage mesh_usage;
+            mesh_usage.id = meshID;
+            mesh_usage.name = meshData.name;
+            mesh_usage.instances = meshData.instances.size();
+            mesh_usage.usage = meshData.mesh->getMemoryUsage();
+            mesh_usage.usage.blas += meshData.embree_bytes;
+            embree_blas_bytes += meshData.embree_bytes;
+
+            size_t mesh_share = (mesh_usage.instances == 0) ? 0 : mesh_usage.usage.total() / mesh_usage.instances;
+            for (const auto& instance_data : meshData.instances) {
+                utils::InstanceMemoryUsage instance_usage;
+                instance_usage.id = instance_data.instance->getID();
+                instance_usage.mesh = meshID;
+                instance_usage.bytes = sizeof(INSTANCE);
+                instance_usage.amortized_bytes = instance_usage.bytes + mesh_share;
+                report.instances.push_back(instance_usage);
+            }
+
+            report.totals += mesh_usage.usage;
+            report.meshes.push_back(std::move(mesh_usage));
+        }
+
+        // Top level acceleration structure:
+        report.embree_device_bytes = static_cast<size_t>(std::max<int64_t>(0, embree_memory_.bytes()));
+        if (tlas != nullptr) {
+            report.totals.tlas = tlas->getMemoryUsage();
+        }
+        if (report.embree_device_bytes > embree_blas_bytes) {
+            report.totals.tlas += report.embree_device_bytes - embree_blas_bytes;
+        }
+
+        // Textures:
+        for (const auto& [materialID, materialData] : materials_) {
+            report.totals.textures += materialData.data->getMemoryUsage();
+        }
+        report.totals.textures += background_emission_.getMemoryUsage();
+
+        // Render passes:
+        report.totals.render_passes = pathtracer.renderPasses.getMemoryUsage()
+            + rasterizer.renderPasses.getMemoryUsage()
+            + unresolvedRenderer.renderPasses.getMemoryUsage();
+
+        std::sort(report.meshes.begin(), report.meshes.end(), [](const utils::MeshMemoryUsage& a, const utils::MeshMemoryUsage& b) {
+            return a.usage.total() > b.usage.total();
+            });
+        std::sort(report.instances.begin(), report.instances.end(), [](const utils::InstanceMemoryUsage& a, const utils::InstanceMemoryUsage& b) {
+            return a.amortized_bytes > b.amortized_bytes;
+            });
+
+        return report;
     };
 
 
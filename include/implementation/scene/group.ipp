@@ -243,7 +243,7 @@ namespace vira::scene {
         ManagedData<vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>> cameraData(std::move(camera), name);
 
         cameras_.emplace(cameraID, std::move(cameraData));
-        scenePtr()->markDirty();
+        scenePtr()->markGraphChanged();
 
         return cameraID;
     }
@@ -260,7 +260,7 @@ namespace vira::scene {
         ManagedData<Group<TSpectral, TFloat, TMeshFloat>> newEntry(std::move(group), name);
 
         groups_.emplace(newID, std::move(newEntry));
-        scenePtr()->markDirty();
+        scenePtr()->markGraphChanged();
 
         for (const MeshID& newMeshID : meshIDs) {
             this->operator[](newID).newInstance(newMeshID);
@@ -289,7 +289,7 @@ namespace vira::scene {
         ManagedData<Instance<TSpectral, TFloat, TMeshFloat>> newEntry(std::move(instance), name);
 
         instances_.emplace(newID, std::move(newEntry));
-        scenePtr()->markDirty();
+        scenePtr()->cacheInstance(instances_.at(newID).data.get());
 
         return newID;
     }
@@ -527,7 +527,7 @@ namespace vira::scene {
         ManagedData<vira::lights::Light<TSpectral, TFloat, TMeshFloat>> newEntry(std::move(light), name);
 
         lights_.emplace(newID, std::move(newEntry));
-        scenePtr()->markDirty();
+        scenePtr()->cacheLight(lights_.at(newID).data.get());
 
         return newID;
     };
@@ -602,7 +602,7 @@ namespace vira::scene {
         ManagedData<unresolved::UnresolvedObject<TSpectral, TFloat, TMeshFloat>> new_entry(std::move(unresolved_object), name);
 
         unresolved_objects_.emplace(new_id, std::move(new_entry));
-        scenePtr()->markDirty();
+        scenePtr()->cacheUnresolved(unresolved_objects_.at(new_id).data.get());
 
         return new_id;
     };
@@ -651,7 +651,7 @@ namespace vira::scene {
             return false;
         }
         cameras_.erase(it);
-        scenePtr()->markDirty();
+        scenePtr()->markGraphChanged();
 
         this->scenePtr()->deallocateCameraID();
 
@@ -664,8 +664,8 @@ namespace vira::scene {
         if (it == groups_.end()) {
             return false;
         }
+        scenePtr()->releaseGroup(it->second.data.get());
         groups_.erase(it);
-        scenePtr()->markDirty();
 
         this->scenePtr()->deallocateGroupID();
 
@@ -678,8 +678,8 @@ namespace vira::scene {
         if (it == instances_.end()) {
             return false;
         }
+        scenePtr()->releaseInstance(it->second.data.get());
         instances_.erase(it);
-        scenePtr()->markDirty();
 
         this->scenePtr()->deallocateInstanceID();
 
@@ -692,8 +692,8 @@ namespace vira::scene {
         if (it == lights_.end()) {
             return false;
         }
+        scenePtr()->releaseLight(it->second.data.get());
         lights_.erase(it);
-        scenePtr()->markDirty();
 
         this->scenePtr()->deallocateLightID();
 
@@ -706,8 +706,8 @@ namespace vira::scene {
         if (it == unresolved_objects_.end()) {
             return false;
         }
+        scenePtr()->releaseUnresolved(it->second.data.get());
         unresolved_objects_.erase(it);
-        scenePtr()->markDirty();
 
         this->scenePtr()->deallocateUnresolvedID();
 
@@ -736,6 +736,7 @@ namespace vira::scene {
         }
 
         scenePtr()->markDirty();
+        scenePtr()->markGraphChanged();
     }
 
 
@@ -744,7 +745,7 @@ namespace vira::scene {
     // ========================= //
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     void Group<TSpectral, TFloat, TMeshFloat>::onReferenceFrameChanged() {
-        this->scenePtr()->markDirty();
+        this->scenePtr()->markModified();
         this->updateChildren();
     }
 
@@ -757,6 +758,7 @@ namespace vira::scene {
 
         for (auto& [id, instance_data] : instances_) {
             instance_data.data->updateGlobalTransformation();
+            scenePtr()->markMoved(instance_data.data.get());
         }
 
         for (auto& [id, light_data] : lights_) {
@@ -773,31 +775,6 @@ namespace vira::scene {
         }
     }
 
-    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
-    void Group<TSpectral, TFloat, TMeshFloat>::updateSPICE(double et)
-    {
-        for (auto& [id, camera_data] : cameras_) {
-            camera_data.data->updateSPICEStates(et);
-        }
-
-        for (auto& [id, instance_data] : instances_) {
-            instance_data.data->updateSPICEStates(et);
-        }
-
-        for (auto& [id, light_data] : lights_) {
-            light_data.data->updateSPICEStates(et);
-        }
-
-        for (auto& [id, unresolved_data] : unresolved_objects_) {
-            unresolved_data.data->updateSPICEStates(et);
-        }
-
-        for (auto& [id, group_data] : groups_) {
-            group_data.data->updateSPICEStates(et);
-            group_data.data->updateSPICE(et);
-        }
-    }
-
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     template<IsTypedID IDType, typename T>
     void Group<TSpectral, TFloat, TMeshFloat>::processName(std::string& name, const std::unordered_map<IDType, T>& container, const std::string& containerName) {
@@ -844,7 +821,7 @@ namespace vira::scene {
         auto it = cameras_.find(id);
         cameras_.erase(it);
 
-        scenePtr()->markDirty();
+        scenePtr()->markGraphChanged();
 
         (*to_group)[id].setParent(to_group);
         (*to_group)[id].updateGlobalTransformation();
@@ -857,10 +834,11 @@ namespace vira::scene {
         auto it = instances_.find(id);
         instances_.erase(it);
 
-        scenePtr()->markDirty();
+        scenePtr()->markGraphChanged();
 
         (*to_group)[id].setParent(to_group);
         (*to_group)[id].updateGlobalTransformation();
+        scenePtr()->markMoved(&(*to_group)[id]);
     }
 
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
@@ -870,7 +848,7 @@ namespace vira::scene {
         auto it = lights_.find(id);
         lights_.erase(it);
 
-        scenePtr()->markDirty();
+        scenePtr()->markGraphChanged();
 
         (*to_group)[id].setParent(to_group);
         (*to_group)[id].updateGlobalTransformation();
@@ -883,7 +861,7 @@ namespace vira::scene {
         auto it = unresolved_objects_.find(id);
         unresolved_objects_.erase(it);
 
-        scenePtr()->markDirty();
+        scenePtr()->markGraphChanged();
 
         (*to_group)[id].setParent(to_group);
         (*to_group)[id].updateGlobalTransformation();
@@ -896,7 +874,7 @@ namespace vira::scene {
         auto it = groups_.find(id);
         groups_.erase(it);
 
-        scenePtr()->markDirty();
+        scenePtr()->markGraphChanged();
 
         (*to_group)[id].setParent(to_group);
         (*to_group)[id].updateGlobalTransformation();
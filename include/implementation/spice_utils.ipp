@@ -1,6 +1,7 @@
 #include <string>
 #include <stdexcept>
 #include <filesystem>
+#include <mutex>
 
 #include "cspice/SpiceUsr.h"
 
@@ -13,6 +14,8 @@ namespace vira {
     template <IsFloat TFloat>
     template<typename Func, typename... Args>
     auto SpiceUtils<TFloat>::safe_spice_call(Func&& func, Args&&... args) {
+        std::lock_guard<std::recursive_mutex> lock(spiceMutex());
+
         if (failed_c()) {
             reset_c();
         }
@@ -63,6 +66,9 @@ namespace vira {
             return;
         }
 
+        // The working directory is process-wide, so it must not change while another thread loads a kernel:
+        std::lock_guard<std::recursive_mutex> lock(spiceMutex());
+
         auto original_dir = std::filesystem::current_path();
         try {
             std::filesystem::current_path(kernelPath.parent_path());
@@ -0,0 +1,257 @@
+#include <cstddef>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "tbb/info.h"
+#include "tbb/task_arena.h"
+
+#ifdef _WIN32
+#include "vira/platform/windows_compat.hpp"
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace vira::utils {
+    namespace detail {
+#ifdef _WIN32
+        using AffinityMask = DWORD_PTR;
+#elif defined(__linux__)
+        using AffinityMask = cpu_set_t;
+#else
+        using AffinityMask = int;
+#endif
+
+        // Affinity a thread had before a PinningObserver pinned it.  A thread's arena entries and exits are
+        // nested, so the saved masks form a stack (owner identifies the observer which pushed each entry):
+        struct SavedAffinity {
+            const void* owner = nullptr;
+            bool pinned = false;
+            AffinityMask mask{};
+        };
+
+        inline std::vector<SavedAffinity>& savedAffinities()
+        {
+            thread_local std::vector<SavedAffinity> saved;
+            return saved;
+        };
+    };
+
+    /**
+     * @brief Constructs a context and its task arena
+     * @param options Thread count, NUMA placement, and pinning options
+     * @throws std::runtime_error if the requested NUMA node does not exist
+     */
+    inline ConcurrencyContext::ConcurrencyContext(ConcurrencyOptions options)
+    {
+        this->configure(options);
+    };
+
+    inline ConcurrencyContext::~ConcurrencyContext()
+    {
+        if (observer_ != nullptr) {
+            observer_->observe(false);
+        }
+    };
+
+    /**
+     * @brief Replaces the task arena with one matching new options
+     * @param options Thread count, NUMA placement, and pinning options
+     * @details Must not be called while work is executing in the context.
+     * @throws std::runtime_error if the requested NUMA node does not exist
+     */
+    inline void ConcurrencyContext::configure(ConcurrencyOptions options)
+    {
+        if (observer_ != nullptr) {
+            observer_->observe(false);
+            observer_.reset();
+        }
+        arena_.reset();
+
+        tbb::task_arena::constraints constraints{};
+        if (options.max_threads != 0) {
+            constraints.set_max_concurrency(static_cast<int>(options.max_threads));
+        }
+
+        if (options.numa_node >= 0) {
+            std::vector<tbb::numa_node_id> nodes = tbb::info::numa_nodes();
+            if (std::find(nodes.begin(), nodes.end(), options.numa_node) == nodes.end()) {
+                throw std::runtime_error("NUMA node " + std::to_string(options.numa_node) + " is not available (" + std::to_string(nodes.size()) + " nodes detected)");
+            }
+            constraints.set_numa_id(options.numa_node);
+        }
+
+        arena_ = std::make_unique<tbb::task_arena>(constraints);
+        arena_->initialize();
+
+        if (options.pin_threads) {
+            observer_ = std::make_unique<PinningObserver>(*arena_, getCores(options.numa_node), options.first_core);
+            observer_->observe(true);
+        }
+
+        options_ = options;
+    };
+
+    /**
+     * @brief Returns the maximum number of threads work submitted to the context may use
+     */
+    inline size_t ConcurrencyContext::getMaxThreads() const
+    {
+        return static_cast<size_t>(arena_->max_concurrency());
+    };
+
+    /**
+     * @brief Returns an Embree device configuration string matching the context
+     * @return Configuration to pass to rtcNewDevice()
+     */
+    inline std::string ConcurrencyContext::getEmbreeConfig() const
+    {
+        std::string config = "threads=" + std::to_string(this->getMaxThreads());
+        if (options_.pin_threads) {
+            config += ",set_affinity=1";
+        }
+        return config;
+    };
+
+    /**
+     * @brief Returns the logical cores threads may be pinned to
+     * @param numa_node NUMA node whose cores are returned (-1 for every core)
+     * @return Sorted core indices
+     * @details Falls back to every core if the node's CPU set cannot be queried.
+     */
+    inline std::vector<size_t> ConcurrencyContext::getCores(int numa_node)
+    {
+        std::vector<size_t> cores;
+
+        if (numa_node >= 0) {
+#ifdef _WIN32
+            ULONGLONG mask = 0;
+            if (GetNumaNodeProcessorMask(static_cast<UCHAR>(numa_node), &mask)) {
+                for (size_t core = 0; core < 64; ++core) {
+                    if (mask & (static_cast<ULONGLONG>(1) << core)) {
+                        cores.push_back(core);
+                    }
+                }
+            }
+#elif defined(__linux__)
+            // The node's CPU list is a comma separated list of ranges (e.g. "0-7,16-23"):
+            std::ifstream file("/sys/devices/system/node/node" + std::to_string(numa_node) + "/cpulist");
+            std::string range;
+            while (std::getline(file, range, ',')) {
+                std::istringstream stream(range);
+                size_t first = 0;
+                size_t last = 0;
+                char dash = 0;
+                if (!(stream >> first)) {
+                    continue;
+                }
+                last = (stream >> dash >> last) ? last : first;
+                for (size_t core = first; core <= last; ++core) {
+                    cores.push_back(core);
+                }
+            }
+#endif
+        }
+
+        if (cores.empty()) {
+            size_t num_cores = std::max<size_t>(1, std::thread::hardware_concurrency());
+            for (size_t core = 0; core < num_cores; ++core) {
+                cores.push_back(core);
+            }
+        }
+
+        return cores;
+    };
+
+    /**
+     * @brief Executes a function inside the context's task arena
+     * @param f Function to execute
+     * @return The value returned by f
+     * @details Parallel algorithms called (directly or indirectly) by f are limited to the arena's threads.
+     *          Calls may be nested; work already running in the arena executes immediately.
+     */
+    template <typename F>
+    auto ConcurrencyContext::execute(F&& f) const -> decltype(f())
+    {
+        return arena_->execute(std::forward<F>(f));
+    };
+
+
+
+    // ======================= //
+    // === PinningObserver === //
+    // ======================= //
+    inline ConcurrencyContext::PinningObserver::PinningObserver(tbb::task_arena& arena, std::vector<size_t> cores, size_t first_core) :
+        tbb::task_scheduler_observer(arena), cores_{ std::move(cores) }, first_core_{ first_core }
+    {
+    };
+
+    /**
+     * @brief Pins a thread entering the arena to the core matching its arena slot
+     * @details Slots are mapped onto the observer's cores (the NUMA node's cores, if one was selected),
+     *          starting at first_core and wrapping around.  The thread's previous affinity is saved and
+     *          restored by on_scheduler_exit(), so neither the calling thread (nor threads it later spawns)
+     *          nor workers which move on to another arena remain pinned to this arena's cores.
+     */
+    inline void ConcurrencyContext::PinningObserver::on_scheduler_entry(bool is_worker)
+    {
+        (void)is_worker;
+
+        detail::SavedAffinity saved;
+        saved.owner = this;
+
+        int slot = tbb::this_task_arena::current_thread_index();
+        if (slot != tbb::task_arena::not_initialized) {
+            size_t core = cores_[(first_core_ + static_cast<size_t>(slot)) % cores_.size()];
+
+#ifdef _WIN32
+            if (core < 64) {
+                saved.mask = SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1) << core);
+                saved.pinned = (saved.mask != 0);
+            }
+#elif defined(__linux__)
+            if (core < CPU_SETSIZE && pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &saved.mask) == 0) {
+                cpu_set_t cpuset;
+                CPU_ZERO(&cpuset);
+                CPU_SET(core, &cpuset);
+                saved.pinned = (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset) == 0);
+            }
+#else
+            (void)core; // Thread affinity is not supported on this platform
+#endif
+        }
+
+        detail::savedAffinities().push_back(saved);
+    };
+
+    /**
+     * @brief Restores the affinity a thread had before it entered the arena
+     */
+    inline void ConcurrencyContext::PinningObserver::on_scheduler_exit(bool is_worker)
+    {
+        (void)is_worker;
+
+        std::vector<detail::SavedAffinity>& saved = detail::savedAffinities();
+        auto entry = std::find_if(saved.rbegin(), saved.rend(), [this](const detail::SavedAffinity& s) { return s.owner == this; });
+        if (entry == saved.rend()) {
+            return;
+        }
+
+        if (entry->pinned) {
+#ifdef _WIN32
+            SetThreadAffinityMask(GetCurrentThread(), entry->mask);
+#elif defined(__linux__)
+            pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &entry->mask);
+#endif
+        }
+
+        saved.erase(std::next(entry).base());
+    };
+};
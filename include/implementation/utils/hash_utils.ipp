@@ -1,5 +1,7 @@
 #include <cstddef>
 #include <cstdint>
+#include <string>
+#include <type_traits>
 
 #include "vira/constraints.hpp"
 #include "vira/vec.hpp"
@@ -13,6 +15,32 @@ namespace vira::utils {
 
     };
 
+    // Folds the bytes of a buffer into an FNV-1a hash:
+    void fnv1a(uint64_t& hash, const void* data, size_t size)
+    {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= static_cast<uint64_t>(bytes[i]);
+            hash *= FNV1A_PRIME;
+        }
+    };
+
+    // Folds each value into an FNV-1a hash (strings are length prefixed, so adjacent strings cannot alias):
+    template <typename T, typename... Rest>
+    void fnv1aCombine(uint64_t& hash, const T& v, const Rest&... rest)
+    {
+        if constexpr (std::is_same_v<T, std::string>) {
+            uint64_t length = static_cast<uint64_t>(v.size());
+            fnv1a(hash, &length, sizeof(length));
+            fnv1a(hash, v.data(), v.size());
+        }
+        else {
+            static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>, "fnv1aCombine only supports strings, arithmetic, and enum values");
+            fnv1a(hash, &v, sizeof(T));
+        }
+        (fnv1aCombine(hash, rest), ...);
+    };
+
     // A simple hashing function for a size_t:
     void hashUint32(size_t& a) {
         a = (a ^ 61) ^ (a >> 16);
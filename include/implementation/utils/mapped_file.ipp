@@ -0,0 +1,216 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <stdexcept>
+#include <utility>
+#include <filesystem>
+
+#ifdef _WIN32
+#include "vira/platform/windows_compat.hpp"
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace fs = std::filesystem;
+
+namespace vira::utils {
+    /**
+     * @brief Maps an entire file into memory for reading
+     * @param filepath Path to the file
+     * @throws std::runtime_error if the file cannot be opened or mapped
+     */
+    inline MappedFile::MappedFile(const fs::path& filepath) :
+        filepath_{ filepath }
+    {
+        if (!fs::exists(filepath) || fs::is_directory(filepath)) {
+            throw std::runtime_error("There is no file with path: " + filepath.string());
+        }
+
+        size_ = static_cast<size_t>(fs::file_size(filepath));
+        if (size_ == 0) {
+            throw std::runtime_error("Cannot memory map an empty file: " + filepath.string());
+        }
+
+#ifdef _WIN32
+        HANDLE file = CreateFileW(filepath.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Could not open " + filepath.string() + " for memory mapping");
+        }
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping == nullptr) {
+            CloseHandle(file);
+            throw std::runtime_error("Could not memory map " + filepath.string());
+        }
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (view == nullptr) {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            throw std::runtime_error("Could not memory map " + filepath.string());
+        }
+
+        file_handle_ = file;
+        mapping_handle_ = mapping;
+        data_ = static_cast<const char*>(view);
+#else
+        int fd = ::open(filepath.c_str(), O_RDONLY);
+        if (fd == -1) {
+            throw std::runtime_error("Could not open " + filepath.string() + " for memory mapping");
+        }
+
+        void* view = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); // The mapping keeps its own reference to the file
+        if (view == MAP_FAILED) {
+            throw std::runtime_error("Could not memory map " + filepath.string());
+        }
+
+        data_ = static_cast<const char*>(view);
+#endif
+    };
+
+    inline MappedFile::~MappedFile()
+    {
+        this->close();
+    };
+
+    inline MappedFile::MappedFile(MappedFile&& other) noexcept
+    {
+        *this = std::move(other);
+    };
+
+    inline MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other) {
+            this->close();
+
+            filepath_ = std::move(other.filepath_);
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+#ifdef _WIN32
+            file_handle_ = std::exchange(other.file_handle_, nullptr);
+            mapping_handle_ = std::exchange(other.mapping_handle_, nullptr);
+#endif
+        }
+        return *this;
+    };
+
+    /**
+     * @brief Releases the mapping (any pointers into it become invalid)
+     */
+    inline void MappedFile::close()
+    {
+        if (data_ == nullptr) {
+            return;
+        }
+
+#ifdef _WIN32
+        UnmapViewOfFile(data_);
+        CloseHandle(static_cast<HANDLE>(mapping_handle_));
+        CloseHandle(static_cast<HANDLE>(file_handle_));
+        mapping_handle_ = nullptr;
+        file_handle_ = nullptr;
+#else
+        ::munmap(const_cast<char*>(data_), size_);
+#endif
+
+        data_ = nullptr;
+        size_ = 0;
+    };
+
+
+
+    // ======================== //
+    // === MappedFileReader === //
+    // ======================== //
+    inline MappedFileReader::MappedFileReader(const MappedFile& file, size_t offset) :
+        file_{ &file }, offset_{ offset }
+    {
+        if (!file.isOpen()) {
+            throw std::runtime_error("Attempted to read from a MappedFile which is not open");
+        }
+    };
+
+    /**
+     * @brief Returns a pointer to the current position and advances past the given number of bytes
+     * @param bytes Number of bytes to consume
+     * @throws std::runtime_error if the read would pass the end of the file
+     */
+    inline const char* MappedFileReader::advance(size_t bytes)
+    {
+        if (bytes > file_->size() || offset_ > file_->size() - bytes) {
+            throw std::runtime_error("Unexpected end of file while reading " + file_->getFilepath().string());
+        }
+
+        const char* ptr = file_->data() + offset_;
+        offset_ += bytes;
+        return ptr;
+    };
+
+    template <typename T>
+    void MappedFileReader::readValue(T& value)
+    {
+        std::memcpy(&value, advance(sizeof(T)), sizeof(T));
+    };
+
+    inline void MappedFileReader::readString(std::string& str)
+    {
+        uint32_t size;
+        readValue(size);
+        const char* ptr = advance(size);
+        str.assign(ptr, size);
+    };
+
+    template <typename T>
+    void MappedFileReader::readArray(T* values, size_t count)
+    {
+        if (count == 0) {
+            return;
+        }
+        std::memcpy(values, advance(count * sizeof(T)), count * sizeof(T));
+    };
+
+    /**
+     * @brief Views an array in place within the mapping
+     * @param count Number of elements
+     * @return Pointer to the first element (valid for the lifetime of the MappedFile)
+     * @throws std::runtime_error if the current position is not suitably aligned for T
+     */
+    template <typename T>
+    const T* MappedFileReader::view(size_t count)
+    {
+        if (offset_ % alignof(T) != 0) {
+            throw std::runtime_error("Misaligned array in " + file_->getFilepath().string());
+        }
+        return reinterpret_cast<const T*>(advance(count * sizeof(T)));
+    };
+
+    /**
+     * @brief Skips the padding inserted to align the next array
+     * @param alignment Alignment (in bytes, relative to the start of the file)
+     */
+    inline void MappedFileReader::align(size_t alignment)
+    {
+        size_t remainder = offset_ % alignment;
+        if (remainder != 0) {
+            advance(alignment - remainder);
+        }
+    };
+
+    inline void MappedFileReader::skip(size_t bytes)
+    {
+        advance(bytes);
+    };
+
+    inline void MappedFileReader::seek(size_t offset)
+    {
+        if (offset > file_->size()) {
+            throw std::runtime_error("Attempted to seek past the end of " + file_->getFilepath().string());
+        }
+        offset_ = offset;
+    };
+};
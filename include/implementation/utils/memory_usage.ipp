@@ -0,0 +1,82 @@
+#include <cstddef>
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+namespace vira::utils {
+    inline MemoryUsage& MemoryUsage::operator+=(const MemoryUsage& other)
+    {
+        vertices += other.vertices;
+        indices += other.indices;
+        triangles += other.triangles;
+        blas += other.blas;
+        tlas += other.tlas;
+        textures += other.textures;
+        render_passes += other.render_passes;
+        return *this;
+    };
+
+    /**
+     * @brief Formats a byte count with a binary unit (e.g. "12.50 MiB")
+     */
+    inline std::string formatBytes(size_t bytes)
+    {
+        constexpr const char* units[] = { "B", "KiB", "MiB", "GiB", "TiB" };
+
+        double value = static_cast<double>(bytes);
+        size_t unit = 0;
+        while (value >= 1024. && unit < 4) {
+            value /= 1024.;
+            unit++;
+        }
+
+        std::ostringstream ss;
+        ss << std::fixed << std::setprecision((unit == 0) ? 0 : 2) << value << " " << units[unit];
+        return ss.str();
+    };
+
+    /**
+     * @brief Formats the report as human readable tables
+     * @param max_rows Maximum number of meshes and instances to list
+     */
+    inline std::string MemoryReport::format(size_t max_rows) const
+    {
+        std::ostringstream ss;
+
+        auto row = [&](const std::string& label, size_t bytes) {
+            ss << "    " << std::left << std::setw(16) << label << std::right << std::setw(14) << formatBytes(bytes) << "\n";
+        };
+
+        ss << "Memory by category:\n";
+        row("Vertices", totals.vertices);
+        row("Indices", totals.indices);
+        row("Triangles", totals.triangles);
+        row("BLAS", totals.blas);
+        row("TLAS", totals.tlas);
+        row("Textures", totals.textures);
+        row("Render passes", totals.render_passes);
+        row("Total", totals.total());
+        if (embree_device_bytes > 0) {
+            row("(Embree device)", embree_device_bytes);
+        }
+
+        ss << "Largest meshes:\n";
+        for (size_t i = 0; i < std::min(max_rows, meshes.size()); ++i) {
+            const MeshMemoryUsage& mesh = meshes[i];
+            std::string label = mesh.name.empty() ? mesh.id.name() : mesh.name;
+            ss << "    " << std::left << std::setw(32) << label << std::right << std::setw(14) << formatBytes(mesh.usage.total())
+                << "  (geometry " << formatBytes(mesh.usage.geometry()) << ", BLAS " << formatBytes(mesh.usage.blas)
+                << ", " << mesh.instances << " instances)\n";
+        }
+
+        ss << "Largest instances (amortized):\n";
+        for (size_t i = 0; i < std::min(max_rows, instances.size()); ++i) {
+            const InstanceMemoryUsage& instance = instances[i];
+            ss << "    " << std::left << std::setw(32) << instance.id.name() << std::right << std::setw(14) << formatBytes(instance.amortized_bytes)
+                << "  (" << instance.mesh.name() << ")\n";
+        }
+
+        return ss.str();
+    };
+};
@@ -0,0 +1,241 @@
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+namespace vira::utils {
+    inline Profiler::Profiler() :
+        epoch_{ std::chrono::steady_clock::now() }
+    {
+    };
+
+    /**
+     * @brief Returns the process-wide profiler
+     */
+    inline Profiler& Profiler::get()
+    {
+        static Profiler profiler;
+        return profiler;
+    };
+
+    /**
+     * @brief Discards every recorded zone
+     */
+    inline void Profiler::clear()
+    {
+        std::lock_guard<std::mutex> lock(buffers_mutex_);
+        for (auto& buffer : buffers_) {
+            std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+            buffer->events.clear();
+        }
+    };
+
+    /**
+     * @brief Returns the current time, in nanoseconds since the profiler was created
+     */
+    inline uint64_t Profiler::now() const
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch_).count());
+    };
+
+    /**
+     * @brief Appends a completed zone to the calling thread's buffer
+     * @param name Zone name (must have static storage duration)
+     * @param start_ns Start time returned by now()
+     * @param end_ns End time returned by now()
+     * @param depth Nesting depth of the zone on the calling thread
+     */
+    inline void Profiler::record(const char* name, uint64_t start_ns, uint64_t end_ns, uint32_t depth)
+    {
+        ThreadBuffer& buffer = this->threadBuffer();
+
+        std::lock_guard<std::mutex> lock(buffer.mutex);
+        buffer.events.push_back(ProfileEvent{ name, start_ns, end_ns - start_ns, buffer.thread, depth });
+    };
+
+    inline Profiler::ThreadBuffer& Profiler::threadBuffer()
+    {
+        // The profiler shares ownership, so events outlive the thread that recorded them:
+        thread_local std::shared_ptr<ThreadBuffer> buffer = [this]() {
+            auto new_buffer = std::make_shared<ThreadBuffer>();
+
+            std::lock_guard<std::mutex> lock(buffers_mutex_);
+            new_buffer->thread = static_cast<uint32_t>(buffers_.size());
+            buffers_.push_back(new_buffer);
+            return new_buffer;
+            }();
+
+        return *buffer;
+    };
+
+    /**
+     * @brief Returns every recorded zone, sorted by start time
+     */
+    inline std::vector<ProfileEvent> Profiler::getEvents() const
+    {
+        std::vector<ProfileEvent> events;
+        {
+            std::lock_guard<std::mutex> lock(buffers_mutex_);
+            for (const auto& buffer : buffers_) {
+                std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+                events.insert(events.end(), buffer->events.begin(), buffer->events.end());
+            }
+        }
+
+        std::sort(events.begin(), events.end(), [](const ProfileEvent& a, const ProfileEvent& b) { return a.start_ns < b.start_ns; });
+        return events;
+    };
+
+    /**
+     * @brief Summarizes the recorded zones by name
+     * @return Statistics for each zone name, in order of decreasing total time
+     */
+    inline std::vector<ProfileStatistics> Profiler::getStatistics() const
+    {
+        std::unordered_map<const char*, ProfileStatistics> by_name;
+        for (const ProfileEvent& event : this->getEvents()) {
+            double ms = static_cast<double>(event.duration_ns) * 1e-6;
+
+            ProfileStatistics& stats = by_name[event.name];
+            if (stats.count == 0) {
+                stats.name = event.name;
+                stats.min_ms = ms;
+                stats.max_ms = ms;
+            }
+            stats.count++;
+            stats.total_ms += ms;
+            stats.min_ms = std::min(stats.min_ms, ms);
+            stats.max_ms = std::max(stats.max_ms, ms);
+        }
+
+        // Identical names from different translation units may have different addresses:
+        std::unordered_map<std::string, ProfileStatistics> merged;
+        for (auto& [name, stats] : by_name) {
+            auto it = merged.find(stats.name);
+            if (it == merged.end()) {
+                merged.emplace(stats.name, stats);
+                continue;
+            }
+            it->second.min_ms = std::min(it->second.min_ms, stats.min_ms);
+            it->second.max_ms = std::max(it->second.max_ms, stats.max_ms);
+            it->second.count += stats.count;
+            it->second.total_ms += stats.total_ms;
+        }
+
+        std::vector<ProfileStatistics> statistics;
+        statistics.reserve(merged.size());
+        for (auto& [name, stats] : merged) {
+            statistics.push_back(std::move(stats));
+        }
+        std::sort(statistics.begin(), statistics.end(), [](const ProfileStatistics& a, const ProfileStatistics& b) { return a.total_ms > b.total_ms; });
+
+        return statistics;
+    };
+
+    /**
+     * @brief Formats the zone statistics as a table
+     */
+    inline std::string Profiler::formatStatistics() const
+    {
+        std::ostringstream ss;
+        ss << std::left << std::setw(40) << "Zone" << std::right
+            << std::setw(10) << "Count" << std::setw(14) << "Total (ms)" << std::setw(12) << "Mean (ms)"
+            << std::setw(12) << "Min (ms)" << std::setw(12) << "Max (ms)" << "\n";
+
+        ss << std::fixed << std::setprecision(3);
+        for (const ProfileStatistics& stats : this->getStatistics()) {
+            ss << std::left << std::setw(40) << stats.name << std::right
+                << std::setw(10) << stats.count << std::setw(14) << stats.total_ms << std::setw(12) << stats.mean_ms()
+                << std::setw(12) << stats.min_ms << std::setw(12) << stats.max_ms << "\n";
+        }
+
+        return ss.str();
+    };
+
+    /**
+     * @brief Writes the recorded zones in the Chrome trace event format
+     * @param filepath Output JSON file
+     * @throws std::runtime_error if the file could not be opened
+     */
+    inline void Profiler::writeChromeTrace(const fs::path& filepath) const
+    {
+        std::ofstream file(filepath);
+        if (!file.is_open()) {
+            throw std::runtime_error("Could not open trace file for writing: " + filepath.string());
+        }
+
+        auto escape = [](const char* name) {
+            std::string escaped;
+            for (const char* c = name; *c != '\0'; ++c) {
+                if (*c == '"' || *c == '\\') {
+                    escaped += '\\';
+                }
+                escaped += *c;
+            }
+            return escaped;
+        };
+
+        file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        file << std::fixed << std::setprecision(3);
+
+        bool first = true;
+        for (const ProfileEvent& event : this->getEvents()) {
+            if (!first) {
+                file << ",\n";
+            }
+            first = false;
+
+            // Chrome trace timestamps are in microseconds:
+            file << "{\"name\":\"" << escape(event.name) << "\",\"cat\":\"vira\",\"ph\":\"X\""
+                << ",\"ts\":" << static_cast<double>(event.start_ns) * 1e-3
+                << ",\"dur\":" << static_cast<double>(event.duration_ns) * 1e-3
+                << ",\"pid\":1,\"tid\":" << event.thread
+                << ",\"args\":{\"depth\":" << event.depth << "}}";
+        }
+
+        file << "\n]}\n";
+    };
+
+
+
+    // =================== //
+    // === ProfileZone === //
+    // =================== //
+    inline ProfileZone::ProfileZone(const char* name)
+    {
+        Profiler& profiler = Profiler::get();
+        if (profiler.isEnabled()) {
+            name_ = name;
+            start_ns_ = profiler.now();
+            depth()++;
+        }
+    };
+
+    inline ProfileZone::~ProfileZone()
+    {
+        if (name_ != nullptr) {
+            Profiler& profiler = Profiler::get();
+            uint32_t zone_depth = --depth();
+            profiler.record(name_, start_ns_, profiler.now(), zone_depth);
+        }
+    };
+
+    inline uint32_t& ProfileZone::depth()
+    {
+        thread_local uint32_t zone_depth = 0;
+        return zone_depth;
+    };
+};
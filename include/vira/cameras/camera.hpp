@@ -3,6 +3,7 @@
 
 #include <memory>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <functional>
 #include <random>
@@ -32,6 +33,11 @@ namespace vira {
         template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
         class Group;
     }
+
+    namespace quipu {
+        template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+        class SceneSnapshot;
+    }
 }
 
 namespace vira::cameras {
@@ -62,6 +68,7 @@ namespace vira::cameras {
 
         // Initialization:
         void initialize();
+        bool isInitialized() const { return !needs_initialization_ && (!psf_ || psf_->isInitialized()); } ///< Returns whether initialize() is up to date
 
         // Generic Processing Settings:
         void enableParallelInitialization(bool parallel_initialization = true);
@@ -123,6 +130,7 @@ namespace vira::cameras {
         bool hasPSF() const { return (psf_ != nullptr) ? true : false; } ///< Returns whether a PSF has been defined
         void setCustomPSF(std::unique_ptr<PointSpreadFunction<TSpectral, TFloat>> custom_psf);
         PointSpreadFunction<TSpectral, TFloat>& psf();
+        const PointSpreadFunction<TSpectral, TFloat>& psf() const;
 
         void setDefaultAiryDiskPSF();
         void setDefaultGaussianPSF();
@@ -145,6 +153,9 @@ namespace vira::cameras {
         void setCustomNoiseModel(std::unique_ptr<NoiseModel> custom_noise_model);
         NoiseModel& noiseModel();
 
+        void setSeed(uint32_t seed) { rng_seed_ = seed; } ///< Sets the seed from which sensor noise streams are derived
+        uint32_t getSeed() const { return rng_seed_; } ///< Returns the seed from which sensor noise streams are derived
+
         void setDefaultLowNoise();
         void setDefaultFixedPatternNoise();
 
@@ -179,17 +190,18 @@ namespace vira::cameras {
 
         float computeMinimumDetectableIrradiance() const;
 
-        vira::images::Image<TSpectral> getPhotonCounts(const vira::images::Image<TSpectral>& received_power) const;
-        vira::images::Image<ColorRGB> getPhotonCountsRGB(const vira::images::Image<TSpectral>& received_power) const;
+        vira::images::Image<TSpectral> getPhotonCounts(const vira::images::Image<TSpectral>& received_power, uint64_t stream = 0) const;
+        vira::images::Image<ColorRGB> getPhotonCountsRGB(const vira::images::Image<TSpectral>& received_power, uint64_t stream = 0) const;
 
-        vira::images::Image<float> simulateSensor(const vira::images::Image<TSpectral>& total_power_image) const;
-        vira::images::Image<ColorRGB> simulateSensorRGB(const vira::images::Image<TSpectral>& total_power_image) const;
+        vira::images::Image<float> simulateSensor(const vira::images::Image<TSpectral>& total_power_image, uint64_t stream = 0) const;
+        vira::images::Image<ColorRGB> simulateSensorRGB(const vira::images::Image<TSpectral>& total_power_image, uint64_t stream = 0) const;
 
         // Geometry Computations:
         mat4<TFloat> getViewMatrix() const { return inverse(this->getGlobalTransformationMatrix()); } ///< Returns a mat4 View Matrix
         mat3<TFloat> getViewNormalMatrix() const { return this->getGlobalRotation().getInverseMatrix(); } ///< Returns whether a mat3 View Normal Matrix
 
         bool behind(const vira::vec3<TFloat>& point) const;
+        TFloat boresightDistance(const vira::vec3<TFloat>& point) const;
         TFloat calculateGSD(TFloat distance) const;
         vira::vec2<TFloat> getFOV() const;
 
@@ -202,7 +214,8 @@ namespace vira::cameras {
 
     private:
         CameraID id_;
-        mutable std::mt19937 rng_{ std::random_device{}() };
+        uint32_t rng_seed_ = std::random_device{}();
+        std::mt19937 makeRNG(uint64_t stream, uint32_t component) const;
         bool needs_initialization_ = true;
 
         // Generic Processing Settings:
@@ -272,6 +285,8 @@ namespace vira::cameras {
         bool interpolate_directions_ = false;
         vira::images::Image<vec3<TFloat>> precomputed_pixel_directions_;
         vira::images::Image<float> pixel_solid_angle_;
+        bool restored_solid_angle_ = false; // pixel_solid_angle_ was restored from a SceneSnapshot
+        mat23<TFloat> restored_intrinsic_matrix_{ 0 };
         float z_dir_ = 1.f;
         vec2<float> pixel_size_;
         std::array<vec3<TFloat>, 8> frustum_corners_;
@@ -293,6 +308,7 @@ namespace vira::cameras {
         vec3<double> pixelToDirectionHelper_d(Pixel pixel) const;
 
         friend class vira::scene::Group<TSpectral, TFloat, TMeshFloat>;
+        friend class vira::quipu::SceneSnapshot<TSpectral, TFloat, TMeshFloat>;
     };
 }
 
@@ -34,9 +34,14 @@ namespace vira::cameras {
 
         vira::images::Image<TSpectral> makeKernel(int kernel_size, int supersample_factor = 0);
 
+        void initialize();
+        bool isInitialized() const { return initialized_kernels_; } ///< Returns whether the pre-computed kernels have been built
+
         vira::images::Image<TSpectral> getKernel(TSpectral received_power = TSpectral{ 0 }, float minimum_power = 0);
+        vira::images::Image<TSpectral> getKernel(TSpectral received_power = TSpectral{ 0 }, float minimum_power = 0) const;
 
         vira::images::Image<TSpectral> getResponse(TSpectral received_power, float minimum_power);
+        vira::images::Image<TSpectral> getResponse(TSpectral received_power, float minimum_power) const;
 
     protected:
         int supersample_step_ = 1;
@@ -0,0 +1,42 @@
+#ifndef VIRA_GEOMETRY_ANALYTIC_ELLIPSOID_HPP
+#define VIRA_GEOMETRY_ANALYTIC_ELLIPSOID_HPP
+
+#include "vira/vec.hpp"
+#include "vira/math.hpp"
+#include "vira/constraints.hpp"
+#include "vira/spectral_data.hpp"
+#include "vira/geometry/vertex.hpp"
+#include "vira/rendering/ray.hpp"
+
+namespace vira::geometry {
+    /**
+     * @brief Closed-form triaxial ellipsoid primitive
+     *
+     * Represents the surface x^2/a^2 + y^2/b^2 + z^2/c^2 = 1 in the local frame of a Mesh, with the
+     * z-axis as the polar axis.  Rays are intersected analytically, so distant bodies can be rendered
+     * without tessellation.  Surface points are parameterized by their parametric (reduced) longitude
+     * and latitude, and texture coordinates follow the same equirectangular convention as makeUVSphere().
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    struct AnalyticEllipsoid {
+        vec3<TMeshFloat> radii{ 1 }; ///< Semi-axes along the local x, y, and z axes
+
+        AnalyticEllipsoid() = default;
+        AnalyticEllipsoid(TMeshFloat radius);
+        AnalyticEllipsoid(TMeshFloat equatorial_radius, TMeshFloat polar_radius);
+        AnalyticEllipsoid(vec3<TMeshFloat> new_radii);
+
+        bool intersect(const vec3<TMeshFloat>& origin, const vec3<TMeshFloat>& direction, TMeshFloat t_min, TMeshFloat t_max, TMeshFloat& t, vec2<TMeshFloat>& angles) const;
+        void intersect(vira::rendering::Ray<TSpectral, TMeshFloat>& ray, void* mesh_ptr = nullptr) const;
+
+        Vertex<TSpectral, TMeshFloat> surfaceVertex(const vec2<TMeshFloat>& angles) const;
+        void setInteraction(vira::rendering::Interaction<TSpectral, TMeshFloat>& hit, const vec2<TMeshFloat>& angles) const;
+
+        vec3<TMeshFloat> getMin() const { return -radii; }
+        vec3<TMeshFloat> getMax() const { return radii; }
+    };
+};
+
+#include "implementation/geometry/analytic_ellipsoid.ipp"
+
+#endif
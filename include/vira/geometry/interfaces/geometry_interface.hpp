@@ -7,11 +7,16 @@
 
 #include "vira/constraints.hpp"
 #include "vira/spectral_data.hpp"
+#include "vira/geometry/vertex.hpp"
 #include "vira/geometry/interfaces/load_result.hpp"
+#include "vira/quipu/mesh_quipu.hpp"
+#include "vira/geometry/mesh_simplification.hpp"
 
 namespace fs = std::filesystem;
 
 // Forward Declare:
+struct aiScene;
+
 namespace vira {
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     class Scene;
@@ -23,6 +28,9 @@ namespace vira {
 }
 
 namespace vira::geometry {
+    // Maximum number of DSK vertices or plates read per CSPICE call:
+    constexpr int DSK_READ_BLOCK_SIZE = 100000;
+
     /**
      * @brief Interface for loading and saving 3D geometry data with spectral rendering support.
      *
@@ -46,6 +54,8 @@ namespace vira::geometry {
      * - Configurable RGB-to-spectral color conversion functions
      * - Group-based geometry saving functionality
      * - DSK-specific albedo configuration for material properties
+     * - Optional binary mesh caching (MeshQuipu) of converted geometry
+     * - Optional automatic LoD pyramid generation for loaded meshes
      *
      * @note The LesserFloat<TFloat, TMeshFloat> constraint ensures that mesh data maintains
      *       higher numerical precision than general scene calculations.
@@ -71,6 +81,10 @@ namespace vira::geometry {
         // DSK-specific options
         void setDSKAlbedo(const TSpectral& albedo);
 
+        // Mesh cache options
+        void setMeshCacheDirectory(const fs::path& directory);
+        void setGenerateLoDs(bool enable, LoDPyramidOptions options = LoDPyramidOptions{});
+
     private:
         // Format detection
         std::string detectFormat(const fs::path& filepath, const std::string& requested_format);
@@ -78,6 +92,10 @@ namespace vira::geometry {
         // Format-specific loaders
         LoadedMeshes<TFloat> loadWithAssimp(vira::Scene<TSpectral, TFloat, TMeshFloat>& scene, const fs::path& filepath);
         LoadedMeshes<TFloat> loadDSK(vira::Scene<TSpectral, TFloat, TMeshFloat>& scene, const fs::path& filepath);
+        LoadedMeshes<TFloat> addMeshData(vira::Scene<TSpectral, TFloat, TMeshFloat>& scene, const fs::path& basePath, vira::quipu::MeshQuipuData<TSpectral, TMeshFloat>& data, const aiScene* ai_scene);
+        void attachLoDs(vira::Scene<TSpectral, TFloat, TMeshFloat>& scene, const LoadedMeshes<TFloat>& loaded_meshes, const fs::path& filepath, uint64_t sourceKey);
+        uint64_t rgbToSpectralKey() const;
+        void readDSKBuffers(const fs::path& filepath, VertexBuffer<TSpectral, TMeshFloat>& vertexBuffer, IndexBuffer& indexBuffer, std::string& meshName);
 
         // Configuration
         std::function<TSpectral(ColorRGB)> rgbToSpectral_function = rgbToSpectral_val<TSpectral>;
@@ -85,6 +103,11 @@ namespace vira::geometry {
 
         // DSK-specific settings
         TSpectral dsk_albedo = TSpectral{ 0.03 };
+
+        // Mesh cache settings
+        fs::path mesh_cache_directory = "";
+        bool generate_lods = false;
+        LoDPyramidOptions lod_options{};
     };
 }
 
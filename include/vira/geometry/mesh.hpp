@@ -3,9 +3,11 @@
 
 #include <memory>
 #include <vector>
+#include <array>
 #include <cstdint>
 #include <limits>
 #include <algorithm> 
+#include <filesystem>
 
 #include "embree3/rtcore.h"
 
@@ -13,12 +15,18 @@
 #include "vira/spectral_data.hpp"
 #include "vira/constraints.hpp"
 #include "vira/geometry/triangle.hpp"
+#include "vira/geometry/triangle_cluster.hpp"
+#include "vira/geometry/analytic_ellipsoid.hpp"
 #include "vira/geometry/vertex.hpp"
+#include "vira/geometry/quantization.hpp"
 #include "vira/materials/material.hpp"
 #include "vira/rendering/acceleration/aabb.hpp"
 #include "vira/rendering/acceleration/blas.hpp"
 #include "vira/quipu/dem_quipu.hpp"
+#include "vira/quipu/mesh_quipu.hpp"
+#include "vira/geometry/mesh_simplification.hpp"
 #include "vira/scene/ids.hpp"
+#include "vira/utils/memory_usage.hpp"
 
 // Forward Declaration:
 namespace vira {
@@ -36,6 +44,11 @@ namespace vira::geometry {
     class GeometryInterface;
 }
 
+namespace vira::quipu {
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    class SceneSnapshot;
+}
+
 namespace vira::geometry {
     /**
      * @brief Represents a 3D mesh with vertices, indices, materials, and rendering optimizations.
@@ -52,9 +65,11 @@ namespace vira::geometry {
      * - Multiple construction methods supporting standard geometry, material-mapped geometry, and DEM data
      * - Flexible material system with per-face material assignment and runtime material management
      * - Geometric operations including transformations, normal calculation, and center computation
-     * - Adaptive level-of-detail through Ground Sample Distance (GSD) control
+     * - Adaptive level-of-detail through Ground Sample Distance (GSD) control, using either a DEM Quipu
+     *   or an automatically simplified LoD pyramid stored in a Mesh Quipu
      * - Bounding Volume Hierarchy (BVH) acceleration structure support for ray tracing
      * - Triangle mesh representation with smooth/flat shading options
+     * - Analytic ellipsoid representation (no triangles) for distant planets and moons
      * - Integration with DEM Quipu system for terrain data
      * - Axis-Aligned Bounding Box (AABB) computation for spatial queries
      *
@@ -79,11 +94,15 @@ namespace vira::geometry {
         Mesh(VertexBuffer<TSpectral, TMeshFloat> vertexBuffer, IndexBuffer indexBuffer);
         Mesh(VertexBuffer<TSpectral, TMeshFloat> vertexBuffer, IndexBuffer indexBuffer, std::vector<MaterialID::ValueType> materialIndices);
         Mesh(vira::quipu::DEMQuipu<TSpectral, TFloat, TMeshFloat> quipu);
+        Mesh(AnalyticEllipsoid<TSpectral, TMeshFloat> ellipsoid);
 
         Mesh(const Mesh&) = delete;
         Mesh& operator=(const Mesh&) = delete;
 
         void updateGSD(float targetGSD);
+        void generateLoDs(fs::path filepath, uint64_t sourceKey = 0, LoDPyramidOptions options = LoDPyramidOptions{});
+        void loadLoDs(const fs::path& filepath);
+        bool hasLoDs() const { return hasLoDs_; }
         float getDefaultGSD();
         float getGSD();
         Normal getNormal();
@@ -92,6 +111,10 @@ namespace vira::geometry {
         void setSmoothShading(bool smoothShading);
         bool getSmoothShading() const { return smoothShading; }
 
+        void setCompactStorage(bool compactStorage);
+        bool getCompactStorage() const { return compactStorage_; }
+        bool isCompact() const { return compact_; } ///< Returns whether the resident buffers are currently compact (see setCompactStorage())
+
         void constructTriangles();
         void calculateNormals();
         vec3<TMeshFloat> calculateCenter();
@@ -103,7 +126,9 @@ namespace vira::geometry {
         void applyScale(TMeshFloat scale);
 
         const VertexBuffer<TSpectral, TMeshFloat>& getVertexBuffer() const { return vertexBuffer; }
-        const IndexBuffer& getIndexBuffer() const { return indexBuffer; }
+        const IndexBuffer& getIndexBuffer() const { return indexBuffer; } ///< Returns the 32-bit index buffer (empty while the mesh is compact)
+        const IndexBuffer16& getIndexBuffer16() const { return indexBuffer16; } ///< Returns the 16-bit index buffer (empty unless the mesh is compact)
+        IndexBuffer getIndices() const;
 
         std::vector<TSpectral> getAlbedos() const;
 
@@ -114,17 +139,26 @@ namespace vira::geometry {
         size_t getMaterialCount() const { return material_cache_.size(); }
 
         size_t getVertexCount() const { return static_cast<size_t>(vertexBuffer.size()); }
-        size_t getIndexCount() const { return static_cast<size_t>(indexBuffer.size()); }
+        size_t getIndexCount() const { return 3 * numTriangles; }
         size_t getNumTriangles() const { return numTriangles; }
 
-        const std::vector<Triangle<TSpectral, TMeshFloat>>& getTriangles() const { return triangles; }
-        const Triangle<TSpectral, TMeshFloat>& getTriangle(size_t index) const { return triangles[index]; }
+        const std::vector<Triangle<TSpectral, TMeshFloat>>& getTriangles() const { return triangles; } ///< Returns the pre-constructed triangles (empty while the mesh is compact)
+        const Triangle<TSpectral, TMeshFloat>& getTriangle(size_t index) const { return triangles[index]; } ///< Returns a pre-constructed triangle (the mesh must not be compact)
+        const Triangle<TSpectral, TMeshFloat>& getTriangle(size_t index, Triangle<TSpectral, TMeshFloat>& scratch) const;
+        std::array<vec3<TMeshFloat>, 3> getTrianglePositions(size_t index) const;
+        void intersectTriangle(vira::rendering::Ray<TSpectral, TMeshFloat>& ray, size_t index, void* mesh_ptr) const;
+        const std::vector<TriangleCluster<TMeshFloat>>& getClusters() const { return clusters; }
+        const std::vector<uint32_t>& getClusterOrder() const { return clusterOrder; }
 
         void buildBVH(RTCDevice device, vira::rendering::BVHBuildOptions bvhBuildOptions);
         void buildBVH(vira::rendering::BVHBuildOptions bvhBuildOptions);
         vira::rendering::AABB<TSpectral, TFloat> getAABB();
 
+        vira::utils::MemoryUsage getMemoryUsage() const;
+
         bool hasQuipu() { return hasQuipu_; }
+        bool isAnalytic() const { return isAnalytic_; }
+        const AnalyticEllipsoid<TSpectral, TMeshFloat>& getAnalyticEllipsoid() const { return analyticEllipsoid_; }
         fs::path getQuipuFilepath() { return quipu.getFilepath(); }
 
         const MeshID& getID() const { return id_; }
@@ -135,9 +169,26 @@ namespace vira::geometry {
         VertexBuffer<TSpectral, TMeshFloat> vertexBuffer;
         IndexBuffer indexBuffer;
 
+        // Compact storage (replaces indexBuffer and the pre-constructed triangles of eligible meshes):
+        bool compactStorage_ = false;
+        bool compact_ = false;
+        IndexBuffer16 indexBuffer16;
+        std::vector<uint16_t> quantizedPositions;
+        PositionQuantization positionQuantization{};
+        void compact();
+        void expand();
+        void buildTriangleCache();
+
         bool hasQuipu_ = false;
         vira::quipu::DEMQuipu<TSpectral, TFloat, TMeshFloat> quipu{};
 
+        bool hasLoDs_ = false;
+        size_t currentLoD = 0;
+        vira::quipu::MeshQuipu<TSpectral, TMeshFloat> lodQuipu{};
+
+        bool isAnalytic_ = false;
+        AnalyticEllipsoid<TSpectral, TMeshFloat> analyticEllipsoid_{};
+
         void deviceFreed();
         std::unique_ptr<vira::rendering::BLAS<TSpectral, TFloat, TMeshFloat>> bvh;
 
@@ -146,6 +197,8 @@ namespace vira::geometry {
 
         size_t numTriangles = 0;
         std::vector<Triangle<TSpectral, TMeshFloat>> triangles;
+        std::vector<TriangleCluster<TMeshFloat>> clusters;
+        std::vector<uint32_t> clusterOrder;
 
         vira::rendering::AABB<TSpectral, TFloat> aabb;
 
@@ -167,6 +220,7 @@ namespace vira::geometry {
         friend class vira::rendering::CPURasterizer<TSpectral, TFloat, TMeshFloat>;
 
         friend class vira::geometry::GeometryInterface<TSpectral, TFloat, TMeshFloat>;
+        friend class vira::quipu::SceneSnapshot<TSpectral, TFloat, TMeshFloat>;
     };
 };
 
@@ -0,0 +1,57 @@
+#ifndef VIRA_GEOMETRY_MESH_SIMPLIFICATION_HPP
+#define VIRA_GEOMETRY_MESH_SIMPLIFICATION_HPP
+
+#include <vector>
+#include <cstddef>
+#include <filesystem>
+
+#include "vira/vec.hpp"
+#include "vira/constraints.hpp"
+#include "vira/spectral_data.hpp"
+#include "vira/geometry/vertex.hpp"
+#include "vira/scene/ids.hpp"
+#include "vira/quipu/mesh_quipu.hpp"
+
+namespace fs = std::filesystem;
+
+namespace vira::geometry {
+    struct MeshSimplificationOptions {
+        float boundary_weight = 100.f; ///< Weight of the constraint planes which preserve open boundaries and material seams
+        bool prevent_flips = true;     ///< Reject collapses which would flip the orientation of a neighboring face
+    };
+
+    struct LoDPyramidOptions {
+        float reduction = 0.25f;         ///< Fraction of triangles retained from one level to the next
+        size_t min_triangles = 256;      ///< Stop generating levels once a level has fewer triangles than this
+        size_t max_levels = 16;          ///< Maximum number of levels (including the full resolution level)
+        bool quantize_positions = false; ///< Store the pyramid file with 16-bit quantized positions (lossy, decoded to full precision when swapped in)
+        bool compact_storage = false;    ///< Keep eligible levels resident with 16-bit indices and quantized positions (see Mesh::setCompactStorage())
+
+        MeshSimplificationOptions simplification{};
+    };
+
+    /**
+     * @brief Buffers describing a single (possibly simplified) triangle mesh
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    struct SimplifiedMesh {
+        VertexBuffer<TSpectral, TMeshFloat> vertexBuffer;
+        IndexBuffer indexBuffer;
+        std::vector<MaterialID::ValueType> materialIndices;
+    };
+
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    SimplifiedMesh<TSpectral, TMeshFloat> simplifyMesh(const VertexBuffer<TSpectral, TMeshFloat>& vertexBuffer, const IndexBuffer& indexBuffer,
+        const std::vector<MaterialID::ValueType>& materialIndices, size_t target_triangles, MeshSimplificationOptions options = MeshSimplificationOptions{});
+
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    float estimateMeshGSD(const VertexBuffer<TSpectral, TMeshFloat>& vertexBuffer, const IndexBuffer& indexBuffer);
+
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    std::vector<vira::quipu::MeshQuipuEntry<TSpectral, TMeshFloat>> buildLoDPyramid(const VertexBuffer<TSpectral, TMeshFloat>& vertexBuffer, const IndexBuffer& indexBuffer,
+        const std::vector<MaterialID::ValueType>& materialIndices, LoDPyramidOptions options = LoDPyramidOptions{});
+};
+
+#include "implementation/geometry/mesh_simplification.ipp"
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef VIRA_GEOMETRY_QUANTIZATION_HPP
+#define VIRA_GEOMETRY_QUANTIZATION_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+
+#include "vira/vec.hpp"
+#include "vira/constraints.hpp"
+#include "vira/spectral_data.hpp"
+#include "vira/geometry/vertex.hpp"
+
+namespace vira::geometry {
+    /**
+     * @brief A vector of 16-bit indices used to construct triangles
+     *
+     * Used to store index buffers of meshes with at most 65536 vertices (such as the coarser levels of a
+     * LoD pyramid) at half the size of an IndexBuffer, both in a MeshQuipu and in the resident buffers of
+     * a Mesh using compact storage (see Mesh::setCompactStorage()).
+     */
+    typedef std::vector<uint16_t> IndexBuffer16;
+
+    // Largest quantized coordinate (the maximum value is reserved to encode non-finite positions):
+    constexpr uint16_t QUANTIZED_POSITION_MAX = std::numeric_limits<uint16_t>::max() - 1;
+
+    /**
+     * @brief Mapping between quantized and decoded vertex positions
+     *
+     * A quantized coordinate q decodes to origin + scale * q (per axis).
+     */
+    struct PositionQuantization {
+        vec3<double> origin{ 0 };
+        vec3<double> scale{ 1 };
+    };
+
+    inline bool fitsIndexBuffer16(size_t vertexCount);
+    inline IndexBuffer16 narrowIndexBuffer(const IndexBuffer& indexBuffer);
+    inline IndexBuffer widenIndexBuffer(const IndexBuffer16& indexBuffer16);
+
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    PositionQuantization computePositionQuantization(const VertexBuffer<TSpectral, TMeshFloat>& vertexBuffer);
+
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    std::vector<uint16_t> quantizePositions(const VertexBuffer<TSpectral, TMeshFloat>& vertexBuffer, const PositionQuantization& quantization);
+
+    template <IsFloat TMeshFloat>
+    vec3<TMeshFloat> dequantizePosition(const uint16_t* quantized, const PositionQuantization& quantization);
+
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    void dequantizePositions(const std::vector<uint16_t>& quantized, const PositionQuantization& quantization, VertexBuffer<TSpectral, TMeshFloat>& vertexBuffer);
+};
+
+#include "implementation/geometry/quantization.ipp"
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef VIRA_GEOMETRY_TRIANGLE_CLUSTER_HPP
+#define VIRA_GEOMETRY_TRIANGLE_CLUSTER_HPP
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include "vira/math.hpp"
+#include "vira/vec.hpp"
+#include "vira/constraints.hpp"
+#include "vira/geometry/triangle.hpp"
+
+namespace vira::geometry {
+    // Default number of triangles grouped into a single cluster:
+    constexpr size_t DEFAULT_CLUSTER_SIZE = 64;
+
+    /**
+     * @brief Bounds of a contiguous range of triangles used for coarse visibility tests
+     *
+     * Stores a bounding sphere and a normal cone (axis and half-angle) which bound the positions
+     * and face normals of all triangles in the range [first_triangle, first_triangle + triangle_count)
+     * of a triangle ordering (see buildTriangleClusters()).
+     */
+    template <IsFloat TMeshFloat>
+    struct TriangleCluster {
+        size_t first_triangle = 0;
+        size_t triangle_count = 0;
+
+        vec3<TMeshFloat> center{ 0 };
+        TMeshFloat radius = 0;
+
+        vec3<float> cone_axis{ 0 };
+        float cone_angle = PI<float>(); ///< Half-angle of the normal cone (radians)
+    };
+
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    std::vector<uint32_t> spatialTriangleOrder(const std::vector<Triangle<TSpectral, TMeshFloat>>& triangles);
+
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    std::vector<TriangleCluster<TMeshFloat>> buildTriangleClusters(const std::vector<Triangle<TSpectral, TMeshFloat>>& triangles, const std::vector<uint32_t>& order, size_t cluster_size = DEFAULT_CLUSTER_SIZE);
+
+    template <IsFloat T>
+    bool normalConeBackfacing(const vec3<float>& cone_axis, float cone_angle, const vec3<T>& center, T radius, const vec3<T>& view_position);
+};
+
+#include "implementation/geometry/triangle_cluster.ipp"
+
+#endif
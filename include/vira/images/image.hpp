@@ -78,6 +78,7 @@ namespace vira::images {
         // Getters:
         void* data() { return data_.data(); }
         size_t size() const { return data_.size(); }
+        size_t getMemoryUsage() const { return data_.capacity() * sizeof(T) + alpha_.capacity() * sizeof(float); }
         Resolution resolution() { return resolution_; }
         Resolution resolution() const { return resolution_; }
         const std::vector<T>& getVector() const { return data_; }
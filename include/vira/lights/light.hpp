@@ -55,7 +55,7 @@ namespace vira::lights {
         LightID id_{};
         
         void onReferenceFrameChanged() override {
-            this->template getScenePtr<TSpectral, TMeshFloat>()->markDirty();
+            this->template getScenePtr<TSpectral, TMeshFloat>()->markModified();
         }
 
         friend class vira::scene::Group<TSpectral, TFloat, TMeshFloat>;
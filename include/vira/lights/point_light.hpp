@@ -24,6 +24,8 @@ namespace vira::lights {
 
         LightType getType() const override { return POINT_LIGHT; }
 
+        TSpectral getSpectralIntensity() const { return spectralIntensity; }
+
     private:
         TSpectral spectralIntensity{ 0 };
     };
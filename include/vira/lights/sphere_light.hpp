@@ -24,6 +24,9 @@ namespace vira::lights {
 
         LightType getType() const override { return SPHERE_LIGHT; }
 
+        TFloat getRadius() const { return radius; }
+        TSpectral getSpectralRadiance() const { return spectralRadiance; }
+
     private:
         TFloat radius;
         TSpectral spectralRadiance;
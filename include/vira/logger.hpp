@@ -1,8 +1,16 @@
 #ifndef VIRA_LOGGER_HPP
 #define VIRA_LOGGER_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <exception>
 
 namespace vira {
     class CrashLogger {
@@ -32,15 +40,94 @@ namespace vira {
 
         static bool is_initialized();
 
+        // Asynchronous logging:
+        static void enable_async(size_t queue_capacity = 8192);
+        static void disable_async();
+        static bool is_async();
+        static void flush();
+        static size_t dropped_count();
+
+        // Rate limiting of repeated events and warnings:
+        static void set_rate_limit(size_t max_per_window, std::chrono::milliseconds window = std::chrono::seconds(1));
+
     private:
+        static constexpr size_t MAX_ENTRY_LENGTH = 496; // Longer queued lines are truncated
+
+        /**
+         * @brief Bounded multi-producer, multi-consumer queue of formatted log lines
+         * @details Producers never block or take a lock: a full queue rejects the line instead.  Lines are
+         *          formatted before they are pushed, and stored in preallocated fixed-size cells, so popping
+         *          never allocates.  This allows the crash handlers to drain the queue without the log mutex.
+         */
+        class EntryQueue {
+        public:
+            explicit EntryQueue(size_t capacity);
+
+            bool push(const std::string& line);
+            bool pop(char* buffer, size_t& length);
+
+        private:
+            struct Cell {
+                std::atomic<size_t> sequence{ 0 };
+                size_t length = 0;
+                char text[MAX_ENTRY_LENGTH];
+            };
+
+            std::vector<Cell> cells_;
+            size_t mask_;
+
+            alignas(64) std::atomic<size_t> enqueue_pos_{ 0 };
+            alignas(64) std::atomic<size_t> dequeue_pos_{ 0 };
+        };
+
+        struct AsyncState {
+            std::mutex control; // Serializes enabling and disabling
+            std::unique_ptr<EntryQueue> queue;
+            std::thread writer;
+            std::atomic<bool> enabled{ false };
+            std::atomic<bool> running{ false };
+            std::atomic<size_t> dropped{ 0 };
+
+            // Log file descriptor opened up front, so the crash handlers only need write():
+            std::atomic<int> crash_fd{ -1 };
+
+            // Handlers replaced by install_crash_handlers():
+            std::terminate_handler previous_terminate = nullptr;
+            void (*previous_signals[4])(int) = { nullptr, nullptr, nullptr, nullptr };
+        };
+
+        struct RateSlot {
+            std::atomic<size_t> key{ 0 };
+            std::atomic<int64_t> window{ -1 };
+            std::atomic<uint32_t> count{ 0 };
+            std::atomic<uint32_t> suppressed{ 0 };
+        };
+
+        struct RateLimit {
+            std::atomic<size_t> max_per_window{ 0 }; // 0 disables rate limiting
+            std::atomic<int64_t> window_ms{ 1000 };
+            RateSlot slots[256];
+        };
+
         static std::string get_default_log_filename();
         static void ensure_initialized();
         static void initialize_internal(const std::string& log_file_path, size_t max_file_size_mb);
-        static void log_internal(Level level, const std::string& message);
-        static void write_log(const std::string& message);
-        static std::string format_message(Level level, const std::string& message);
+        static void log_internal(Level level, const std::string& message, const std::string& key);
+        static void write_entries(const std::vector<std::string>& lines);
+        static std::string format_message(Level level, std::chrono::system_clock::time_point time, const std::string& message);
         static void cleanup_on_exit();
 
+        static bool should_log(const std::string& key, uint32_t& suppressed);
+        static void collect_queued(std::vector<std::string>& lines);
+        static void writer_loop();
+        static void stop_writer();
+        static void flush_for_crash();
+        static void write_raw(int fd, const char* data, size_t size);
+        static void close_crash_fd();
+        static void install_crash_handlers();
+        static void crash_signal_handler(int signal);
+        static void crash_terminate_handler();
+
         template<typename... Args>
         static std::string format_string(const std::string& format, Args&&... args);
 
@@ -49,9 +136,11 @@ namespace vira {
         static bool& get_graceful_shutdown_flag();
         static std::string& get_log_file_path();
         static std::mutex& get_log_mutex();
+        static AsyncState& get_async_state();
+        static RateLimit& get_rate_limit();
     };
 }
 
 #include "implementation/logger.ipp"
 
-#endif
\ No newline at end of file
+#endif
@@ -1,6 +1,7 @@
 #ifndef VIRA_MATERIALS_MATERIAL_HPP
 #define VIRA_MATERIALS_MATERIAL_HPP
 
+#include <cstddef>
 #include <random>
 
 #include "vira/vec.hpp"
@@ -67,6 +68,8 @@ namespace vira::materials {
 
         const MaterialID& getID() { return id_; }
 
+        size_t getMemoryUsage() const;
+
     protected:
 
         vira::images::Image<TSpectral> albedoMap = vira::images::Image<TSpectral>(vira::images::Resolution{ 1,1 }, TSpectral{ 1.f });
@@ -49,6 +49,8 @@ namespace vira::quipu {
         VIRA_TRANSFORM_STATE = 2000,
         VIRA_DEM = 2001,
         VIRA_DEM_PYRAMID = 2002,
+        VIRA_MESH = 2003,
+        VIRA_SCENE_SNAPSHOT = 2004,
 
 
         // Error Codes (>65000)
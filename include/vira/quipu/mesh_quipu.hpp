@@ -0,0 +1,192 @@
+#ifndef VIRA_QUIPU_MESH_QUIPU_HPP
+#define VIRA_QUIPU_MESH_QUIPU_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "vira/vec.hpp"
+#include "vira/spectral_data.hpp"
+#include "vira/constraints.hpp"
+#include "vira/geometry/vertex.hpp"
+#include "vira/scene/ids.hpp"
+#include "vira/quipu/class_ids.hpp"
+
+namespace fs = std::filesystem;
+
+namespace vira::quipu {
+    // Incremented whenever the MeshQuipu layout changes (older caches are then treated as stale):
+    constexpr uint16_t MESH_QUIPU_VERSION = 5;
+
+    struct MeshQuipuWriterOptions {
+        bool compress = false;           ///< LZ4 compress the vertex and index buffers
+        bool quantize_positions = false; ///< Store vertex positions as 16-bit coordinates relative to the mesh bounds (lossy, decoded on read)
+    };
+
+    /**
+     * @brief Description of a material as referenced by a source file
+     *
+     * Rather than serializing fully constructed materials (and their textures), a MeshQuipu stores the
+     * parameters and texture paths needed to reconstruct them.  Texture paths are relative to the
+     * directory of the source file.
+     */
+    struct MaterialReference {
+        std::string name;
+
+        float metalness = 0.f;
+        float roughness = 0.5f;
+
+        bool hasDiffuseColor = false;
+        ColorRGB diffuseColor{ 1.f };
+        ColorRGB emissionColor{ 0.f };
+
+        std::string diffuseTexture;
+        std::string normalTexture;
+        std::string roughnessTexture;
+        std::string metalnessTexture;
+        std::string emissionTexture;
+    };
+
+    /**
+     * @brief Size and modification time of a file, other than the source file, that a MeshQuipu was built from
+     *
+     * Some files are only discovered while the source file is loaded (such as the material library of an
+     * OBJ file), so cannot be included in the source key.  Their stamps are stored in the MeshQuipu instead,
+     * and a cache is only valid while every dependency still matches its stamp.
+     */
+    struct MeshQuipuDependency {
+        std::string path; ///< Absolute path of the file
+        uint64_t fileSize = 0;
+        int64_t writeTime = 0;
+    };
+
+    /**
+     * @brief A single mesh as stored within a MeshQuipu
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    struct MeshQuipuEntry {
+        std::string name;
+        vira::geometry::VertexBuffer<TSpectral, TMeshFloat> vertexBuffer;
+        vira::geometry::IndexBuffer indexBuffer;
+        std::vector<vira::MaterialID::ValueType> materialIndices;
+
+        std::vector<uint32_t> materialReferences; ///< Indices into MeshQuipuData::materials for each local material index
+        bool smoothShading = false;
+
+        float gsd = 0.f; ///< Representative edge length (used to select between levels of a LoD pyramid)
+    };
+
+    /**
+     * @brief A node of the source file hierarchy as stored within a MeshQuipu
+     */
+    struct MeshQuipuNode {
+        std::string name;
+        mat4<double> localTransform{ 1 };
+        std::vector<uint64_t> meshIndices;
+        std::vector<uint64_t> children;
+        uint64_t parent = std::numeric_limits<uint64_t>::max();
+    };
+
+    /**
+     * @brief Complete contents of a MeshQuipu
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    struct MeshQuipuData {
+        std::vector<MaterialReference> materials;
+        std::vector<MeshQuipuEntry<TSpectral, TMeshFloat>> meshes;
+        std::vector<MeshQuipuNode> nodes;
+        uint64_t rootNode = 0;
+
+        std::vector<MeshQuipuDependency> dependencies; ///< Files other than the source file which the data was built from
+    };
+
+    /**
+     * @brief Binary cache of fully constructed mesh buffers
+     *
+     * A MeshQuipu (.qms) stores vertex and index buffers exactly as they are laid out in memory so that
+     * expensive source formats (DSK, Assimp supported formats, etc.) only need to be parsed once.  Each file
+     * is tagged with a source key, which is computed from the original file and any options which influence
+     * the loaded buffers, and which is used to detect stale caches.
+     *
+     * A table of contents records the GSD and file offset of every mesh, so a single mesh can be read without
+     * reading the rest of the file.  This allows a MeshQuipu to also store a level-of-detail pyramid, where
+     * each mesh is one level of the same geometry, ordered from finest to coarsest.
+     *
+     * Files are written to a temporary path and renamed into place once complete, and the header records
+     * the total file size, so an interrupted or truncated write is never accepted as a valid cache.
+     *
+     * Meshes with at most 65536 vertices (such as coarse LoD levels) store their indices as 16-bit values,
+     * and positions may optionally be quantized to 16-bit coordinates.  Both are decoded on read, so the
+     * returned buffers always have the same layout as those which were written.  These encodings therefore
+     * only reduce the file size and the I/O needed to load it; a loaded mesh is only kept in the compact
+     * layout if its compact storage is enabled (see Mesh::setCompactStorage()).
+     */
+    template <IsSpectral TSpectral, IsFloat TMeshFloat>
+    class MeshQuipu {
+    public:
+        MeshQuipu() = default;
+        MeshQuipu(const fs::path& newFilepath);
+
+        MeshQuipuData<TSpectral, TMeshFloat> read() const;
+        MeshQuipuEntry<TSpectral, TMeshFloat> readMesh(size_t index) const;
+
+        uint64_t getSourceKey() const { return sourceKey; }
+        uint64_t getFileSize() const { return fileSize; }
+        size_t getNumberOfMeshes() const { return numberOfMeshes; }
+        const std::vector<float>& getGSDs() const { return gsds; }
+        const std::vector<MeshQuipuDependency>& getDependencies() const { return dependencies; }
+        bool isCompatible() const;
+
+        const fs::path& getFilepath() const { return filepath; }
+
+        // Cache helpers:
+        static uint64_t computeSourceKey(const fs::path& sourceFile, uint64_t flags = 0, uint64_t conversionKey = 0);
+        static fs::path cachePath(const fs::path& cacheDirectory, const fs::path& sourceFile, uint64_t sourceKey);
+        static bool isValidCache(const fs::path& filepath, uint64_t sourceKey);
+        static MeshQuipuDependency stampDependency(const fs::path& dependency);
+        static bool isCurrent(const MeshQuipuDependency& dependency);
+
+        // Write methods:
+        static void write(fs::path filepath, const MeshQuipuData<TSpectral, TMeshFloat>& data, uint64_t sourceKey, MeshQuipuWriterOptions options = MeshQuipuWriterOptions{});
+
+    private:
+        fs::path filepath = "";
+
+        // Header details read from file:
+        ViraClassID classID = VIRA_UNDEFINED;
+        uint16_t version = 0;
+        uint64_t sourceKey = 0;
+        uint64_t fileSize = 0;
+        ViraClassID precisionID = VIRA_UNDEFINED;
+        uint32_t spectralSize = 0;
+        uint32_t vertexSize = 0;
+        uint32_t numberOfMaterials = 0;
+        uint32_t numberOfMeshes = 0;
+        uint32_t numberOfNodes = 0;
+        uint64_t rootNode = 0;
+
+        std::vector<MeshQuipuDependency> dependencies;
+
+        std::vector<float> gsds;
+        std::vector<uint64_t> offsets;
+
+        size_t headerSize = 0;
+
+        static size_t writeArray(std::ofstream& file, const char* buffer, size_t bufferSize, bool compress);
+        static void readArray(std::ifstream& file, char* buffer, size_t bufferSize);
+
+        static void writeEntry(std::ofstream& file, const MeshQuipuEntry<TSpectral, TMeshFloat>& mesh, const MeshQuipuWriterOptions& options);
+        static void readEntry(std::ifstream& file, MeshQuipuEntry<TSpectral, TMeshFloat>& mesh);
+
+        static size_t writeMaterialReference(std::ofstream& file, const MaterialReference& material);
+        static void readMaterialReference(std::ifstream& file, MaterialReference& material);
+    };
+};
+
+#include "implementation/quipu/mesh_quipu.ipp"
+
+#endif
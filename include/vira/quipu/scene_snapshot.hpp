@@ -0,0 +1,118 @@
+#ifndef VIRA_QUIPU_SCENE_SNAPSHOT_HPP
+#define VIRA_QUIPU_SCENE_SNAPSHOT_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <fstream>
+#include <filesystem>
+#include <limits>
+#include <string>
+
+#include "vira/vec.hpp"
+#include "vira/spectral_data.hpp"
+#include "vira/constraints.hpp"
+#include "vira/reference_frame.hpp"
+#include "vira/images/image.hpp"
+#include "vira/materials/material.hpp"
+#include "vira/lights/light.hpp"
+#include "vira/cameras/camera.hpp"
+#include "vira/utils/mapped_file.hpp"
+#include "vira/quipu/class_ids.hpp"
+
+namespace fs = std::filesystem;
+
+// Forward Declaration:
+namespace vira {
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    class Scene;
+}
+
+namespace vira::quipu {
+    // Incremented whenever the SceneSnapshot layout changes:
+    constexpr uint16_t SCENE_SNAPSHOT_VERSION = 2;
+
+    // Alignment (relative to the start of the file) of every bulk array, so it can be viewed in place once mapped:
+    constexpr size_t SCENE_SNAPSHOT_ALIGNMENT = 64;
+
+    struct SceneSnapshotOptions {
+        bool store_blas = true;          ///< Store built (double precision) BVHs so they are not rebuilt on load
+        bool store_camera_tables = true; ///< Store the precomputed per-pixel solid angle table of each camera
+    };
+
+    /**
+     * @brief Binary snapshot of a complete Scene
+     *
+     * A SceneSnapshot (.qss) stores everything needed to reconstruct a Scene without re-parsing its sources:
+     * the material table (including texture maps), every mesh, the scene graph (groups, instances, lights,
+     * unresolved objects, and cameras, with their local states and SPICE configuration), camera intrinsics,
+     * and the global scene settings.
+     *
+     * Meshes built from buffers are stored inline, together with their built BVH when one is available.  Meshes
+     * backed by a DEM Quipu or a LoD pyramid store a reference to that file instead, and analytic ellipsoids
+     * store only their radii.  Objects are referenced by table index rather than by ID, so a snapshot can be
+     * loaded into any Scene and is given freshly allocated IDs.
+     *
+     * Every bulk array (vertex, index, and BVH buffers, textures, and camera tables) is aligned within the file,
+     * and snapshots are read through a memory mapping, so loading consists of copying arrays directly from the
+     * OS page cache into the reconstructed objects.
+     *
+     * @note Custom (user supplied) photosites, apertures, PSFs, distortion models, noise models, and material
+     *       types cannot be serialized.  Cameras revert to their default models, and unknown materials are
+     *       replaced by the scene's default material.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    class SceneSnapshot {
+    public:
+        static void write(const fs::path& filepath, Scene<TSpectral, TFloat, TMeshFloat>& scene, SceneSnapshotOptions options = SceneSnapshotOptions{});
+        static void load(const fs::path& filepath, Scene<TSpectral, TFloat, TMeshFloat>& scene);
+
+    private:
+        static constexpr uint32_t NO_INDEX = std::numeric_limits<uint32_t>::max();
+
+        enum SnapshotMaterialType : uint8_t {
+            SNAPSHOT_LAMBERTIAN = 0,
+            SNAPSHOT_MCEWEN = 1,
+            SNAPSHOT_PBR = 2
+        };
+
+        enum SnapshotMeshType : uint8_t {
+            SNAPSHOT_BUFFER_MESH = 0,
+            SNAPSHOT_DEM_MESH = 1,
+            SNAPSHOT_ELLIPSOID_MESH = 2
+        };
+
+        // Aligned bulk array I/O:
+        static void pad(std::ofstream& file);
+
+        template <typename T>
+        static void writeArray(std::ofstream& file, const T* values, size_t count);
+
+        template <typename T>
+        static const T* viewArray(vira::utils::MappedFileReader& reader, size_t& count);
+
+        template <typename T>
+        static void writeSnapshotImage(std::ofstream& file, const vira::images::Image<T>& image);
+
+        template <typename T>
+        static void readSnapshotImage(vira::utils::MappedFileReader& reader, vira::images::Image<T>& image);
+
+        // Reference frame states:
+        static void writeFrame(std::ofstream& file, const ReferenceFrame<TFloat>& frame);
+        static void readFrame(vira::utils::MappedFileReader& reader, ReferenceFrame<TFloat>& frame);
+
+        // Scene contents:
+        static void writeMaterial(std::ofstream& file, materials::Material<TSpectral>& material, uint8_t type);
+        static std::unique_ptr<materials::Material<TSpectral>> readMaterial(vira::utils::MappedFileReader& reader);
+
+        static void writeCamera(std::ofstream& file, const cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, const SceneSnapshotOptions& options);
+        static void readCamera(vira::utils::MappedFileReader& reader, cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera);
+
+        static void writeLight(std::ofstream& file, const lights::Light<TSpectral, TFloat, TMeshFloat>& light);
+        static std::unique_ptr<lights::Light<TSpectral, TFloat, TMeshFloat>> readLight(vira::utils::MappedFileReader& reader);
+    };
+};
+
+#include "implementation/quipu/scene_snapshot.ipp"
+
+#endif
@@ -18,6 +18,9 @@ namespace vira {
         class Group;
     }
 
+    template <IsFloat TFloat>
+    class ReferenceFrameHierarchy;
+
     /**
      * @brief Class representing ReferenceFrame information
      *
@@ -169,7 +172,7 @@ namespace vira {
                 throw std::runtime_error("Attempted to confiugre SPICE Frame/Object when the root Scene is not a configured SPICE frame");
             }
         }
-        void updateSPICEStates(double et);
+        void computeLocalSPICEStates(double et);
 
         // Local states:
         mat4<TFloat> local_transformation_{ 1 };
@@ -207,6 +210,8 @@ namespace vira {
         template <IsSpectral TSpectral, IsFloat TFloat2, IsFloat TMeshFloat> requires LesserFloat<TFloat2, TMeshFloat>
         friend class Scene;
 
+        friend class ReferenceFrameHierarchy<TFloat>;
+
         // SPICE Information:
         std::string naif_name_ = "";
         std::string frame_name_ = "";
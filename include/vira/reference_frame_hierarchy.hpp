@@ -0,0 +1,69 @@
+#ifndef VIRA_REFERENCE_FRAME_HIERARCHY_HPP
+#define VIRA_REFERENCE_FRAME_HIERARCHY_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+
+#include "vira/vec.hpp"
+#include "vira/constraints.hpp"
+#include "vira/reference_frame.hpp"
+
+namespace vira {
+    /**
+     * @brief Flattened, breadth-first ordered view of a tree of ReferenceFrames
+     *
+     * Global transformations and velocities are propagated one depth level at a time over structure-of-arrays
+     * storage, so each frame is computed at most once per update (rather than once per changed ancestor, as
+     * with the recursive ReferenceFrame updates), and the frames of a level are updated in parallel.  Only
+     * frames which were marked dirty, or which have a dirty ancestor, are recomputed; static subtrees are
+     * skipped.
+     *
+     * @tparam TFloat Precision Type (float or double)
+     */
+    template <IsFloat TFloat>
+    class ReferenceFrameHierarchy {
+    public:
+        static constexpr uint32_t NO_PARENT = std::numeric_limits<uint32_t>::max();
+
+        ReferenceFrameHierarchy() = default;
+
+        void clear();
+        uint32_t addFrame(ReferenceFrame<TFloat>* frame, uint32_t parent = NO_PARENT);
+
+        void markDirty(uint32_t index) { dirty_[index] = 1; }
+        void updateSPICE(double et);
+        void update();
+
+        size_t size() const { return frames_.size(); }
+        bool empty() const { return frames_.empty(); }
+
+        ReferenceFrame<TFloat>* getFrame(uint32_t index) const { return frames_[index]; }
+        const std::vector<uint32_t>& getUpdatedFrames() const { return updated_; }
+
+    private:
+        // Topology (breadth-first order, so parents always precede their children):
+        std::vector<ReferenceFrame<TFloat>*> frames_;
+        std::vector<uint32_t> parents_;
+        std::vector<uint32_t> depths_;
+        std::vector<uint32_t> level_offsets_;
+        std::vector<uint32_t> spice_frames_;
+
+        // Global states of the frames updated by the current pass:
+        std::vector<mat4<TFloat>> global_transformations_;
+        std::vector<vec3<TFloat>> global_positions_;
+        std::vector<vec3<TFloat>> global_velocities_;
+        std::vector<vec3<TFloat>> global_angular_rates_;
+
+        std::vector<uint8_t> dirty_;
+        std::vector<uint8_t> changed_;
+        std::vector<uint32_t> updated_;
+
+        void updateFrame(uint32_t index);
+    };
+};
+
+#include "implementation/reference_frame_hierarchy.ipp"
+
+#endif
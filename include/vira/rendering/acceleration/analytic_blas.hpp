@@ -0,0 +1,36 @@
+#ifndef VIRA_RENDERING_ACCELERATION_ANALYTIC_BLAS_HPP
+#define VIRA_RENDERING_ACCELERATION_ANALYTIC_BLAS_HPP
+
+#include "vira/constraints.hpp"
+#include "vira/rendering/ray.hpp"
+#include "vira/rendering/acceleration/aabb.hpp"
+#include "vira/rendering/acceleration/blas.hpp"
+
+// Forward Declare:
+namespace vira::geometry {
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    class Mesh;
+};
+
+namespace vira::rendering {
+    /**
+     * @brief BLAS for meshes represented by an analytic primitive rather than triangles
+     *
+     * A single closed-form primitive needs no hierarchy, so the BLAS intersects it directly.  This allows
+     * analytic meshes to be instanced within a ViraTLAS exactly as triangle meshes are.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    class AnalyticBLAS : public BLAS<TSpectral, TFloat, TMeshFloat> {
+    public:
+        AnalyticBLAS() = default;
+        AnalyticBLAS(vira::geometry::Mesh<TSpectral, TFloat, TMeshFloat>* newMesh, BVHBuildOptions buildOptions);
+
+        void intersect(Ray<TSpectral, TMeshFloat>& ray) override;
+
+        AABB<TSpectral, TFloat> getAABB() override;
+    };
+};
+
+#include "implementation/rendering/acceleration/analytic_blas.ipp"
+
+#endif
@@ -1,6 +1,8 @@
 #ifndef VIRA_RENDERING_ACCELERATION_BLAS_HPP
 #define VIRA_RENDERING_ACCELERATION_BLAS_HPP
 
+#include <cstddef>
+
 #include "vira/constraints.hpp"
 #include "vira/rendering/ray.hpp"
 #include "vira/rendering/acceleration/aabb.hpp"
@@ -15,6 +17,8 @@ namespace vira::geometry {
 namespace vira::rendering {
     struct BVHBuildOptions {
         EmbreeOptions embree_options{};
+
+        bool cluster_leaves = true; ///< Build the upper levels of a ViraBLAS over the mesh's triangle clusters
     };
 
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
@@ -26,6 +30,9 @@ namespace vira::rendering {
 
         virtual AABB<TSpectral, TFloat> getAABB() = 0;
 
+        // Bytes held by the hierarchy (Embree allocations are measured by the Scene instead):
+        virtual size_t getMemoryUsage() const { return 0; }
+
     protected:
         vira::geometry::Mesh<TSpectral, TFloat, TMeshFloat>* mesh = nullptr;
         void* mesh_ptr = nullptr;
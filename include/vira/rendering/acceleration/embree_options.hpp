@@ -2,6 +2,8 @@
 #define VIRA_RENDERING_ACCELERATION_EMBREE_OPTIONS_HPP
 
 #include <cstddef>
+#include <cstdint>
+#include <atomic>
 #include <concepts>
 
 // TODO REMOVE THIRD PARTY HEADERS:
@@ -50,6 +52,40 @@ namespace vira::rendering {
             rtcIntersect16(valid, scene, context, rayhit);
         }
     };
+
+
+    /**
+     * @brief Tracks the bytes currently allocated by an Embree device
+     * @details Embree reports every allocation and release to the monitor, including those made by its
+     *          internal build threads, so the count is exact (rather than estimated from the geometry).
+     */
+    class EmbreeMemoryMonitor {
+    public:
+        EmbreeMemoryMonitor() = default;
+
+        EmbreeMemoryMonitor(const EmbreeMemoryMonitor&) = delete;
+        EmbreeMemoryMonitor& operator=(const EmbreeMemoryMonitor&) = delete;
+
+        void attach(RTCDevice device)
+        {
+            bytes_.store(0, std::memory_order_relaxed);
+            rtcSetDeviceMemoryMonitorFunction(device, &EmbreeMemoryMonitor::monitor, this);
+        }
+
+        void reset() { bytes_.store(0, std::memory_order_relaxed); }
+
+        int64_t bytes() const { return bytes_.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<int64_t> bytes_{ 0 };
+
+        static bool monitor(void* user_ptr, ssize_t bytes, bool post)
+        {
+            (void)post;
+            static_cast<EmbreeMemoryMonitor*>(user_ptr)->bytes_.fetch_add(static_cast<int64_t>(bytes), std::memory_order_relaxed);
+            return true; // Never deny an allocation
+        }
+    };
 }
 
 #endif
\ No newline at end of file
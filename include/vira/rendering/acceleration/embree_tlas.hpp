@@ -4,6 +4,7 @@
 #include <vector>
 #include <cstddef>
 #include <array>
+#include <unordered_map>
 
 #include "vira/spectral_data.hpp"
 #include "vira/rendering/acceleration/tlas.hpp"
@@ -39,8 +40,12 @@ namespace vira::rendering {
 
         void init() override;
 
+        bool updateInstances(const std::vector<const vira::scene::Instance<TSpectral, float, float>*>& instances) override;
+
         void intersect(Ray<TSpectral, float>& ray) override;
 
+        size_t getMemoryUsage() const override;
+
         template <size_t N> requires ValidPacketSize<N>
         void intersectPacket(std::array<Ray<TSpectral, float>, N>& rayPacket);
 
@@ -49,6 +54,9 @@ namespace vira::rendering {
         thread_local static RTCIntersectContext context_;
 
         std::vector<InstanceMeshData<TSpectral>> instance_array_;
+        std::unordered_map<const vira::scene::Instance<TSpectral, float, float>*, unsigned int> instance_geometry_ids_;
+
+        static void setInstanceTransform(RTCGeometry rtc_instance, const vira::scene::Instance<TSpectral, float, float>* instance);
     };
 };
 
@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <memory>
+#include <cstddef>
 #include <cstdint>
 
 #include "vira/constraints.hpp"
@@ -13,6 +14,9 @@
 namespace vira::scene {
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     class Scene;
+
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    class Instance;
 };
 
 namespace vira::rendering {
@@ -25,6 +29,12 @@ namespace vira::rendering {
 
         virtual void init() {}
 
+        // Refits the TLAS after the given instances have moved.  Returns false if a rebuild is required instead.
+        virtual bool updateInstances(const std::vector<const vira::scene::Instance<TSpectral, TFloat, TMeshFloat>*>& instances) { (void)instances; return false; }
+
+        // Bytes held by the hierarchy (Embree allocations are measured by the Scene instead):
+        virtual size_t getMemoryUsage() const { return 0; }
+
     protected:
         bool device_freed_ = false;
         friend class vira::Scene<TSpectral, TFloat, TMeshFloat>;
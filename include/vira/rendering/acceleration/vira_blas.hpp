@@ -34,6 +34,7 @@ namespace vira::rendering {
         ViraBLAS() = default;
 
         ViraBLAS(vira::geometry::Mesh<TSpectral, double, double>* newMesh, BVHBuildOptions buildOptions);
+        ViraBLAS(vira::geometry::Mesh<TSpectral, double, double>* newMesh, const ViraBLASNode<TSpectral>* nodes, size_t nodeCount, const size_t* triangleIndices);
 
         ~ViraBLAS() override;
 
@@ -43,6 +44,14 @@ namespace vira::rendering {
 
         AABB<TSpectral, double> getAABB() override;
 
+        size_t getMemoryUsage() const override;
+
+        // Access to the built hierarchy (for serialization):
+        size_t getNodeCount() const { return nodesUsed; }
+        const ViraBLASNode<TSpectral>* getNodes() const { return bvhNode; }
+        size_t getTriangleCount() const { return numTriangles; }
+        const size_t* getTriangleIndices() const { return triIdx; }
+
     private:
         struct Bin {
             AABB<TSpectral, double> bounds;
@@ -57,6 +66,11 @@ namespace vira::rendering {
 
 
         // Construction methods:
+        void buildFromClusters();
+        void subdivideClusters(size_t nodeIdx);
+        std::vector<AABB<TSpectral, double>> clusterBounds;
+        std::vector<size_t> clusterIdx;
+
         void updateNodeBounds(size_t nodeIdx);
 
         void subdivide(size_t nodeIdx);
@@ -66,6 +80,7 @@ namespace vira::rendering {
         double evaluateSAH(ViraBLASNode<TSpectral>& node, int axis, double pos);
 
         double calculateNodeCost(ViraBLASNode<TSpectral>& node);
+        vec3<double> triangleCentroid(size_t index) const; ///< Matches Triangle::centroid, without assembling the triangle
     };
 };
 
@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <memory>
+#include <cstddef>
 #include <cstdint>
 
 #include "vira/constraints.hpp"
@@ -29,6 +30,8 @@ namespace vira::rendering {
         ViraTLAS(std::vector<TLASLeaf<TSpectral, double, TMeshFloat>> leafList);
         void intersect(Ray<TSpectral, double>& ray) override;
 
+        size_t getMemoryUsage() const override;
+
         size_t findBestMatch(size_t* list, size_t N, size_t A);
 
     private:
@@ -13,7 +13,11 @@
 #include "vira/cameras/camera.hpp"
 #include "vira/rendering/acceleration/tlas.hpp"
 #include "vira/rendering/passes.hpp"
+#include "vira/rendering/visibility_buffer.hpp"
+#include "vira/rendering/shadow_map.hpp"
 #include "vira/rendering/cpu_denoise.hpp"
+#include "vira/rendering/render_control.hpp"
+#include "vira/rendering/ray_statistics.hpp"
 
 // Forward Declare:
 namespace vira::scene {
@@ -40,6 +44,15 @@ namespace vira::rendering {
         size_t samples_per_batch = 30;
         float sampling_tolerance = 0.05f;
         size_t samples_to_detect_miss = 30;
+
+        bool raster_primary = false; ///< Resolve primary visibility with the CPURasterizer, tracing only the pixels it cannot resolve, shadow rays, and indirect rays
+        bool validate_raster_primary = false; ///< Also trace primary rays, reporting (and correcting) pixels where the two disagree
+
+        bool shadow_cache = false; ///< Query shadow maps of distant lights (reused across frames) instead of tracing their shadow rays (ignored if the scene has analytic meshes)
+        float shadow_cache_tolerance = 0.05f; ///< Change in a distant light direction (degrees) which invalidates its cached shadow map
+        ShadowMapOptions shadow_cache_maps{ 4096 }; ///< Resolution, filtering, and bias of the cached shadow maps
+
+        bool collect_statistics = false; ///< Count rays, traversal steps, and samples per pixel into CPUPathTracer::statistics
     };
 
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
@@ -48,6 +61,7 @@ namespace vira::rendering {
         CPUPathTracer() = default;
 
         void render(vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, vira::Scene<TSpectral, TFloat, TMeshFloat>& Scene);
+        void render(const vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, const vira::Scene<TSpectral, TFloat, TMeshFloat>& Scene);
 
         CPUPathTracerOptions options;
 
@@ -56,13 +70,30 @@ namespace vira::rendering {
 
         EATWTOptions denoiserOptions{};
 
+        // Cancellation, progress, and partial results (optional):
+        std::shared_ptr<RenderControl> control = nullptr;
+        vira::rendering::RenderPasses<TSpectral, TFloat> snapshotPasses();
+
+        // Set if the most recent render was cancelled before every pixel was traced:
+        bool partial = false;
+
+        // Ray-tracing statistics of the most recent render (if options.collect_statistics is set):
+        RayStatistics statistics{};
+
     private:
+        VisibilityBuffer<TSpectral, TFloat, TMeshFloat> visibility_buffer_{};
+        SceneShadowMaps<TSpectral, TFloat, TMeshFloat> shadow_cache_{};
+
+        void rasterizePrimaryVisibility(const cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, const vira::Scene<TSpectral, TFloat, TMeshFloat>& scene);
+        bool resolvePrimaryHit(Ray<TSpectral, TFloat>& ray, int i, int j);
+        bool intersectVisibility(Ray<TSpectral, TFloat>& ray, const VisibilitySample<TSpectral, TFloat, TMeshFloat>& sample);
+
         // Path-tracer methods:
-        TSpectral unidirectional(cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, vira::Scene<TSpectral, TFloat, TMeshFloat>& scene, 
+        TSpectral unidirectional(const cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, const vira::Scene<TSpectral, TFloat, TMeshFloat>& scene, 
             DataPayload<TSpectral, TFloat>& dataPayload, std::mt19937& rng, std::uniform_real_distribution<float>& dist);
 
-        TSpectral simulatePath(cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, vira::Scene<TSpectral, TFloat, TMeshFloat>& scene, Ray<TSpectral, TFloat>& ray, DataPayload<TSpectral, TFloat>& dataPayload, std::mt19937& rng, std::uniform_real_distribution<float>& dist);
-        TSpectral processIntersection(cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, vira::Scene<TSpectral, TFloat, TMeshFloat>& scene, Ray<TSpectral, TFloat>& ray, DataPayload<TSpectral, TFloat>& dataPayload, std::mt19937& rng, std::uniform_real_distribution<float>& dist);
+        TSpectral simulatePath(const cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, const vira::Scene<TSpectral, TFloat, TMeshFloat>& scene, Ray<TSpectral, TFloat>& ray, DataPayload<TSpectral, TFloat>& dataPayload, std::mt19937& rng, std::uniform_real_distribution<float>& dist);
+        TSpectral processIntersection(const cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, const vira::Scene<TSpectral, TFloat, TMeshFloat>& scene, Ray<TSpectral, TFloat>& ray, DataPayload<TSpectral, TFloat>& dataPayload, std::mt19937& rng, std::uniform_real_distribution<float>& dist);
         
         float PowerHeuristic(int numf, float fPdf, int numg, float gPdf);
 
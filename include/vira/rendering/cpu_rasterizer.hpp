@@ -9,6 +9,10 @@
 #include "vira/constraints.hpp"
 #include "vira/cameras/camera.hpp"
 #include "vira/rendering/passes.hpp"
+#include "vira/rendering/acceleration/obb.hpp"
+#include "vira/rendering/tiled_rasterization.hpp"
+#include "vira/rendering/visibility_buffer.hpp"
+#include "vira/rendering/shadow_map.hpp"
 
 namespace vira::scene {
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
@@ -18,7 +22,19 @@ namespace vira::scene {
 namespace vira::rendering {
     // Rasterizer options:
     struct CPURasterizerOptions {
-        
+        bool hierarchical_depth = true; ///< Reject occluded blocks using a per-block conservative depth buffer
+        bool frustum_culling = true; ///< Skip instances and triangle clusters whose bounds lie outside of the view frustum
+
+        // Triangles are rasterized double-sided, so facing-based culling is opt-in and only safe for geometry that is never seen from behind:
+        bool normal_cone_culling = false; ///< Skip instances whose normal cone faces entirely away from the camera
+        bool backface_culling = false; ///< Skip triangle clusters which face entirely away from the camera
+
+        double near_plane = 0.001; ///< Distance in front of the camera at which triangles are clipped
+
+        bool save_visibility = false; ///< Record the visible instance, triangle, and barycentric coordinates of each pixel (marking pixels covered by analytic or clipped geometry as unresolved)
+
+        bool shadows = true; ///< Render a shadow map for each light (only used when simulating lighting)
+        ShadowMapOptions shadow_maps{}; ///< Shadow map resolution, filtering, and bias
     };
 
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
@@ -27,13 +43,19 @@ namespace vira::rendering {
         CPURasterizer(CPURasterizerOptions options = CPURasterizerOptions{});
 
         void render(vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, vira::Scene<TSpectral, TFloat, TMeshFloat>& Scene);
+        void render(const vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, const vira::Scene<TSpectral, TFloat, TMeshFloat>& Scene);
 
         CPURasterizerOptions options;
 
         // Render output settings:
         vira::rendering::RenderPasses<TSpectral, TFloat> renderPasses{};
+        vira::rendering::VisibilityBuffer<TSpectral, TFloat, TMeshFloat> visibilityBuffer{};
 
     private:
+        HierarchicalDepthBuffer hierarchical_depth_{};
+        SceneShadowMaps<TSpectral, TFloat, TMeshFloat> shadow_maps_{};
+
+        void markUnresolvedBounds(const vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, const OBB<TFloat>& obb);
         bool inFrame(Pixel& point, vira::images::Resolution& resolution);
     };
 };
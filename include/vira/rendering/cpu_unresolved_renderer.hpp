@@ -27,6 +27,8 @@ namespace vira::rendering {
     template <IsSpectral TSpectral>
     struct UnresolvedPasses {
         vira::images::Image<TSpectral> unresolved_power;
+
+        size_t getMemoryUsage() const { return unresolved_power.getMemoryUsage(); }
     };
 
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
@@ -35,6 +37,7 @@ namespace vira::rendering {
         CPUUnresolvedRenderer(CPUUnresolvedRendererOptions options = CPUUnresolvedRendererOptions{});
 
         void render(vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, vira::Scene<TSpectral, TFloat, TMeshFloat>& scene);
+        void render(const vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, const vira::Scene<TSpectral, TFloat, TMeshFloat>& scene);
 
         CPUUnresolvedRendererOptions options;
 
@@ -42,7 +45,7 @@ namespace vira::rendering {
 
     private:
         std::vector<ProjectedPoint<TSpectral>> findPointsInRegion(const vira::images::ROI& roi, const vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, const std::vector<vira::vec3<TFloat>>& vectors, const std::vector<TSpectral>& irradiances, float minimumPower);
-        void processRegion(const vira::images::ROI& roi, vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, const std::vector<vira::vec3<TFloat>>& vectors, const std::vector<TSpectral>& irradiances, float minimumPower);
+        void processRegion(const vira::images::ROI& roi, const vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, const std::vector<vira::vec3<TFloat>>& vectors, const std::vector<TSpectral>& irradiances, float minimumPower);
 
     };
 }
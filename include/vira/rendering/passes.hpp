@@ -86,6 +86,8 @@ namespace vira::rendering {
 
 
 
+        size_t getMemoryUsage() const;
+
         // ====================== //
         // === Update Methods === //
         // ====================== //
@@ -18,6 +18,9 @@ namespace vira::geometry {
 
     template <IsSpectral TSpectral, IsFloat TFloat>
     struct Triangle;
+
+    template <IsSpectral TSpectral, IsFloat TFloat>
+    struct AnalyticEllipsoid;
 };
 
 namespace vira::scene {
@@ -80,6 +83,7 @@ namespace vira::rendering {
         friend class CPURasterizer;
 
         friend struct vira::geometry::Triangle<TSpectral, TFloat>;
+        friend struct vira::geometry::AnalyticEllipsoid<TSpectral, TFloat>;
         friend class EmbreeBLAS<TSpectral, TFloat>;
         friend class EmbreeTLAS<TSpectral>;
     };
@@ -0,0 +1,91 @@
+#ifndef VIRA_RENDERING_RAY_STATISTICS_HPP
+#define VIRA_RENDERING_RAY_STATISTICS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "tbb/enumerable_thread_specific.h"
+
+namespace vira::rendering {
+    struct RayCounters {
+        uint64_t primary_rays = 0;    ///< Camera rays traced through the scene
+        uint64_t visibility_hits = 0; ///< Camera rays resolved from the rasterized visibility buffer instead
+        uint64_t shadow_rays = 0;     ///< Light sampling (occlusion) rays
+        uint64_t indirect_rays = 0;   ///< Rays traced after the first bounce
+
+        uint64_t tlas_nodes = 0;      ///< TLAS nodes visited by software traversal
+        uint64_t blas_nodes = 0;      ///< BLAS nodes visited by software traversal
+        uint64_t triangle_tests = 0;  ///< Ray-triangle tests performed by software traversal
+        uint64_t embree_queries = 0;  ///< Rays traced by Embree (which does not expose its traversal counts)
+
+        uint64_t tracedRays() const { return primary_rays + shadow_rays + indirect_rays; }
+
+        RayCounters& operator+=(const RayCounters& other);
+    };
+
+    RayCounters*& activeRayCounters();
+
+    struct RayStatistics {
+        RayCounters totals{};
+        double trace_seconds = 0; ///< Wall-clock duration of the tracing stage
+
+        size_t pixels = 0;
+        std::vector<uint64_t> spp_histogram; ///< spp_histogram[n] is the number of pixels which took n samples
+
+        double raysPerSecond() const;
+        double primaryRaysPerSecond() const;
+        double shadowRaysPerSecond() const;
+        double indirectRaysPerSecond() const;
+
+        double nodesPerRay() const;
+        double trianglesPerRay() const;
+        double meanSamplesPerPixel() const;
+
+        std::string format() const;
+    };
+
+    /**
+     * @brief Gathers RayCounters and per-pixel sample counts from every thread of a render
+     *
+     * Each thread accumulates into its own counters, which are only combined by finish().  While a
+     * Scope is alive, the traversal code (ViraTLAS, ViraBLAS, and the Embree wrappers) adds to the
+     * calling thread's counters through activeRayCounters().  When no Scope is active the counters
+     * cost a single thread-local load per ray.
+     */
+    class RayStatisticsCollector {
+    public:
+        RayStatisticsCollector(size_t max_samples);
+
+        class Scope {
+        public:
+            explicit Scope(RayStatisticsCollector* collector);
+            ~Scope();
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+            void addPixel(size_t samples);
+
+        private:
+            RayCounters* previous_ = nullptr;
+            std::vector<uint64_t>* histogram_ = nullptr;
+        };
+
+        RayStatistics finish(double trace_seconds);
+
+    private:
+        struct LocalStatistics {
+            RayCounters counters{};
+            std::vector<uint64_t> spp_histogram;
+        };
+
+        size_t max_samples_;
+        tbb::enumerable_thread_specific<LocalStatistics> local_;
+    };
+};
+
+#include "implementation/rendering/ray_statistics.ipp"
+
+#endif
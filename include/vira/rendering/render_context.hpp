@@ -0,0 +1,33 @@
+#ifndef VIRA_RENDERING_RENDER_CONTEXT_HPP
+#define VIRA_RENDERING_RENDER_CONTEXT_HPP
+
+#include <cstdint>
+
+#include "vira/constraints.hpp"
+#include "vira/spectral_data.hpp"
+#include "vira/rendering/cpu_path_tracer.hpp"
+#include "vira/rendering/cpu_unresolved_renderer.hpp"
+
+namespace vira::rendering {
+    /**
+     * @brief Per-render mutable state, allowing a Scene to be rendered from several threads at once
+     *
+     * The renderers owned by a Scene store their output images, visibility buffers, and shadow caches as
+     * members, so two renders through them can not run at the same time.  A RenderContext owns its own
+     * renderers; passing a separate context to each concurrent call of Scene::render() keeps all state
+     * written during rendering out of the shared Scene.
+     *
+     * Contexts are typically created with Scene::newRenderContext(), which copies the Scene's renderer
+     * options.  Renders through a context only read the Scene and its cameras, which must first be
+     * prepared with Scene::prepareRender().
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    struct RenderContext {
+        CPUPathTracer<TSpectral, TFloat, TMeshFloat> pathtracer{};
+        CPUUnresolvedRenderer<TSpectral, TFloat, TMeshFloat> unresolvedRenderer{};
+
+        uint64_t sensor_stream = 0; ///< Sensor noise stream of the next render (incremented by each render through the context)
+    };
+};
+
+#endif
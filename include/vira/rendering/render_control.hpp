@@ -0,0 +1,82 @@
+#ifndef VIRA_RENDERING_RENDER_CONTROL_HPP
+#define VIRA_RENDERING_RENDER_CONTROL_HPP
+
+#include <cstddef>
+#include <atomic>
+#include <mutex>
+#include <functional>
+
+#include "tbb/spin_rw_mutex.h"
+
+namespace vira::rendering {
+    struct RenderProgress {
+        size_t pixels_done = 0;  ///< Pixels whose samples have all been traced
+        size_t total_pixels = 0; ///< Pixels in the image being rendered
+        size_t samples_done = 0; ///< Camera samples traced so far (varies per pixel with adaptive sampling)
+
+        float fraction() const { return (total_pixels == 0) ? 0.f : static_cast<float>(pixels_done) / static_cast<float>(total_pixels); }
+    };
+
+    /**
+     * @brief Handle for monitoring and stopping a render from another thread
+     *
+     * Attach a RenderControl to a renderer (e.g. `scene.pathtracer.control = control;`) before rendering.
+     * While the render runs, any thread may:
+     * - call cancel(), after which the renderer stops tracing new pixels and returns early,
+     * - poll getProgress(), or receive progress through a callback,
+     * - request a snapshot of the partially accumulated passes (e.g. CPUPathTracer::snapshotPasses()).
+     *
+     * Renderers accumulate a tile of pixels locally and publish it with a single writePixels() call, so
+     * snapshots see whole tiles. A cancelled render leaves its passes partially filled and reports this
+     * through the renderer (e.g. CPUPathTracer::partial); the Scene does not cache such a result.
+     *
+     * A control may be reused for several renders; each render resets its progress (but not a pending
+     * cancellation, which must be cleared with reset()).
+     */
+    class RenderControl {
+    public:
+        using ProgressCallback = std::function<void(const RenderProgress&)>;
+
+        RenderControl() = default;
+
+        RenderControl(const RenderControl&) = delete;
+        RenderControl& operator=(const RenderControl&) = delete;
+
+        // Cancellation:
+        void cancel() { cancelled_.store(true, std::memory_order_relaxed); }
+        bool isCancelled() const { return cancelled_.load(std::memory_order_relaxed); }
+        void reset();
+
+        // Progress reporting:
+        void setProgressCallback(ProgressCallback callback, float interval = 0.01f);
+        RenderProgress getProgress() const;
+
+        // Used by renderers:
+        void begin(size_t total_pixels);
+        void update(size_t pixels, size_t samples);
+
+        template <typename F>
+        void writePixels(F&& f);
+
+        template <typename F>
+        void accessPasses(F&& f);
+
+    private:
+        std::atomic<bool> cancelled_{ false };
+
+        std::atomic<size_t> pixels_done_{ 0 };
+        std::atomic<size_t> samples_done_{ 0 };
+        std::atomic<size_t> total_pixels_{ 0 };
+
+        ProgressCallback callback_ = nullptr;
+        float interval_ = 0.01f;
+        std::atomic<size_t> next_report_{ 0 };
+        std::mutex callback_mutex_;
+
+        tbb::spin_rw_mutex passes_mutex_;
+    };
+};
+
+#include "implementation/rendering/render_control.ipp"
+
+#endif
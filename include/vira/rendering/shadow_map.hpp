@@ -0,0 +1,151 @@
+#ifndef VIRA_RENDERING_SHADOW_MAP_HPP
+#define VIRA_RENDERING_SHADOW_MAP_HPP
+
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include "vira/math.hpp"
+#include "vira/vec.hpp"
+#include "vira/constraints.hpp"
+#include "vira/images/image.hpp"
+#include "vira/images/resolution.hpp"
+#include "vira/rendering/tiled_rasterization.hpp"
+
+// Forward Declaration:
+namespace vira {
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    class Scene;
+};
+
+namespace vira::cameras {
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    class Camera;
+};
+
+namespace vira::rendering {
+    // Shadow map options:
+    struct ShadowMapOptions {
+        int resolution = 2048; ///< Width and height of each shadow map (texels)
+        int pcf_radius = 1; ///< Half-width of the PCF kernel (texels, 0 disables filtering)
+        float bias = 1.5f; ///< Normal offset and depth tolerance of shadow lookups (texels)
+        float distant_light_ratio = 10.f; ///< Lights further than this multiple of the receiver radius use orthographic shadow maps
+        float receiver_margin = 0.25f; ///< Fraction by which each map extends beyond the receivers in view (allowing reuse as the view moves)
+        float caster_tolerance = 0.25f; ///< Displacement of a shadow caster (texels) below which the maps are reused
+    };
+
+    /**
+     * @brief Light-space depth map used to approximate shadowing from a single light
+     *
+     * The map covers a bounding sphere of the shadow receiving geometry.  Distant lights (such as the Sun)
+     * use an orthographic projection along the light direction, while nearby lights use a perspective
+     * projection from the light position.  Depths are written using the same tiled rasterizer as the
+     * CPURasterizer, and are queried with percentage-closer filtering (PCF).
+     */
+    template <IsFloat TFloat>
+    class ShadowMap {
+    public:
+        ShadowMap() = default;
+
+        void initialize(const vec3<TFloat>& light_position, const vec3<TFloat>& center, TFloat radius, int resolution, bool orthographic);
+
+        void rasterize(const std::array<vec3<TFloat>, 3>& points);
+
+        float visibility(const vec3<TFloat>& point, const vec3<float>& normal, int pcf_radius, float bias) const;
+        bool covers(const vec3<TFloat>& point) const;
+
+        bool project(const vec3<TFloat>& point, Pixel& pixel, float& depth) const;
+        float texelSize(float depth) const;
+
+        bool isValid() const { return valid_; }
+        bool isOrthographic() const { return orthographic_; }
+        const vec3<TFloat>& getDirection() const { return w_; }
+        const vira::images::Image<float>& getDepth() const { return depth_; }
+
+    private:
+        bool valid_ = false;
+        bool orthographic_ = true;
+        int resolution_ = 0;
+
+        vec3<TFloat> origin_{ 0 };
+        vec3<TFloat> center_{ 0 };
+        TFloat radius_ = 0;
+        TFloat tan_half_angle_ = 0;
+
+        // Light-space basis (w_ points from the light toward the geometry):
+        vec3<TFloat> u_{ 1, 0, 0 };
+        vec3<TFloat> v_{ 0, 1, 0 };
+        vec3<TFloat> w_{ 0, 0, 1 };
+
+        vira::images::Image<float> depth_;
+        HierarchicalDepthBuffer hierarchical_depth_{};
+    };
+
+    /**
+     * @brief The shadow maps of every light in a scene
+     *
+     * Each map is fitted to the receivers in view of the camera (the visible instances whose bounds
+     * intersect the view frustum), enlarged by ShadowMapOptions::receiver_margin.  Points outside of a
+     * map are not covered by it, and must be shadowed by other means.
+     *
+     * Maps are only re-rendered by update() when the receivers in view leave the maps, the options or
+     * the lights change, or the shadow casters change.  Casters are compared by mesh ID, LoD level, and
+     * instance transformation, where a transformation is considered unchanged while it displaces the
+     * caster by less than ShadowMapOptions::caster_tolerance texels.  Orthographic (distant light) maps
+     * are additionally allowed to be reused while the light direction remains within a tolerance of the
+     * direction the map was rendered with, which amortizes the cost of shadowing from the Sun over long
+     * image sequences.
+     *
+     * Only triangle meshes are drawn into the maps, so analytic meshes do not cast shadows through them.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    class SceneShadowMaps {
+    public:
+        SceneShadowMaps() = default;
+
+        bool update(const vira::Scene<TSpectral, TFloat, TMeshFloat>& scene, const vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera,
+            const ShadowMapOptions& options, bool distant_only = false, float tolerance = 0.f);
+        void build(const vira::Scene<TSpectral, TFloat, TMeshFloat>& scene, const vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera,
+            const ShadowMapOptions& options, bool distant_only = false);
+        void clear();
+
+        bool empty() const { return maps_.empty(); }
+        bool hasMap(size_t light_index) const { return light_index < maps_.size() && maps_[light_index].isValid(); }
+        const ShadowMap<TFloat>& getMap(size_t light_index) const { return maps_[light_index]; }
+
+        bool covers(size_t light_index, const vec3<TFloat>& point) const;
+        float visibility(size_t light_index, const vec3<TFloat>& point, const vec3<float>& normal) const;
+
+    private:
+        // State of a single shadow casting instance, used to detect when the maps must be re-rendered:
+        struct ShadowCaster {
+            uint64_t mesh_id = 0;
+            uint64_t instance_id = 0;
+            float gsd = 0; ///< Current GSD of the mesh (identifying its LoD level)
+            size_t triangle_count = 0;
+            TFloat radius = 0; ///< Distance of the furthest point of the mesh from its local origin
+            mat4<TFloat> transformation{ 1 };
+        };
+
+        ShadowMapOptions options_{};
+        bool distant_only_ = false;
+
+        std::vector<ShadowMap<TFloat>> maps_;
+        std::vector<vec3<TFloat>> light_positions_;
+        std::vector<ShadowCaster> casters_;
+        TFloat texel_size_ = 0;
+
+        vec3<TFloat> center_{ 0 };
+        TFloat radius_ = 0;
+
+        std::vector<ShadowCaster> collectCasters(const vira::Scene<TSpectral, TFloat, TMeshFloat>& scene) const;
+        bool castersChanged(const std::vector<ShadowCaster>& casters, TFloat tolerance) const;
+        bool computeReceiverBounds(const vira::Scene<TSpectral, TFloat, TMeshFloat>& scene, const vira::cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera,
+            vec3<TFloat>& center, TFloat& radius) const;
+    };
+};
+
+#include "implementation/rendering/shadow_map.ipp"
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef VIRA_RENDERING_TILED_RASTERIZATION_HPP
+#define VIRA_RENDERING_TILED_RASTERIZATION_HPP
+
+#include <array>
+#include <vector>
+#include <cstddef>
+
+#include "vira/vec.hpp"
+#include "vira/constraints.hpp"
+#include "vira/images/image.hpp"
+#include "vira/images/resolution.hpp"
+
+namespace vira::rendering {
+    // Width of a raster block (and number of SIMD lanes evaluated per row):
+    constexpr int RASTER_BLOCK_SIZE = 8;
+
+    /**
+     * @brief Edge function setup for a single projected triangle
+     *
+     * Each edge function is stored in its linear form E(x,y) = A*x + B*y + C, pre-scaled by
+     * the inverse of the triangle area so that evaluating the three edges directly yields the
+     * barycentric weights.  This allows incremental stepping (adding A per pixel in x and B
+     * per row in y) rather than re-evaluating the full edge function for every pixel.
+     */
+    struct TriangleSetup {
+        std::array<float, 3> A{};
+        std::array<float, 3> B{};
+        std::array<float, 3> C{};
+        std::array<float, 3> depth{};
+
+        float min_depth = 0;
+        bool degenerate = false;
+
+        TriangleSetup(const Pixel& p0, const Pixel& p1, const Pixel& p2, float d0, float d1, float d2);
+
+        float evaluate(size_t edge, float x, float y) const { return A[edge] * x + B[edge] * y + C[edge]; }
+    };
+
+    /**
+     * @brief Conservative per-block depth buffer used for early occlusion rejection
+     *
+     * Stores the farthest depth written within each RASTER_BLOCK_SIZE x RASTER_BLOCK_SIZE block
+     * of the full-resolution depth image.  Any triangle whose nearest depth is behind this value
+     * cannot contribute to the block and may be skipped without per-pixel work.
+     */
+    class HierarchicalDepthBuffer {
+    public:
+        HierarchicalDepthBuffer() = default;
+
+        void initialize(vira::images::Resolution resolution);
+
+        int blocksX() const { return blocks_x_; }
+        int blocksY() const { return blocks_y_; }
+
+        float getMaxDepth(int bx, int by) const { return max_depth_[static_cast<size_t>(by * blocks_x_ + bx)]; }
+        void update(const vira::images::Image<float>& depth, int bx, int by);
+
+    private:
+        int blocks_x_ = 0;
+        int blocks_y_ = 0;
+        vira::images::Resolution resolution_{};
+        std::vector<float> max_depth_;
+    };
+
+    /**
+     * @brief Vertex of a triangle which has been clipped against the near plane
+     */
+    template <IsFloat TFloat>
+    struct ClippedVertex {
+        vec3<TFloat> position{ 0, 0, 0 }; ///< Camera-space position of the vertex
+        std::array<float, 3> w{ 0, 0, 0 }; ///< Barycentric coordinates of the vertex within the unclipped triangle
+    };
+
+    template <IsFloat TFloat>
+    size_t clipNearPlane(const std::array<vec3<TFloat>, 3>& positions, const std::array<TFloat, 3>& distances, std::array<ClippedVertex<TFloat>, 4>& polygon);
+
+    template <typename TFragmentFunction>
+    void rasterizeTriangle(const TriangleSetup& setup, int startX, int startY, int stopX, int stopY,
+        vira::images::Image<float>& depth, HierarchicalDepthBuffer* hiz, TFragmentFunction&& fragment);
+};
+
+#include "implementation/rendering/tiled_rasterization.ipp"
+
+#endif
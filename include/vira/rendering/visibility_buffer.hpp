@@ -0,0 +1,75 @@
+#ifndef VIRA_RENDERING_VISIBILITY_BUFFER_HPP
+#define VIRA_RENDERING_VISIBILITY_BUFFER_HPP
+
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include "vira/constraints.hpp"
+#include "vira/images/resolution.hpp"
+
+// Forward Declaration:
+namespace vira::geometry {
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    class Mesh;
+};
+
+namespace vira::scene {
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    class Instance;
+};
+
+namespace vira::rendering {
+    /**
+     * @brief The surface visible through a single pixel, as recorded by the rasterizer
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    struct VisibilitySample {
+        vira::scene::Instance<TSpectral, TFloat, TMeshFloat>* instance = nullptr;
+        vira::geometry::Mesh<TSpectral, TFloat, TMeshFloat>* mesh = nullptr;
+
+        size_t triangle_index = 0;
+        std::array<float, 3> w{ 0, 0, 0 }; ///< Image-space barycentric coordinates of the pixel
+
+        bool hit() const { return instance != nullptr; }
+    };
+
+    /**
+     * @brief Per-pixel record of the visible instance, triangle, and barycentric coordinates
+     *
+     * Written by the CPURasterizer (when CPURasterizerOptions::save_visibility is enabled) and
+     * consumed by the CPUPathTracer to begin paths directly from the rasterized surface hits.
+     *
+     * Pixels which may be covered by geometry the rasterizer cannot resolve exactly (analytic meshes,
+     * and triangles clipped by the near plane) are marked as unresolved, and must be ray traced
+     * regardless of the recorded sample.
+     */
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    class VisibilityBuffer {
+    public:
+        VisibilityBuffer() = default;
+
+        void initialize(vira::images::Resolution resolution);
+        void clear() { samples_.clear(); unresolved_.clear(); resolution_ = vira::images::Resolution{}; }
+
+        bool empty() const { return samples_.empty(); }
+        vira::images::Resolution getResolution() const { return resolution_; }
+
+        VisibilitySample<TSpectral, TFloat, TMeshFloat>& operator() (int i, int j) { return samples_[static_cast<size_t>(j * resolution_.x + i)]; }
+        const VisibilitySample<TSpectral, TFloat, TMeshFloat>& operator() (int i, int j) const { return samples_[static_cast<size_t>(j * resolution_.x + i)]; }
+
+        void markUnresolved(int i, int j) { unresolved_[static_cast<size_t>(j * resolution_.x + i)] = 1; }
+        void markUnresolved(int startX, int startY, int stopX, int stopY);
+        bool isUnresolved(int i, int j) const { return unresolved_[static_cast<size_t>(j * resolution_.x + i)] != 0; }
+
+    private:
+        vira::images::Resolution resolution_{};
+        std::vector<VisibilitySample<TSpectral, TFloat, TMeshFloat>> samples_;
+        std::vector<uint8_t> unresolved_;
+    };
+};
+
+#include "implementation/rendering/visibility_buffer.ipp"
+
+#endif
@@ -1,17 +1,21 @@
 #ifndef VIRA_SCENE_HPP
 #define VIRA_SCENE_HPP
 
+#include <cstdint>
 #include <vector>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <filesystem>
 #include <functional>
+#include <mutex>
 
 // TODO REMOVE THIRD PARTY HEADERS:
 #include "embree3/rtcore.h"
 
 #include "vira/constraints.hpp"
 #include "vira/spectral_data.hpp"
+#include "vira/reference_frame_hierarchy.hpp"
 #include "vira/geometry/mesh.hpp"
 #include "vira/geometry/interfaces/load_result.hpp"
 #include "vira/lights/light.hpp"
@@ -22,14 +26,19 @@
 #include "vira/unresolved/star_catalogue.hpp"
 #include "vira/unresolved/star_light.hpp"
 #include "vira/quipu/star_quipu.hpp"
+#include "vira/quipu/scene_snapshot.hpp"
 #include "vira/rendering/acceleration/tlas.hpp"
+#include "vira/rendering/acceleration/embree_options.hpp"
 #include "vira/scene/lod_manager.hpp"
+#include "vira/utils/concurrency.hpp"
+#include "vira/utils/memory_usage.hpp"
 
 #include "vira/cameras/camera.hpp"
 
 #include "vira/rendering/cpu_path_tracer.hpp"
 #include "vira/rendering/cpu_rasterizer.hpp"
 #include "vira/rendering/cpu_unresolved_renderer.hpp"
+#include "vira/rendering/render_context.hpp"
 
 namespace fs = std::filesystem;
 
@@ -67,6 +76,9 @@ namespace vira {
 
         void saveGroupAsGeometry(const GroupID& group_id, const fs::path& filepath, std::string format = "AUTO");
 
+        void saveSnapshot(const fs::path& filepath, quipu::SceneSnapshotOptions options = quipu::SceneSnapshotOptions{});
+        void loadSnapshot(const fs::path& filepath);
+
 
         // ======================= //
         // === SPICE Interface === //
@@ -97,7 +109,7 @@ namespace vira {
         void setBackgroundEmission(TSpectral background_emission);
         void setBackgroundEmission(float background_emission) { this->setBackgroundEmission(TSpectral{ background_emission }); }
 
-        const images::Image<TSpectral>& getBackgroundEmission() { return background_emission_; }
+        const images::Image<TSpectral>& getBackgroundEmission() const { return background_emission_; }
 
 
         // =================== //
@@ -109,8 +121,8 @@ namespace vira {
         void setAmbientRGB(float red, float green, float blue);
         void setAmbientRGB(ColorRGB ambient_lighting, std::function<TSpectral(const ColorRGB&)> converter = nullptr);
 
-        const TSpectral getAmbient() { return ambient_lighting_; }
-        bool hasAmbient() { return has_ambient_; }
+        const TSpectral getAmbient() const { return ambient_lighting_; }
+        bool hasAmbient() const { return has_ambient_; }
 
         // ============= //
         // === Stars === //
@@ -162,8 +174,9 @@ namespace vira {
         UNRESOLVED& operator[](const UnresolvedID& id) { return const_cast<UNRESOLVED&>(static_cast<const Scene&>(*this)[id]); }
 
 
-        bool isDirty() const { return this->is_dirty_; }
+        bool isDirty() const { return this->is_dirty_ || this->is_modified_ || !this->moved_instances_.empty(); }
         void markDirty() { this->is_dirty_ = true; }
+        void markModified() { this->is_modified_ = true; }
 
         // ================= //
         // === Materials === //
@@ -184,9 +197,11 @@ namespace vira {
         bool hasLoadedQuipu(const fs::path& quipuPath) { return loadedQuipuPaths_.find(quipuPath.string()) != loadedQuipuPaths_.end(); }
         MeshID addQuipuMesh(const fs::path& quipuPath, const MaterialID& materialID, std::string name = "");
         MeshID addQuipuMesh(vira::quipu::DEMQuipu<TSpectral, TFloat, TMeshFloat> quipu, const MaterialID& materialID, bool smoothShading, std::string name = "");
+        MeshID addEllipsoidMesh(geometry::AnalyticEllipsoid<TSpectral, TMeshFloat> ellipsoid, const MaterialID& materialID, std::string name = "");
 
         bool removeMesh(const MeshID& meshID);
         bool hasMesh(const MeshID& meshID) const;
+        bool hasAnalyticMeshes() const;
 
 
         // ===================== //
@@ -222,12 +237,20 @@ namespace vira {
         vira::images::Image<float> render(const vira::CameraID& cameraID);
         vira::images::Image<ColorRGB> renderRGB(const vira::CameraID& cameraID);
 
-        void initializeTLASThreads()
+        // Thread-safe rendering (see RenderContext):
+        void prepareRender(const std::vector<vira::CameraID>& cameraIDs = {});
+        bool isPrepared() const;
+        rendering::RenderContext<TSpectral, TFloat, TMeshFloat> newRenderContext() const;
+        vira::images::Image<TSpectral> renderTotalPower(const vira::CameraID& cameraID, rendering::RenderContext<TSpectral, TFloat, TMeshFloat>& context) const;
+        vira::images::Image<float> render(const vira::CameraID& cameraID, rendering::RenderContext<TSpectral, TFloat, TMeshFloat>& context) const;
+        vira::images::Image<ColorRGB> renderRGB(const vira::CameraID& cameraID, rendering::RenderContext<TSpectral, TFloat, TMeshFloat>& context) const;
+
+        void initializeTLASThreads() const
         {
             this->tlas->init();
         }
 
-        void intersect(vira::rendering::Ray<TSpectral, TFloat>& ray)
+        void intersect(vira::rendering::Ray<TSpectral, TFloat>& ray) const
         {
             this->tlas->intersect(ray);
         }
@@ -248,6 +271,19 @@ namespace vira {
         scene::LevelOfDetailManager<TSpectral, TFloat, TMeshFloat> lodManager;
         void updateLevelOfDetail(const vira::CameraID& cameraID);
 
+
+        // =================== //
+        // === Concurrency === //
+        // =================== //
+        void setConcurrency(utils::ConcurrencyOptions options);
+        utils::ConcurrencyContext& getConcurrency() { return concurrency_; }
+
+
+        // ========================= //
+        // === Memory Accounting === //
+        // ========================= //
+        utils::MemoryReport getMemoryReport() const;
+
         // ======================= //
         // === Drawing methods === //
         // ======================= //
@@ -273,6 +309,7 @@ namespace vira {
             std::vector<TransformData> instances;
             float target_gsd = std::numeric_limits<float>::infinity();
             std::string name;
+            size_t embree_bytes = 0; // Embree device memory allocated when the mesh's BLAS was built
         };
 
         std::unordered_map<std::string, MeshID> loadedQuipuPaths_;
@@ -300,12 +337,46 @@ namespace vira {
         std::unique_ptr<rendering::TLAS<TSpectral, TFloat, TMeshFloat>> tlas;
 
         RTCDevice rtc_device_ = nullptr;
+        rendering::EmbreeMemoryMonitor embree_memory_{};
+
+        utils::ConcurrencyContext concurrency_{};
+
+        // Serializes updates of the caches and acceleration structures, so concurrent renders prepare the Scene once:
+        mutable std::recursive_mutex graph_mutex_;
+
+        vira::images::Image<TSpectral> combinePower(const vira::images::Image<TSpectral>& received_power, const vira::images::Image<TSpectral>& unresolved_power) const;
 
         void recursivelyPopulateCaches(const GROUP* parentGroup);
 
+        // Incremental cache maintenance (used by Group and Instance for localized changes):
+        void markMoved(const INSTANCE* instance) { moved_instances_.insert(instance); }
+        void markGraphChanged() { this->is_modified_ = true; this->rebuild_frame_hierarchy_ = true; }
+
+        void cacheInstance(INSTANCE* instance);
+        void cacheLight(LIGHT* light);
+        void cacheUnresolved(UNRESOLVED* unresolved_object);
+
+        void releaseInstance(const INSTANCE* instance);
+        void releaseLight(const LIGHT* light);
+        void releaseUnresolved(const UNRESOLVED* unresolved_object);
+        void releaseGroup(const GROUP* group);
+
         void updateMeshLoDs(bool parallelUpodate, size_t numToUpdate);
 
+        uint64_t sensor_stream_ = 0; // Sensor noise stream of the next render through the Scene's own renderers
+
         bool is_dirty_ = false; // TODO Make this true by default
+        bool is_modified_ = false;
+
+        std::unordered_set<const INSTANCE*> moved_instances_;
+        std::vector<const INSTANCE*> changed_instances_; // Moved since the TLAS was last built or updated
+
+        // Flattened scene graph used to propagate SPICE states:
+        ReferenceFrameHierarchy<TFloat> frame_hierarchy_;
+        std::vector<const INSTANCE*> frame_instances_; // Instance corresponding to each frame (or nullptr)
+        bool rebuild_frame_hierarchy_ = true;
+
+        void buildFrameHierarchy();
 
         std::unique_ptr<geometry::GeometryInterface<TSpectral, TFloat, TMeshFloat>> geometryInterface = nullptr;
 
@@ -357,6 +428,8 @@ namespace vira {
         friend class rendering::CPUPathTracer<TSpectral, TFloat, TMeshFloat>;
         friend class rendering::CPURasterizer<TSpectral, TFloat, TMeshFloat>;
         friend class rendering::CPUUnresolvedRenderer<TSpectral, TFloat, TMeshFloat>;
+        friend class rendering::SceneShadowMaps<TSpectral, TFloat, TMeshFloat>;
+        friend class quipu::SceneSnapshot<TSpectral, TFloat, TMeshFloat>;
     };
 };
 
@@ -22,6 +22,11 @@ namespace vira {
         template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
         class GeometryInterface;
     }
+
+    namespace quipu {
+        template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+        class SceneSnapshot;
+    }
 };
 
 namespace vira::scene {
@@ -199,8 +204,6 @@ namespace vira::scene {
 
         void updateChildren();
 
-        void updateSPICE(double et);
-
     private:
         GroupID id_{};
 
@@ -217,6 +220,7 @@ namespace vira::scene {
 
         friend class vira::Scene<TSpectral, TFloat, TMeshFloat>;
         friend class vira::geometry::GeometryInterface<TSpectral, TFloat, TMeshFloat>;
+        friend class vira::quipu::SceneSnapshot<TSpectral, TFloat, TMeshFloat>;
     };
 };
 
@@ -39,7 +39,7 @@ namespace vira::scene {
         MeshID meshID_{};
 
         void onReferenceFrameChanged() override {
-            this->template getScenePtr<TSpectral, TMeshFloat>()->markDirty();
+            this->template getScenePtr<TSpectral, TMeshFloat>()->markMoved(this);
         }
 
         friend class Group<TSpectral, TFloat, TMeshFloat>;
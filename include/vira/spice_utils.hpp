@@ -4,6 +4,7 @@
 #include <string>
 #include <array>
 #include <filesystem>
+#include <mutex>
 
 #include "vira/vec.hpp"
 #include "vira/reference_frame.hpp"
@@ -12,6 +13,19 @@
 namespace fs = std::filesystem;
 
 namespace vira {
+    /**
+     * @brief Returns the mutex guarding the CSPICE library
+     * @details CSPICE keeps its kernel pool and error state in global variables and is not thread-safe.
+     *          Every call into CSPICE made by Vira holds this lock, so scenes rendered concurrently in
+     *          the same process may safely share loaded kernels.  Applications calling CSPICE directly
+     *          while Vira is running should hold it as well.
+     */
+    inline std::recursive_mutex& spiceMutex()
+    {
+        static std::recursive_mutex mutex;
+        return mutex;
+    };
+
     template <IsFloat TFloat>
     class SpiceUtils {
     public:
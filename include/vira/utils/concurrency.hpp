@@ -0,0 +1,71 @@
+#ifndef VIRA_UTILS_CONCURRENCY_HPP
+#define VIRA_UTILS_CONCURRENCY_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tbb/task_arena.h"
+#include "tbb/task_scheduler_observer.h"
+
+namespace vira::utils {
+    struct ConcurrencyOptions {
+        size_t max_threads = 0;  ///< Maximum number of threads (0 uses every available core)
+        int numa_node = -1;      ///< NUMA node the threads are placed on (-1 for no constraint)
+        bool pin_threads = false; ///< Pin each thread to its own core, starting at first_core
+        size_t first_core = 0;   ///< First core used when pinning threads (counted within the NUMA node's cores if numa_node is set)
+    };
+
+    /**
+     * @brief Thread pool bounds shared by every parallel stage of a Scene
+     *
+     * A ConcurrencyContext owns a TBB task arena.  All work submitted through execute() (including every
+     * nested tbb::parallel_for) runs on at most max_threads threads, optionally restricted to a NUMA node
+     * and pinned to consecutive cores (of that node, if one is selected).  This allows several renders to share a machine without
+     * oversubscribing it.
+     *
+     * The same limits are forwarded to Embree through getEmbreeConfig().
+     */
+    class ConcurrencyContext {
+    public:
+        ConcurrencyContext(ConcurrencyOptions options = ConcurrencyOptions{});
+        ~ConcurrencyContext();
+
+        ConcurrencyContext(const ConcurrencyContext&) = delete;
+        ConcurrencyContext& operator=(const ConcurrencyContext&) = delete;
+
+        void configure(ConcurrencyOptions options);
+        const ConcurrencyOptions& getOptions() const { return options_; }
+
+        size_t getMaxThreads() const;
+        std::string getEmbreeConfig() const;
+
+        template <typename F>
+        auto execute(F&& f) const -> decltype(f());
+
+    private:
+        class PinningObserver : public tbb::task_scheduler_observer {
+        public:
+            PinningObserver(tbb::task_arena& arena, std::vector<size_t> cores, size_t first_core);
+            void on_scheduler_entry(bool is_worker) override;
+            void on_scheduler_exit(bool is_worker) override;
+
+        private:
+            std::vector<size_t> cores_;
+            size_t first_core_;
+        };
+
+        static std::vector<size_t> getCores(int numa_node);
+
+        ConcurrencyOptions options_;
+
+        std::unique_ptr<tbb::task_arena> arena_ = nullptr;
+        std::unique_ptr<PinningObserver> observer_ = nullptr;
+    };
+};
+
+#include "implementation/utils/concurrency.ipp"
+
+#endif
@@ -2,6 +2,7 @@
 #define VIRA_UTILS_HASH_UTILS_HPP
 
 #include <cstddef>
+#include <cstdint>
 
 #include "vira/constraints.hpp"
 #include "vira/spectral_data.hpp"
@@ -11,6 +12,15 @@ namespace vira::utils {
     template <typename T, typename... Rest>
     void hashCombine(std::size_t& seed, const T& v, const Rest&... rest);
 
+    // FNV-1a hashing (unlike std::hash, stable between runs, standard libraries, and builds, so it may be stored in files):
+    constexpr uint64_t FNV1A_OFFSET_BASIS = 14695981039346656037ull;
+    constexpr uint64_t FNV1A_PRIME = 1099511628211ull;
+
+    inline void fnv1a(uint64_t& hash, const void* data, size_t size);
+
+    template <typename T, typename... Rest>
+    void fnv1aCombine(uint64_t& hash, const T& v, const Rest&... rest);
+
     // A simple hashing function for a size_t:
     inline void hashUint32(size_t& a);
 
@@ -0,0 +1,85 @@
+#ifndef VIRA_UTILS_MAPPED_FILE_HPP
+#define VIRA_UTILS_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+namespace vira::utils {
+    /**
+     * @brief Read-only memory mapping of an entire file
+     *
+     * The file is mapped with mmap (POSIX) or CreateFileMapping (Windows), so pages are only read from disk
+     * as they are touched and are shared with the OS page cache.  The mapping is released on destruction.
+     */
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        MappedFile(const fs::path& filepath);
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        void close();
+
+        bool isOpen() const { return data_ != nullptr; }
+        const char* data() const { return data_; }
+        size_t size() const { return size_; }
+
+        const fs::path& getFilepath() const { return filepath_; }
+
+    private:
+        fs::path filepath_ = "";
+        const char* data_ = nullptr;
+        size_t size_ = 0;
+
+#ifdef _WIN32
+        void* file_handle_ = nullptr;
+        void* mapping_handle_ = nullptr;
+#endif
+    };
+
+    /**
+     * @brief Sequential, bounds-checked reader over a MappedFile
+     *
+     * Scalars and strings are read with the same layout as the vira::quipu write functions.  Bulk arrays
+     * which were written at an aligned offset can be viewed in place, without copying.
+     */
+    class MappedFileReader {
+    public:
+        MappedFileReader(const MappedFile& file, size_t offset = 0);
+
+        template <typename T>
+        void readValue(T& value);
+
+        void readString(std::string& str);
+
+        template <typename T>
+        void readArray(T* values, size_t count);
+
+        template <typename T>
+        const T* view(size_t count);
+
+        void align(size_t alignment);
+        void skip(size_t bytes);
+        void seek(size_t offset);
+        size_t tell() const { return offset_; }
+
+    private:
+        const MappedFile* file_ = nullptr;
+        size_t offset_ = 0;
+
+        const char* advance(size_t bytes);
+    };
+};
+
+#include "implementation/utils/mapped_file.ipp"
+
+#endif
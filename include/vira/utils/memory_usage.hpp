@@ -0,0 +1,67 @@
+#ifndef VIRA_UTILS_MEMORY_USAGE_HPP
+#define VIRA_UTILS_MEMORY_USAGE_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "vira/constraints.hpp"
+#include "vira/spectral_data.hpp"
+#include "vira/scene/ids.hpp"
+
+namespace vira::utils {
+    /**
+     * @brief Bytes held by an object (or a collection of objects), by category
+     *
+     * Container sizes are measured by capacity, so over-allocation is included.  Memory allocated by
+     * Embree is measured through its device memory monitor rather than estimated.
+     */
+    struct MemoryUsage {
+        size_t vertices = 0;      ///< Vertex buffers
+        size_t indices = 0;       ///< Index buffers and per-triangle material indices
+        size_t triangles = 0;     ///< Constructed triangles, triangle clusters, and their ordering
+        size_t blas = 0;          ///< Bottom level acceleration structures (ViraBLAS nodes and indices, or Embree scenes)
+        size_t tlas = 0;          ///< Top level acceleration structure
+        size_t textures = 0;      ///< Material maps and the background emission map
+        size_t render_passes = 0; ///< Output passes of the renderers
+
+        size_t geometry() const { return vertices + indices + triangles; }
+        size_t acceleration() const { return blas + tlas; }
+        size_t total() const { return geometry() + acceleration() + textures + render_passes; }
+
+        MemoryUsage& operator+=(const MemoryUsage& other);
+    };
+
+    struct MeshMemoryUsage {
+        MeshID id{};
+        std::string name;
+        size_t instances = 0; ///< Number of instances sharing the mesh
+        MemoryUsage usage{};
+    };
+
+    struct InstanceMemoryUsage {
+        InstanceID id{};
+        MeshID mesh{};
+        size_t bytes = 0;           ///< Bytes held by the instance itself
+        size_t amortized_bytes = 0; ///< Bytes held by the instance, plus its share of the mesh it instances
+    };
+
+    struct MemoryReport {
+        MemoryUsage totals{};
+        size_t embree_device_bytes = 0; ///< Everything currently allocated by the Scene's Embree device
+
+        std::vector<MeshMemoryUsage> meshes;         ///< In order of decreasing total
+        std::vector<InstanceMemoryUsage> instances;  ///< In order of decreasing amortized total
+
+        std::string format(size_t max_rows = 10) const;
+    };
+
+    template <typename T>
+    size_t vectorBytes(const std::vector<T>& vector) { return vector.capacity() * sizeof(T); }
+
+    std::string formatBytes(size_t bytes);
+};
+
+#include "implementation/utils/memory_usage.ipp"
+
+#endif
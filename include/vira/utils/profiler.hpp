@@ -0,0 +1,120 @@
+#ifndef VIRA_UTILS_PROFILER_HPP
+#define VIRA_UTILS_PROFILER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+namespace vira::utils {
+    struct ProfileEvent {
+        const char* name = nullptr; ///< Zone name (must be a string with static storage duration)
+        uint64_t start_ns = 0;      ///< Start time, relative to when the profiler was created
+        uint64_t duration_ns = 0;   ///< Duration of the zone
+        uint32_t thread = 0;        ///< Sequential index of the recording thread
+        uint32_t depth = 0;         ///< Nesting depth of the zone on its thread
+    };
+
+    struct ProfileStatistics {
+        std::string name;
+        size_t count = 0;     ///< Number of times the zone was entered
+        double total_ms = 0;  ///< Summed duration over all threads
+        double min_ms = 0;
+        double max_ms = 0;
+
+        double mean_ms() const { return (count == 0) ? 0 : total_ms / static_cast<double>(count); }
+    };
+
+    /**
+     * @brief Process-wide recorder of timed zones
+     *
+     * Zones are recorded with VIRA_PROFILE_ZONE("name"), which times the enclosing scope.  Each thread
+     * appends to its own buffer, so recording never contends with other threads.  While profiling is
+     * disabled (the default) a zone costs a single relaxed atomic load; defining VIRA_DISABLE_PROFILING
+     * removes zones entirely at compile time.
+     *
+     * Recorded zones can be exported with writeChromeTrace() (viewable in chrome://tracing or
+     * https://ui.perfetto.dev) or summarized with getStatistics().
+     */
+    class Profiler {
+    public:
+        static Profiler& get();
+
+        Profiler(const Profiler&) = delete;
+        Profiler& operator=(const Profiler&) = delete;
+
+        void enable() { enabled_.store(true, std::memory_order_relaxed); }
+        void disable() { enabled_.store(false, std::memory_order_relaxed); }
+        bool isEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+        void clear();
+
+        std::vector<ProfileEvent> getEvents() const;
+        std::vector<ProfileStatistics> getStatistics() const;
+        std::string formatStatistics() const;
+
+        void writeChromeTrace(const fs::path& filepath) const;
+
+        // Used by ProfileZone:
+        uint64_t now() const;
+        void record(const char* name, uint64_t start_ns, uint64_t end_ns, uint32_t depth);
+
+    private:
+        Profiler();
+
+        struct ThreadBuffer {
+            uint32_t thread = 0;
+            std::mutex mutex; // Only contended while events are being read
+            std::vector<ProfileEvent> events;
+        };
+
+        ThreadBuffer& threadBuffer();
+
+        std::atomic<bool> enabled_{ false };
+        std::chrono::steady_clock::time_point epoch_;
+
+        mutable std::mutex buffers_mutex_;
+        std::vector<std::shared_ptr<ThreadBuffer>> buffers_;
+    };
+
+    /**
+     * @brief Times the scope it is declared in (see VIRA_PROFILE_ZONE)
+     */
+    class ProfileZone {
+    public:
+        explicit ProfileZone(const char* name);
+        ~ProfileZone();
+
+        ProfileZone(const ProfileZone&) = delete;
+        ProfileZone& operator=(const ProfileZone&) = delete;
+
+    private:
+        const char* name_ = nullptr;
+        uint64_t start_ns_ = 0;
+
+        static uint32_t& depth();
+    };
+
+    inline void enableProfiling() { Profiler::get().enable(); }
+    inline void disableProfiling() { Profiler::get().disable(); }
+};
+
+#define VIRA_PROFILE_CONCAT_INNER(a, b) a##b
+#define VIRA_PROFILE_CONCAT(a, b) VIRA_PROFILE_CONCAT_INNER(a, b)
+
+#ifdef VIRA_DISABLE_PROFILING
+#define VIRA_PROFILE_ZONE(name)
+#else
+#define VIRA_PROFILE_ZONE(name) vira::utils::ProfileZone VIRA_PROFILE_CONCAT(vira_profile_zone_, __LINE__)(name)
+#endif
+
+#include "implementation/utils/profiler.ipp"
+
+#endif
@@ -64,6 +64,9 @@
 #include "vira/rendering/cpu_rasterizer.hpp"
 #include "vira/rendering/cpu_path_tracer.hpp"
 #include "vira/rendering/cpu_unresolved_renderer.hpp"
+#include "vira/rendering/render_context.hpp"
+#include "vira/rendering/render_control.hpp"
+#include "vira/rendering/ray_statistics.hpp"
 #include "vira/rendering/passes.hpp"
 #include "vira/rendering/ray.hpp"
 #include "vira/rendering/bresenham.hpp"
@@ -86,6 +89,9 @@
 #include "vira/unresolved/interfaces/tycho2_interface.hpp"
 
 // Provide Utilities:
+#include "vira/utils/concurrency.hpp"
+#include "vira/utils/profiler.hpp"
+#include "vira/utils/memory_usage.hpp"
 #include "vira/utils/utils.hpp"
 
 #endif
\ No newline at end of file
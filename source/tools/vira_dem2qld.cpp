@@ -26,6 +26,7 @@
 #include "vira/dems/interfaces/gdal_interface.hpp"
 #include "vira/geometry/mesh.hpp"
 #include "vira/quipu/dem_quipu.hpp"
+#include "vira/utils/concurrency.hpp"
 
 #include "vira/tools/geo_translate.hpp"
 
@@ -59,6 +60,7 @@ struct Input {
     int maxAllowedMemory;
     fs::path configPath;
     fs::path rootPath;
+    vira::utils::ConcurrencyOptions concurrency;
 
     Input() = default;
     Input(int argc, char* argv[])
@@ -74,6 +76,18 @@ struct Input {
         TCLAP::ValueArg<int> maxMemoryArg("m", "max-memory", "Maximum allowed memory usage in GB", false, 25, "int");
         cmd.add(maxMemoryArg);
 
+        TCLAP::ValueArg<size_t> threadsArg("j", "threads", "Maximum number of threads to use (0 uses all cores)", false, 0, "int");
+        cmd.add(threadsArg);
+
+        TCLAP::ValueArg<int> numaArg("", "numa-node", "NUMA node to run on", false, -1, "int");
+        cmd.add(numaArg);
+
+        TCLAP::SwitchArg pinArg("", "pin-threads", "Pin each thread to its own core", false);
+        cmd.add(pinArg);
+
+        TCLAP::ValueArg<size_t> firstCoreArg("", "first-core", "First core to pin threads to (within the NUMA node, if one is given)", false, 0, "int");
+        cmd.add(firstCoreArg);
+
 
         // Parse the inputs:
         cmd.parse(argc, argv);
@@ -87,6 +101,11 @@ struct Input {
         rootPath = fs::absolute(rootPath);
         vira::utils::validateDirectory(rootPath);
 
+        concurrency.max_threads = threadsArg.getValue();
+        concurrency.numa_node = numaArg.getValue();
+        concurrency.pin_threads = pinArg.getValue();
+        concurrency.first_core = firstCoreArg.getValue();
+
         maxAllowedMemory = maxMemoryArg.getValue();
         if (maxAllowedMemory < 2) {
             throw std::runtime_error("Input argument --max-memory must be greater than 2 (GB) (was set to: " + std::to_string(maxAllowedMemory) + ")");
@@ -293,310 +312,314 @@ int main(int argc, char* argv[])
 
         vira::dems::setProjDataSearchPaths();
 
-        size_t inputIdx = 1;
-        for (const auto& input : inputs) {
-            std::cout << vira::print::printGreen("Processing " + std::to_string(inputIdx) + "/" + std::to_string(inputs.size()) + ": ") << input.file.filename().string() << "\n";
-            inputIdx++;
-            if (input.albedo_files.size() != 0) {
-                std::cout << vira::print::VIRA_INDENT << vira::print::printYellow(std::to_string(input.albedo_files.size()) + " Albedo files:") << "\n";
-                for (size_t i = 0; i < input.albedo_files.size(); ++i) {
-                    std::cout << vira::print::VIRA_DOUBLE_INDENT << input.albedo_files[i].filename().string();
-                    if (input.albedo_files_lonwrap[i]) {
-                        std::cout << vira::print::printYellow(" (LONWRAP)") << std::endl;
-                    }
-                    else {
-                        std::cout << std::endl;
-                    }
+        // Limit all processing to the requested threads:
+        vira::utils::ConcurrencyContext concurrency(commandInput.concurrency);
+        concurrency.execute([&] {
+            size_t inputIdx = 1;
+            for (const auto& input : inputs) {
+                std::cout << vira::print::printGreen("Processing " + std::to_string(inputIdx) + "/" + std::to_string(inputs.size()) + ": ") << input.file.filename().string() << "\n";
+                inputIdx++;
+                if (input.albedo_files.size() != 0) {
+                    std::cout << vira::print::VIRA_INDENT << vira::print::printYellow(std::to_string(input.albedo_files.size()) + " Albedo files:") << "\n";
+                    for (size_t i = 0; i < input.albedo_files.size(); ++i) {
+                        std::cout << vira::print::VIRA_DOUBLE_INDENT << input.albedo_files[i].filename().string();
+                        if (input.albedo_files_lonwrap[i]) {
+                            std::cout << vira::print::printYellow(" (LONWRAP)") << std::endl;
+                        }
+                        else {
+                            std::cout << std::endl;
+                        }
                     
+                    }
                 }
-            }
 
-            if (!input.append_right.empty()) {
-                std::cout << vira::print::VIRA_INDENT << vira::print::printYellow("Append right: ") << input.append_right.filename().string() << std::endl;
-            }
+                if (!input.append_right.empty()) {
+                    std::cout << vira::print::VIRA_INDENT << vira::print::printYellow("Append right: ") << input.append_right.filename().string() << std::endl;
+                }
 
-            if (!input.append_below.empty()) {
-                std::cout << vira::print::VIRA_INDENT << vira::print::printYellow("Append below: ") << input.append_below.filename().string() << std::endl;
-            }
+                if (!input.append_below.empty()) {
+                    std::cout << vira::print::VIRA_INDENT << vira::print::printYellow("Append below: ") << input.append_below.filename().string() << std::endl;
+                }
 
-            if (input.z_scale != 1.f) {
-                std::cout << vira::print::VIRA_INDENT << vira::print::printYellow("Z-scale: ") << input.z_scale << std::endl;
-            }
+                if (input.z_scale != 1.f) {
+                    std::cout << vira::print::VIRA_INDENT << vira::print::printYellow("Z-scale: ") << input.z_scale << std::endl;
+                }
 
             
 
-            if (input.compress) {
-                std::cout << vira::print::VIRA_INDENT << vira::print::printYellow("Using LZ4 Compression") << std::endl;
-            }
+                if (input.compress) {
+                    std::cout << vira::print::VIRA_INDENT << vira::print::printYellow("Using LZ4 Compression") << std::endl;
+                }
 
-            std::cout << vira::print::VIRA_INDENT << vira::print::printYellow("Writing outputs to:\n");
-            std::cout << vira::print::VIRA_DOUBLE_INDENT << vira::print::printOnBlue(input.output.string()) << "\n";
-            std::cout << std::flush;
+                std::cout << vira::print::VIRA_INDENT << vira::print::printYellow("Writing outputs to:\n");
+                std::cout << vira::print::VIRA_DOUBLE_INDENT << vira::print::printOnBlue(input.output.string()) << "\n";
+                std::cout << std::flush;
 
 
-            // Perform processing:
-            vira::quipu::DEMQuipuWriterOptions quipuOptions;
-            quipuOptions.compress = input.compress;
+                // Perform processing:
+                vira::quipu::DEMQuipuWriterOptions quipuOptions;
+                quipuOptions.compress = input.compress;
 
-            try {
-                vira::dems::GDALOptions gdalOptions;
-                gdalOptions.scale = input.z_scale;
+                try {
+                    vira::dems::GDALOptions gdalOptions;
+                    gdalOptions.scale = input.z_scale;
 
-                vira::dems::GDALOptions gdalTempOptions;
-                gdalTempOptions.scale = input.z_scale;
+                    vira::dems::GDALOptions gdalTempOptions;
+                    gdalTempOptions.scale = input.z_scale;
 
-                // Determine if geometry is too big to load all at once:
-                vira::images::Resolution resolution = vira::dems::GDALInterface::getResolution(input.file);
-                int maxAllowedPixels = commandInput.maxAllowedMemory * 62500000; // (8e9 / (4 * 32));
+                    // Determine if geometry is too big to load all at once:
+                    vira::images::Resolution resolution = vira::dems::GDALInterface::getResolution(input.file);
+                    int maxAllowedPixels = commandInput.maxAllowedMemory * 62500000; // (8e9 / (4 * 32));
 
-                // Determine if the appending maps are compatible in size:
-                if (!input.append_right.empty()) {
-                    vira::images::Resolution resolutionRight = vira::dems::GDALInterface::getResolution(input.append_right);
-                    if (resolutionRight.y != resolution.y) {
-                        throw std::runtime_error("The specified append-right file does not have a compatible resolution.\n"
-                            "    The central DEM has a resolution of: [" + std::to_string(resolution.x) + " x " + std::to_string(resolution.y) + "]\n"
-                            "    but the append_right DEM has:        [" + std::to_string(resolutionRight.x) + " x " + std::to_string(resolutionRight.y) + "]"
-                        );
+                    // Determine if the appending maps are compatible in size:
+                    if (!input.append_right.empty()) {
+                        vira::images::Resolution resolutionRight = vira::dems::GDALInterface::getResolution(input.append_right);
+                        if (resolutionRight.y != resolution.y) {
+                            throw std::runtime_error("The specified append-right file does not have a compatible resolution.\n"
+                                "    The central DEM has a resolution of: [" + std::to_string(resolution.x) + " x " + std::to_string(resolution.y) + "]\n"
+                                "    but the append_right DEM has:        [" + std::to_string(resolutionRight.x) + " x " + std::to_string(resolutionRight.y) + "]"
+                            );
+                        }
                     }
-                }
 
-                if (!input.append_below.empty()) {
-                    vira::images::Resolution resolutionBelow = vira::dems::GDALInterface::getResolution(input.append_below);
-                    if (resolutionBelow.x != resolution.x) {
-                        throw std::runtime_error("The specified append-below file does not have a compatible resolution.\n"
-                            "    The central DEM has a resolution of: [" + std::to_string(resolution.x) + " x " + std::to_string(resolution.y) + "]\n"
-                            "    but the append_below DEM has:        [" + std::to_string(resolutionBelow.x) + " x " + std::to_string(resolutionBelow.y) + "]"
-                        );
+                    if (!input.append_below.empty()) {
+                        vira::images::Resolution resolutionBelow = vira::dems::GDALInterface::getResolution(input.append_below);
+                        if (resolutionBelow.x != resolution.x) {
+                            throw std::runtime_error("The specified append-below file does not have a compatible resolution.\n"
+                                "    The central DEM has a resolution of: [" + std::to_string(resolution.x) + " x " + std::to_string(resolution.y) + "]\n"
+                                "    but the append_below DEM has:        [" + std::to_string(resolutionBelow.x) + " x " + std::to_string(resolutionBelow.y) + "]"
+                            );
+                        }
                     }
-                }
 
-                std::vector<std::array<int, 4>> chunks = vira::images::computeChunks(resolution, maxAllowedPixels);
-                if (chunks.size() > 1) {
-                    std::cout << vira::print::printYellow("File is too large to load all at once.  Breaking into " + std::to_string(chunks.size()) + " chunks\n");
-                }
-
-                for (size_t cIdx = 0; cIdx < chunks.size(); ++cIdx) {
-                    std::string chunkStr = "";
+                    std::vector<std::array<int, 4>> chunks = vira::images::computeChunks(resolution, maxAllowedPixels);
                     if (chunks.size() > 1) {
-                        chunkStr = "_chunk-" + std::to_string(cIdx + 1);
+                        std::cout << vira::print::printYellow("File is too large to load all at once.  Breaking into " + std::to_string(chunks.size()) + " chunks\n");
                     }
 
-                    gdalOptions.x_start = chunks[cIdx][0];
-                    gdalOptions.y_start = chunks[cIdx][1];
-                    gdalOptions.x_width = chunks[cIdx][2];
-                    gdalOptions.y_width = chunks[cIdx][3];
-
-                    auto bar = vira::print::makeProgressBar("Reading file");
-                    float completion = 0.f;
-                    vira::print::updateProgressBar(bar, "Reading file", completion);
-
-                    vira::dems::GeoreferenceImage<float> heightMap = vira::dems::GDALInterface::load(input.file, gdalOptions);
-                    completion = 20.f;
-                    vira::print::updateProgressBar(bar, "Appending adjacent DEMs", completion);
-
-                    // Append with specified adjacent maps
-                    if ((gdalOptions.x_start + gdalOptions.x_width) == resolution.x) {
-                        if (!input.append_right.empty()) {
-                            gdalTempOptions.x_start = 0;
-                            gdalTempOptions.y_start = chunks[cIdx][1];
-                            gdalTempOptions.x_width = 1;
-                            gdalTempOptions.y_width = chunks[cIdx][3];
-
-                            vira::dems::GeoreferenceImage<float> heightStrip = vira::dems::GDALInterface::load(input.append_right, gdalTempOptions);
-                            heightMap.appendRight(heightStrip, 1);
+                    for (size_t cIdx = 0; cIdx < chunks.size(); ++cIdx) {
+                        std::string chunkStr = "";
+                        if (chunks.size() > 1) {
+                            chunkStr = "_chunk-" + std::to_string(cIdx + 1);
                         }
-                    }
 
-                    if ((gdalOptions.y_start + gdalOptions.y_width) == resolution.y) {
-                        if (!input.append_below.empty()) {
-                            gdalTempOptions.x_start = chunks[cIdx][0];
-                            gdalTempOptions.y_start = 0;
-                            gdalTempOptions.x_width = chunks[cIdx][2];
-                            gdalTempOptions.y_width = 1;
+                        gdalOptions.x_start = chunks[cIdx][0];
+                        gdalOptions.y_start = chunks[cIdx][1];
+                        gdalOptions.x_width = chunks[cIdx][2];
+                        gdalOptions.y_width = chunks[cIdx][3];
+
+                        auto bar = vira::print::makeProgressBar("Reading file");
+                        float completion = 0.f;
+                        vira::print::updateProgressBar(bar, "Reading file", completion);
+
+                        vira::dems::GeoreferenceImage<float> heightMap = vira::dems::GDALInterface::load(input.file, gdalOptions);
+                        completion = 20.f;
+                        vira::print::updateProgressBar(bar, "Appending adjacent DEMs", completion);
 
-                            // If the DEM has already been augmented horizontally, we need to pad the new DEM to fit:
-                            vira::dems::GeoreferenceImage<float> heightStrip = vira::dems::GDALInterface::load(input.append_below, gdalTempOptions);
+                        // Append with specified adjacent maps
+                        if ((gdalOptions.x_start + gdalOptions.x_width) == resolution.x) {
                             if (!input.append_right.empty()) {
-                                heightStrip.padRight(1);
+                                gdalTempOptions.x_start = 0;
+                                gdalTempOptions.y_start = chunks[cIdx][1];
+                                gdalTempOptions.x_width = 1;
+                                gdalTempOptions.y_width = chunks[cIdx][3];
+
+                                vira::dems::GeoreferenceImage<float> heightStrip = vira::dems::GDALInterface::load(input.append_right, gdalTempOptions);
+                                heightMap.appendRight(heightStrip, 1);
                             }
-                            heightMap.appendBelow(heightStrip, 1);
                         }
-                    }
 
-                    // Computing tiling:
-                    completion = 25.f;
-                    vira::print::updateProgressBar(bar, "Generating tiles with " + std::to_string(input.max_vertices) + " vertices", completion);
-
-                    auto tiles = heightMap.tile(input.max_vertices);
-                    heightMap.clear();
-
-                    // Remove invalid tiles:
-                    std::vector<size_t> invalidTiles;
-                    for (size_t tileIdx = 0; tileIdx < tiles.size(); ++tileIdx) {
-                        auto& tile = tiles[tileIdx];
-                        bool invalid = true;
-                        for (size_t i = 0; i < tile.data.size(); ++i) {
-                            if (vira::utils::IS_VALID(tile.data[i])) {
-                                invalid = false;
-                                break;
+                        if ((gdalOptions.y_start + gdalOptions.y_width) == resolution.y) {
+                            if (!input.append_below.empty()) {
+                                gdalTempOptions.x_start = chunks[cIdx][0];
+                                gdalTempOptions.y_start = 0;
+                                gdalTempOptions.x_width = chunks[cIdx][2];
+                                gdalTempOptions.y_width = 1;
+
+                                // If the DEM has already been augmented horizontally, we need to pad the new DEM to fit:
+                                vira::dems::GeoreferenceImage<float> heightStrip = vira::dems::GDALInterface::load(input.append_below, gdalTempOptions);
+                                if (!input.append_right.empty()) {
+                                    heightStrip.padRight(1);
+                                }
+                                heightMap.appendBelow(heightStrip, 1);
                             }
                         }
-                        if (invalid) {
-                            invalidTiles.push_back(tileIdx);
+
+                        // Computing tiling:
+                        completion = 25.f;
+                        vira::print::updateProgressBar(bar, "Generating tiles with " + std::to_string(input.max_vertices) + " vertices", completion);
+
+                        auto tiles = heightMap.tile(input.max_vertices);
+                        heightMap.clear();
+
+                        // Remove invalid tiles:
+                        std::vector<size_t> invalidTiles;
+                        for (size_t tileIdx = 0; tileIdx < tiles.size(); ++tileIdx) {
+                            auto& tile = tiles[tileIdx];
+                            bool invalid = true;
+                            for (size_t i = 0; i < tile.data.size(); ++i) {
+                                if (vira::utils::IS_VALID(tile.data[i])) {
+                                    invalid = false;
+                                    break;
+                                }
+                            }
+                            if (invalid) {
+                                invalidTiles.push_back(tileIdx);
+                            }
                         }
-                    }
-                    std::sort(invalidTiles.begin(), invalidTiles.end(), std::greater<size_t>());
+                        std::sort(invalidTiles.begin(), invalidTiles.end(), std::greater<size_t>());
 
-                    // TODO Remove columns/rows of tiles that are fully invalid
+                        // TODO Remove columns/rows of tiles that are fully invalid
 
-                    // Remove the invalid tiles
-                    for (size_t index : invalidTiles) {
-                        if (index < tiles.size()) {
-                            tiles.erase(tiles.begin() + static_cast<std::ptrdiff_t>(index));
+                        // Remove the invalid tiles
+                        for (size_t index : invalidTiles) {
+                            if (index < tiles.size()) {
+                                tiles.erase(tiles.begin() + static_cast<std::ptrdiff_t>(index));
+                            }
                         }
-                    }
 
 
-                    // Allocate albedo tiles:
-                    if (input.albedo_files.size() != 0) {
-                        vira::dems::GDALOptions albedoOptions;
-                        albedoOptions.allow_negative = false;
+                        // Allocate albedo tiles:
+                        if (input.albedo_files.size() != 0) {
+                            vira::dems::GDALOptions albedoOptions;
+                            albedoOptions.allow_negative = false;
 
-                        std::vector<vira::dems::GeoreferenceImage<float>> albedoTiles(tiles.size());
-                        for (size_t k = 0; k < tiles.size(); ++k) {
-                            albedoTiles[k] = tiles[k].newBlank<float>();
-                        }
+                            std::vector<vira::dems::GeoreferenceImage<float>> albedoTiles(tiles.size());
+                            for (size_t k = 0; k < tiles.size(); ++k) {
+                                albedoTiles[k] = tiles[k].newBlank<float>();
+                            }
 
 
-                        float percentageStep = (70.f - completion) / static_cast<float>(2 * input.albedo_files.size());
-                        for (size_t aIdx = 0; aIdx < input.albedo_files.size(); ++aIdx) {
-                            fs::path albedoPath(input.albedo_files[aIdx]);
-                            vira::print::updateProgressBar(bar, "Reading albedo " + std::to_string(aIdx + 1) + "/" + std::to_string(input.albedo_files.size()), completion);
+                            float percentageStep = (70.f - completion) / static_cast<float>(2 * input.albedo_files.size());
+                            for (size_t aIdx = 0; aIdx < input.albedo_files.size(); ++aIdx) {
+                                fs::path albedoPath(input.albedo_files[aIdx]);
+                                vira::print::updateProgressBar(bar, "Reading albedo " + std::to_string(aIdx + 1) + "/" + std::to_string(input.albedo_files.size()), completion);
 
-                            auto tmpAlbedo = vira::dems::GDALInterface::load(albedoPath, albedoOptions);
+                                auto tmpAlbedo = vira::dems::GDALInterface::load(albedoPath, albedoOptions);
 
-                            if (input.albedo_files_lonwrap[aIdx]) {
-                                vira::tools::geoTranslateInMemory(tmpAlbedo);
+                                if (input.albedo_files_lonwrap[aIdx]) {
+                                    vira::tools::geoTranslateInMemory(tmpAlbedo);
+                                }
+                                completion += percentageStep;
+
+                                vira::print::updateProgressBar(bar, "Re-sampling Albedo " + std::to_string(aIdx + 1) + "/" + std::to_string(input.albedo_files.size()), completion);
+                                tbb::parallel_for(tbb::blocked_range<size_t>(0, tiles.size()),
+                                    [&](tbb::blocked_range<size_t> r)
+                                    {
+                                        for (size_t tIdx = r.begin(); tIdx < r.end(); ++tIdx) {
+                                            albedoTiles[tIdx].sampleFrom(tmpAlbedo);
+                                        }
+                                    });
+                                completion += percentageStep;
                             }
-                            completion += percentageStep;
+                            quipuOptions.writeAlbedos = true;
+
+                            vira::print::updateProgressBar(bar, "Writing " + std::to_string(tiles.size()) + " Quipu files", 70.f);
 
-                            vira::print::updateProgressBar(bar, "Re-sampling Albedo " + std::to_string(aIdx + 1) + "/" + std::to_string(input.albedo_files.size()), completion);
+                            std::atomic<size_t> counter(0);
                             tbb::parallel_for(tbb::blocked_range<size_t>(0, tiles.size()),
                                 [&](tbb::blocked_range<size_t> r)
                                 {
                                     for (size_t tIdx = r.begin(); tIdx < r.end(); ++tIdx) {
-                                        albedoTiles[tIdx].sampleFrom(tmpAlbedo);
+                                        albedoTiles[tIdx].fillMissing(input.default_albedo);
+
+                                        vira::dems::DEM<TSpectral, TFloat, TMeshFloat> dem(tiles[tIdx], albedoTiles[tIdx].data);
+
+                                        // Compute origin:
+                                        vira::vec3<double> origin = dem.computeOrigin();
+                                        vira::mat4<double> transformation{ 1 };
+                                        transformation[3][0] = origin[0];
+                                        transformation[3][1] = origin[1];
+                                        transformation[3][2] = origin[2];
+
+                                        // Make the DEM Pyramid:
+                                        auto pyramid = dem.makePyramid();
+
+                                        // Tile and Write to Quipu
+                                        std::string tileName = vira::utils::getFileName(input.file) + chunkStr + "_tile-" + std::to_string(tIdx + 1) + ".qld";
+                                        fs::path quipuFile = input.output / tileName;
+                                        vira::quipu::DEMQuipu<TSpectral, TFloat, TMeshFloat>::write(quipuFile, pyramid, transformation, quipuOptions);
+
+                                        // Update progress bar periodically
+                                        size_t current = ++counter;
+                                        if (current % 50 == 0 || current == tiles.size()) {
+                                            vira::print::updateProgressBar(bar, (static_cast<float>(current) / static_cast<float>(tiles.size()) * (99.f - 70.f)) + 70.f);
+                                        }
                                     }
                                 });
-                            completion += percentageStep;
                         }
-                        quipuOptions.writeAlbedos = true;
-
-                        vira::print::updateProgressBar(bar, "Writing " + std::to_string(tiles.size()) + " Quipu files", 70.f);
-
-                        std::atomic<size_t> counter(0);
-                        tbb::parallel_for(tbb::blocked_range<size_t>(0, tiles.size()),
-                            [&](tbb::blocked_range<size_t> r)
-                            {
-                                for (size_t tIdx = r.begin(); tIdx < r.end(); ++tIdx) {
-                                    albedoTiles[tIdx].fillMissing(input.default_albedo);
-
-                                    vira::dems::DEM<TSpectral, TFloat, TMeshFloat> dem(tiles[tIdx], albedoTiles[tIdx].data);
-
-                                    // Compute origin:
-                                    vira::vec3<double> origin = dem.computeOrigin();
-                                    vira::mat4<double> transformation{ 1 };
-                                    transformation[3][0] = origin[0];
-                                    transformation[3][1] = origin[1];
-                                    transformation[3][2] = origin[2];
-
-                                    // Make the DEM Pyramid:
-                                    auto pyramid = dem.makePyramid();
-
-                                    // Tile and Write to Quipu
-                                    std::string tileName = vira::utils::getFileName(input.file) + chunkStr + "_tile-" + std::to_string(tIdx + 1) + ".qld";
-                                    fs::path quipuFile = input.output / tileName;
-                                    vira::quipu::DEMQuipu<TSpectral, TFloat, TMeshFloat>::write(quipuFile, pyramid, transformation, quipuOptions);
-
-                                    // Update progress bar periodically
-                                    size_t current = ++counter;
-                                    if (current % 50 == 0 || current == tiles.size()) {
-                                        vira::print::updateProgressBar(bar, (static_cast<float>(current) / static_cast<float>(tiles.size()) * (99.f - 70.f)) + 70.f);
-                                    }
-                                }
-                            });
-                    }
-                    else {
-                        quipuOptions.writeAlbedos = false;
-
-                        vira::print::updateProgressBar(bar, "Writing " + std::to_string(tiles.size()) + " Quipu files", 50);
-
-                        std::atomic<size_t> counter(0);
-                        tbb::parallel_for(tbb::blocked_range<size_t>(0, tiles.size()),
-                            [&](tbb::blocked_range<size_t> r)
-                            {
-                                for (size_t tIdx = r.begin(); tIdx < r.end(); ++tIdx) {
-                                    vira::dems::DEM<TSpectral, TFloat, TMeshFloat> dem(tiles[tIdx]);
-
-                                    // Compute origin:
-                                    vira::vec3<double> origin = dem.computeOrigin();
-                                    vira::mat4<double> transformation{ 1 };
-                                    transformation[3][0] = origin[0];
-                                    transformation[3][1] = origin[1];
-                                    transformation[3][2] = origin[2];
-
-                                    // Make the DEM Pyramid:
-                                    auto pyramid = dem.makePyramid();
-
-                                    // Tile and Write to Quipu
-                                    std::string tileName = vira::utils::getFileName(input.file) + chunkStr + "_tile-" + std::to_string(tIdx + 1) + ".qld";
-                                    fs::path quipuFile = input.output / tileName;
-                                    vira::quipu::DEMQuipu<TSpectral, TFloat, TMeshFloat>::write(quipuFile, pyramid, transformation, quipuOptions);
-
-                                    size_t current = ++counter;
-                                    if (current % 50 == 0 || current == tiles.size()) {
-                                        vira::print::updateProgressBar(bar, (static_cast<float>(current) / static_cast<float>(tiles.size()) * (99.f - 50.f)) + 50.f);
+                        else {
+                            quipuOptions.writeAlbedos = false;
+
+                            vira::print::updateProgressBar(bar, "Writing " + std::to_string(tiles.size()) + " Quipu files", 50);
+
+                            std::atomic<size_t> counter(0);
+                            tbb::parallel_for(tbb::blocked_range<size_t>(0, tiles.size()),
+                                [&](tbb::blocked_range<size_t> r)
+                                {
+                                    for (size_t tIdx = r.begin(); tIdx < r.end(); ++tIdx) {
+                                        vira::dems::DEM<TSpectral, TFloat, TMeshFloat> dem(tiles[tIdx]);
+
+                                        // Compute origin:
+                                        vira::vec3<double> origin = dem.computeOrigin();
+                                        vira::mat4<double> transformation{ 1 };
+                                        transformation[3][0] = origin[0];
+                                        transformation[3][1] = origin[1];
+                                        transformation[3][2] = origin[2];
+
+                                        // Make the DEM Pyramid:
+                                        auto pyramid = dem.makePyramid();
+
+                                        // Tile and Write to Quipu
+                                        std::string tileName = vira::utils::getFileName(input.file) + chunkStr + "_tile-" + std::to_string(tIdx + 1) + ".qld";
+                                        fs::path quipuFile = input.output / tileName;
+                                        vira::quipu::DEMQuipu<TSpectral, TFloat, TMeshFloat>::write(quipuFile, pyramid, transformation, quipuOptions);
+
+                                        size_t current = ++counter;
+                                        if (current % 50 == 0 || current == tiles.size()) {
+                                            vira::print::updateProgressBar(bar, (static_cast<float>(current) / static_cast<float>(tiles.size()) * (99.f - 50.f)) + 50.f);
+                                        }
                                     }
-                                }
-                            });
-                    }
+                                });
+                        }
 
-                    if (chunks.size() > 1) {
-                        vira::print::updateProgressBar(bar, "Completed Chunk " + std::to_string(cIdx + 1) + "/" + std::to_string(chunks.size()), 100);
-                    }
-                    else {
-                        vira::print::updateProgressBar(bar, "Completed", 100);
+                        if (chunks.size() > 1) {
+                            vira::print::updateProgressBar(bar, "Completed Chunk " + std::to_string(cIdx + 1) + "/" + std::to_string(chunks.size()), 100);
+                        }
+                        else {
+                            vira::print::updateProgressBar(bar, "Completed", 100);
+                        }
                     }
                 }
-            }
-            catch (std::exception& e) {
-                throw std::runtime_error("While processing: " + input.file.string() + "\n" + std::string(e.what()));
-            }
+                catch (std::exception& e) {
+                    throw std::runtime_error("While processing: " + input.file.string() + "\n" + std::string(e.what()));
+                }
 
-            std::cout << "\n";
-        }
+                std::cout << "\n";
+            }
 
-        // Perform Overlap Removal:
-        std::cout << vira::print::printGreen("Removing overlaps with: ") << std::to_string(overlaps.size()) + " files" << "\n";
-        for (const auto& pair : overlaps) {
-            auto overlapFile = pair.first;
-            std::vector<fs::path> inputPaths = pair.second.paths;
-            fs::path output = pair.second.output;
-
-            // Get list of all quipus to process:
-            std::vector<fs::path> quipuList;
-            for (auto& inputPath : inputPaths) {
-                std::string fileGlob = inputPath.filename().replace_extension("").string() + "*.qld";
-                std::vector<std::string> newQuipusStr = vira::utils::getFiles(output / fileGlob);
-                std::vector<fs::path> newQuipus(newQuipusStr.size());
-                for (size_t i = 0; i < newQuipus.size(); ++i) {
-                    newQuipus[i] = newQuipusStr[i];
+            // Perform Overlap Removal:
+            std::cout << vira::print::printGreen("Removing overlaps with: ") << std::to_string(overlaps.size()) + " files" << "\n";
+            for (const auto& pair : overlaps) {
+                auto overlapFile = pair.first;
+                std::vector<fs::path> inputPaths = pair.second.paths;
+                fs::path output = pair.second.output;
+
+                // Get list of all quipus to process:
+                std::vector<fs::path> quipuList;
+                for (auto& inputPath : inputPaths) {
+                    std::string fileGlob = inputPath.filename().replace_extension("").string() + "*.qld";
+                    std::vector<std::string> newQuipusStr = vira::utils::getFiles(output / fileGlob);
+                    std::vector<fs::path> newQuipus(newQuipusStr.size());
+                    for (size_t i = 0; i < newQuipus.size(); ++i) {
+                        newQuipus[i] = newQuipusStr[i];
+                    }
+                    quipuList.insert(quipuList.end(), newQuipus.begin(), newQuipus.end());
                 }
-                quipuList.insert(quipuList.end(), newQuipus.begin(), newQuipus.end());
-            }
 
-            removeOverlaps<TSpectral, TFloat, TMeshFloat>(overlapFile, quipuList, commandInput.maxAllowedMemory);
-        }
+                removeOverlaps<TSpectral, TFloat, TMeshFloat>(overlapFile, quipuList, commandInput.maxAllowedMemory);
+            }
+        });
     }
     catch (std::exception& e) {
         vira::print::printError(std::string(e.what()));
@@ -0,0 +1,657 @@
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <deque>
+#include <filesystem>
+#include <algorithm>
+#include <stdexcept>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+#include <type_traits>
+
+#include "tclap/CmdLine.h"
+#ifdef _WIN32
+#define YAML_CPP_API
+#endif
+#include "yaml-cpp/yaml.h"
+
+#include "vira/vira.hpp"
+#include "vira/utils/concurrency.hpp"
+#include "vira/utils/yaml_tools.hpp"
+#include "vira/utils/profiler.hpp"
+
+// Create aliases for precision and color types:
+using TFloat = float;
+using TSpectral = vira::Visible_8bin;
+using TMeshFloat = float;
+namespace fs = std::filesystem;
+
+using Clock = std::chrono::steady_clock;
+
+static inline double elapsedMs(Clock::time_point start, Clock::time_point stop)
+{
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+};
+
+
+// YAML Scenario Format:
+struct Epoch {
+    bool has_et = false;
+    double et = 0;
+    std::string label;
+};
+
+struct Scenario {
+    fs::path scene;
+    std::vector<fs::path> kernels;
+    fs::path stars;
+    std::vector<std::string> cameras;
+    std::vector<Epoch> epochs;
+
+    // Renderer settings:
+    vira::rendering::CPUPathTracerOptions pathtracer;
+    bool simulate_lighting = true;
+    bool level_of_detail = true;
+    bool statistics = false;
+
+    // Outputs:
+    fs::path output_directory;
+    std::string image_format = "png";
+    bool grayscale = false;
+    std::vector<std::string> passes;
+    fs::path timing_file;
+    size_t max_pending = 2;
+};
+
+struct Input {
+    fs::path configPath;
+    fs::path rootPath;
+    fs::path tracePath;
+    vira::utils::ConcurrencyOptions concurrency;
+
+    Input() = default;
+    Input(int argc, char* argv[])
+    {
+        TCLAP::CmdLine cmd("Headless batch renderer driven by a YAML scenario.  Tool provided by Vira", ' ', VIRA_VERSION);
+
+        TCLAP::UnlabeledValueArg<std::string> yamlArg("scenario", "Scenario YAML file", true, "", "scenario YAML");
+        cmd.add(yamlArg);
+
+        TCLAP::ValueArg<std::string> rootArg("r", "root-path", "Root file path.  If none is provided, the location of the provided scenario file is used", false, "", "string");
+        cmd.add(rootArg);
+
+        TCLAP::ValueArg<std::string> traceArg("t", "trace", "Write a Chrome trace of every rendering stage to this file", false, "", "string");
+        cmd.add(traceArg);
+
+        TCLAP::ValueArg<size_t> threadsArg("j", "threads", "Maximum number of threads to use (0 uses all cores)", false, 0, "int");
+        cmd.add(threadsArg);
+
+        TCLAP::ValueArg<int> numaArg("", "numa-node", "NUMA node to run on", false, -1, "int");
+        cmd.add(numaArg);
+
+        TCLAP::SwitchArg pinArg("", "pin-threads", "Pin each thread to its own core", false);
+        cmd.add(pinArg);
+
+        TCLAP::ValueArg<size_t> firstCoreArg("", "first-core", "First core to pin threads to (within the NUMA node, if one is given)", false, 0, "int");
+        cmd.add(firstCoreArg);
+
+
+        // Parse the inputs:
+        cmd.parse(argc, argv);
+        configPath = yamlArg.getValue();
+        vira::utils::validateFile(configPath);
+
+        rootPath = rootArg.getValue();
+        if (rootPath.empty()) {
+            rootPath = configPath.parent_path();
+        }
+        rootPath = fs::absolute(rootPath);
+        vira::utils::validateDirectory(rootPath);
+
+        tracePath = traceArg.getValue();
+
+        concurrency.max_threads = threadsArg.getValue();
+        concurrency.numa_node = numaArg.getValue();
+        concurrency.pin_threads = pinArg.getValue();
+        concurrency.first_core = firstCoreArg.getValue();
+    }
+};
+
+static inline Epoch parseEpoch(const YAML::Node& node)
+{
+    Epoch epoch;
+    epoch.has_et = true;
+
+    // Numbers are ephemeris times, and anything else is a SPICE time string:
+    try {
+        epoch.et = node.as<double>();
+        epoch.label = "ET " + node.as<std::string>();
+    }
+    catch (const YAML::Exception&) {
+        epoch.label = node.as<std::string>();
+        epoch.et = vira::SpiceUtils<TFloat>::stringToET(epoch.label);
+    }
+    return epoch;
+};
+
+static inline Scenario parseYAML(const Input& input)
+{
+    YAML::Node config = YAML::LoadFile(input.configPath.string());
+    Scenario scenario;
+
+    // Scene (a snapshot written by Scene::saveSnapshot):
+    if (!config["scene"]) {
+        throw std::runtime_error("Scenario must provide a scene snapshot (.qss) file");
+    }
+    scenario.scene = vira::utils::combinePaths(input.rootPath, config["scene"].as<std::string>());
+
+    // SPICE kernels (must be loaded before any epoch strings can be converted):
+    if (config["kernels"]) {
+        for (const auto& kernel : config["kernels"]) {
+            fs::path kernelPath = vira::utils::combinePaths(input.rootPath, kernel.as<std::string>());
+            vira::SpiceUtils<TFloat>::furnsh_relative_to_file(kernelPath);
+            scenario.kernels.push_back(kernelPath);
+        }
+    }
+
+    if (config["stars"]) {
+        scenario.stars = vira::utils::combinePaths(input.rootPath, config["stars"].as<std::string>());
+    }
+
+    // Cameras:
+    if (!config["cameras"] || config["cameras"].size() == 0) {
+        throw std::runtime_error("Scenario must list at least one camera");
+    }
+    for (const auto& camera : config["cameras"]) {
+        scenario.cameras.push_back(camera.as<std::string>());
+    }
+
+    // Epochs, given either as a list or as a regularly spaced range:
+    const YAML::Node& epochs = config["epochs"];
+    if (!epochs) {
+        scenario.epochs.push_back(Epoch{ false, 0, "snapshot state" });
+    }
+    else if (epochs.IsSequence()) {
+        for (const auto& epoch : epochs) {
+            scenario.epochs.push_back(parseEpoch(epoch));
+        }
+    }
+    else if (epochs.IsMap()) {
+        Epoch start = parseEpoch(epochs["start"]);
+        double step = epochs["step"] ? epochs["step"].as<double>() : 0.;
+        size_t count = epochs["count"] ? epochs["count"].as<size_t>() : 1;
+        for (size_t i = 0; i < count; ++i) {
+            double et = start.et + static_cast<double>(i) * step;
+            std::ostringstream label;
+            label << std::fixed << std::setprecision(3) << "ET " << et;
+            scenario.epochs.push_back(Epoch{ true, et, label.str() });
+        }
+    }
+    if (scenario.epochs.empty()) {
+        throw std::runtime_error("Scenario does not define any epochs");
+    }
+
+    // Renderer settings:
+    const YAML::Node& pt = config["pathtracer"];
+    if (pt) {
+        scenario.pathtracer.samples = pt["samples"] ? pt["samples"].as<size_t>() : scenario.pathtracer.samples;
+        scenario.pathtracer.bounces = pt["bounces"] ? pt["bounces"].as<size_t>() : scenario.pathtracer.bounces;
+        scenario.pathtracer.adaptive_sampling = vira::utils::readBoolean(pt, "adaptive-sampling", scenario.pathtracer.adaptive_sampling);
+        scenario.pathtracer.sampling_tolerance = pt["sampling-tolerance"] ? pt["sampling-tolerance"].as<float>() : scenario.pathtracer.sampling_tolerance;
+        scenario.pathtracer.denoise = vira::utils::readBoolean(pt, "denoise", scenario.pathtracer.denoise);
+        scenario.pathtracer.show_background = vira::utils::readBoolean(pt, "show-background", scenario.pathtracer.show_background);
+        scenario.pathtracer.raster_primary = vira::utils::readBoolean(pt, "raster-primary", scenario.pathtracer.raster_primary);
+        scenario.pathtracer.shadow_cache = vira::utils::readBoolean(pt, "shadow-cache", scenario.pathtracer.shadow_cache);
+        scenario.simulate_lighting = vira::utils::readBoolean(pt, "simulate-lighting", scenario.simulate_lighting);
+    }
+    scenario.level_of_detail = vira::utils::readBoolean(config, "level-of-detail", scenario.level_of_detail);
+    scenario.statistics = vira::utils::readBoolean(config, "statistics", scenario.statistics);
+
+    // Outputs:
+    const YAML::Node& outputs = config["outputs"];
+    fs::path outputDir = (outputs && outputs["directory"]) ? fs::path(outputs["directory"].as<std::string>()) : fs::path("renders");
+    scenario.output_directory = fs::weakly_canonical(vira::utils::combinePaths(input.rootPath, outputDir, false));
+    vira::utils::makePath(scenario.output_directory);
+    vira::utils::validateDirectory(scenario.output_directory);
+
+    if (outputs) {
+        if (outputs["image"]) {
+            scenario.image_format = outputs["image"].as<std::string>();
+        }
+        scenario.grayscale = vira::utils::readBoolean(outputs, "grayscale", scenario.grayscale);
+
+        if (outputs["passes"]) {
+            const std::vector<std::string> valid = { "depth", "alpha", "normals", "camera-normals", "velocity", "instance-id", "mesh-id", "triangle-id", "material-id" };
+            for (const auto& pass : outputs["passes"]) {
+                std::string name = pass.as<std::string>();
+                if (std::find(valid.begin(), valid.end(), name) == valid.end()) {
+                    throw std::runtime_error("Unknown output pass: " + name);
+                }
+                scenario.passes.push_back(name);
+            }
+        }
+
+        if (outputs["timing"]) {
+            scenario.timing_file = vira::utils::combinePaths(scenario.output_directory, outputs["timing"].as<std::string>(), false);
+        }
+
+        if (outputs["max-pending"]) {
+            scenario.max_pending = std::max<size_t>(1, outputs["max-pending"].as<size_t>());
+        }
+    }
+
+    const std::vector<std::string> formats = { "png", "jpg", "tga", "bmp", "tif", "fits", "none" };
+    if (std::find(formats.begin(), formats.end(), scenario.image_format) == formats.end()) {
+        throw std::runtime_error("Unsupported image output format: " + scenario.image_format);
+    }
+
+    return scenario;
+};
+
+
+// ======================== //
+// === Pipelined Output === //
+// ======================== //
+struct FrameTiming {
+    size_t frame = 0;
+    std::string camera;
+    std::string epoch;
+    double update_ms = 0;   ///< SPICE and level of detail updates
+    double render_ms = 0;   ///< Rendering, including sensor simulation
+    double copy_ms = 0;     ///< Copying outputs for the writer
+    double stall_ms = 0;    ///< Time spent waiting for the writer to catch up
+    double write_ms = 0;    ///< Time spent writing (overlapped with later frames)
+    double rays_per_second = 0;
+};
+
+struct Frame {
+    size_t index = 0;
+    std::vector<std::function<void()>> writes;
+};
+
+/**
+ * Writes rendered frames on a background thread, so that encoding and disk I/O of one frame overlap with
+ * rendering the next.  At most max_pending frames are held in memory; push() blocks once that many are waiting.
+ */
+class FrameWriter {
+public:
+    FrameWriter(size_t max_pending, std::vector<FrameTiming>& timings) :
+        max_pending_{ max_pending }, timings_{ timings }
+    {
+        thread_ = std::thread([this]() { this->run(); });
+    };
+
+    ~FrameWriter()
+    {
+        if (thread_.joinable()) {
+            this->close();
+            thread_.join();
+        }
+    };
+
+    FrameWriter(const FrameWriter&) = delete;
+    FrameWriter& operator=(const FrameWriter&) = delete;
+
+    void push(Frame frame)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        space_.wait(lock, [this]() { return queue_.size() < max_pending_ || error_ != nullptr; });
+        if (error_ != nullptr) {
+            std::rethrow_exception(error_);
+        }
+
+        queue_.push_back(std::move(frame));
+        ready_.notify_one();
+    };
+
+    void finish()
+    {
+        this->close();
+        thread_.join();
+
+        if (error_ != nullptr) {
+            std::rethrow_exception(error_);
+        }
+    };
+
+private:
+    void close()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        ready_.notify_one();
+    };
+
+    void run()
+    {
+        while (true) {
+            Frame frame;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                ready_.wait(lock, [this]() { return !queue_.empty() || closed_; });
+                if (queue_.empty()) {
+                    return;
+                }
+                frame = std::move(queue_.front());
+            }
+
+            auto start = Clock::now();
+            try {
+                for (auto& write : frame.writes) {
+                    write();
+                }
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                error_ = std::current_exception();
+                queue_.clear();
+                space_.notify_all();
+                return;
+            }
+            double write_ms = elapsedMs(start, Clock::now());
+
+            // The frame is only released once written, so at most max_pending frames are held in memory:
+            std::lock_guard<std::mutex> lock(mutex_);
+            timings_[frame.index].write_ms = write_ms;
+            queue_.pop_front();
+            space_.notify_one();
+        }
+    };
+
+    size_t max_pending_;
+    std::vector<FrameTiming>& timings_;
+
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::condition_variable space_;
+    std::deque<Frame> queue_;
+    bool closed_ = false;
+    std::exception_ptr error_ = nullptr;
+
+    std::thread thread_;
+};
+
+/**
+ * Queue writes of the requested passes.  Images are copied, as the renderer reuses its passes for the next frame.
+ */
+static inline void addPassWrites(Frame& frame, const Scenario& scenario, const vira::rendering::RenderPasses<TSpectral, TFloat>& passes, const fs::path& stem)
+{
+    auto path = [&](const std::string& pass) { return fs::path(stem.string() + "_" + pass + ".png"); };
+
+    for (const std::string& pass : scenario.passes) {
+        if (pass == "depth") {
+            frame.writes.push_back([p = path(pass), image = passes.depth]() { vira::images::ImageInterface::writeMap(p, image); });
+        }
+        else if (pass == "alpha") {
+            frame.writes.push_back([p = path(pass), image = passes.alpha]() { vira::images::ImageInterface::write(p, image); });
+        }
+        else if (pass == "normals") {
+            frame.writes.push_back([p = path(pass), image = passes.normal_global]() { vira::images::ImageInterface::writeNormals(p, image); });
+        }
+        else if (pass == "camera-normals") {
+            frame.writes.push_back([p = path(pass), image = passes.normal_camera]() { vira::images::ImageInterface::writeNormals(p, image); });
+        }
+        else if (pass == "velocity") {
+            frame.writes.push_back([p = path(pass), image = passes.velocity_global]() { vira::images::ImageInterface::writeVelocities(p, image); });
+        }
+        else if (pass == "instance-id") {
+            frame.writes.push_back([p = path(pass), image = passes.instance_id]() { vira::images::ImageInterface::writeIDs(p, image); });
+        }
+        else if (pass == "mesh-id") {
+            frame.writes.push_back([p = path(pass), image = passes.mesh_id]() { vira::images::ImageInterface::writeIDs(p, image); });
+        }
+        else if (pass == "triangle-id") {
+            frame.writes.push_back([p = path(pass), image = passes.triangle_id]() { vira::images::ImageInterface::writeIDs(p, image); });
+        }
+        else if (pass == "material-id") {
+            frame.writes.push_back([p = path(pass), image = passes.material_id]() { vira::images::ImageInterface::writeIDs(p, image); });
+        }
+    }
+};
+
+template <typename T>
+static inline void addImageWrite(Frame& frame, const std::string& format, vira::images::Image<T> image, const fs::path& stem)
+{
+    fs::path p = fs::path(stem.string() + "." + format);
+    if (format == "tif") {
+        frame.writes.push_back([p, image = std::move(image)]() { vira::images::ImageInterface::writeTIFF(p, image); });
+    }
+    else if (format == "fits") {
+        frame.writes.push_back([p, image = std::move(image)]() { vira::images::ImageInterface::writeFITS(p, image); });
+    }
+    else {
+        // 8-bit formats are written in sRGB:
+        frame.writes.push_back([p, image = std::move(image)]() {
+            if constexpr (std::is_same_v<T, vira::ColorRGB>) {
+                vira::images::ImageInterface::write(p, vira::images::linearToSRGB(image));
+            }
+            else {
+                vira::images::ImageInterface::write(p, image);
+            }
+            });
+    }
+};
+
+static inline void writeTimings(const fs::path& filepath, const std::vector<FrameTiming>& timings)
+{
+    std::ofstream file(filepath);
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not open timing file for writing: " + filepath.string());
+    }
+
+    file << "frame,camera,epoch,update_ms,render_ms,copy_ms,stall_ms,write_ms,rays_per_second\n";
+    file << std::fixed << std::setprecision(3);
+    for (const FrameTiming& t : timings) {
+        file << t.frame << "," << t.camera << ",\"" << t.epoch << "\"," << t.update_ms << "," << t.render_ms << ","
+            << t.copy_ms << "," << t.stall_ms << "," << t.write_ms << "," << t.rays_per_second << "\n";
+    }
+};
+
+static inline void printSummary(const std::vector<FrameTiming>& timings, double wall_ms)
+{
+    FrameTiming total;
+    for (const FrameTiming& t : timings) {
+        total.update_ms += t.update_ms;
+        total.render_ms += t.render_ms;
+        total.copy_ms += t.copy_ms;
+        total.stall_ms += t.stall_ms;
+        total.write_ms += t.write_ms;
+    }
+
+    double frames = static_cast<double>(std::max<size_t>(1, timings.size()));
+    std::cout << "\n" << vira::print::printGreen("Rendered " + std::to_string(timings.size()) + " frames") << "\n";
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << vira::print::VIRA_INDENT << std::left << std::setw(10) << "Stage" << std::right << std::setw(14) << "Total (ms)" << std::setw(14) << "Mean (ms)" << "\n";
+
+    auto row = [&](const std::string& name, double ms) {
+        std::cout << vira::print::VIRA_INDENT << std::left << std::setw(10) << name << std::right << std::setw(14) << ms << std::setw(14) << ms / frames << "\n";
+    };
+    row("Update", total.update_ms);
+    row("Render", total.render_ms);
+    row("Copy", total.copy_ms);
+    row("Stall", total.stall_ms);
+    row("Write", total.write_ms);
+
+    std::cout << vira::print::VIRA_INDENT << "Wall time: " << wall_ms << " ms (" << std::setprecision(3) << 1000. * frames / wall_ms << " frames/s)\n";
+    std::cout << vira::print::VIRA_INDENT << std::setprecision(1) << "Write time hidden by pipelining: " << std::max(0., total.write_ms - total.stall_ms) << " ms\n";
+};
+
+
+int main(int argc, char* argv[])
+{
+    // Parse command line inputs:
+    Input input;
+    try {
+        vira::print::initializePrinting();
+        input = Input(argc, argv);
+    }
+    catch (TCLAP::ArgException& e)
+    {
+        vira::print::printError(e.error() + " for arg " + e.argId());
+        return 1;
+    }
+    catch (std::exception& e) {
+        vira::print::printError(e.what());
+        return 1;
+    }
+
+    // Parse the YAML scenario:
+    Scenario scenario;
+    try {
+        scenario = parseYAML(input);
+    }
+    catch (std::exception& e)
+    {
+        vira::print::printError(e.what());
+        return 1;
+    }
+
+    // ========================= //
+    // === Perform Rendering === //
+    // ========================= //
+    try {
+        if (!input.tracePath.empty()) {
+            vira::utils::enableProfiling();
+        }
+
+        // Load the scene:
+        vira::Scene<TSpectral, TFloat, TMeshFloat> scene;
+        scene.setConcurrency(input.concurrency);
+
+        auto start = Clock::now();
+        scene.loadSnapshot(scenario.scene);
+        std::cout << vira::print::printGreen("Loaded scene: ") << scenario.scene.filename().string() << " (" << std::fixed << std::setprecision(1) << elapsedMs(start, Clock::now()) << " ms)\n";
+
+        vira::unresolved::StarCatalogue stars;
+        if (!scenario.stars.empty()) {
+            stars = vira::quipu::StarQuipu::read(scenario.stars);
+        }
+
+        // Each camera renders through its own context, so its passes and shadow caches persist between epochs:
+        scene.pathtracer.options = scenario.pathtracer;
+        scene.pathtracer.options.collect_statistics = scenario.statistics;
+        scene.pathtracer.renderPasses.simulate_lighting = scenario.simulate_lighting;
+        scene.pathtracer.renderPasses.save_velocity = std::find(scenario.passes.begin(), scenario.passes.end(), "velocity") != scenario.passes.end();
+
+        std::vector<vira::CameraID> cameraIDs;
+        std::vector<vira::rendering::RenderContext<TSpectral, TFloat, TMeshFloat>> contexts;
+        for (const std::string& name : scenario.cameras) {
+            cameraIDs.push_back(scene.searchCameraName(name));
+            contexts.push_back(scene.newRenderContext());
+        }
+
+        size_t frameCount = scenario.epochs.size() * cameraIDs.size();
+        std::cout << vira::print::printGreen("Rendering " + std::to_string(frameCount) + " frames") << " ("
+            << scenario.epochs.size() << " epochs, " << cameraIDs.size() << " cameras) to " << scenario.output_directory.string() << "\n";
+
+        std::vector<FrameTiming> timings(frameCount);
+        FrameWriter writer(scenario.max_pending, timings);
+
+        auto renderStart = Clock::now();
+        size_t frameIdx = 0;
+        for (size_t e = 0; e < scenario.epochs.size(); ++e) {
+            const Epoch& epoch = scenario.epochs[e];
+
+            auto updateStart = Clock::now();
+            if (epoch.has_et) {
+                scene.setSpiceET(epoch.et);
+            }
+            if (e == 0 && !scenario.stars.empty()) {
+                // Proper motion over the span of a scenario is negligible, so stars are placed once (at the
+                // ephemeris time stored in the snapshot if the scenario does not define any epochs):
+                scene.addStarLight(stars, scene.getSpiceET());
+            }
+            double epochUpdateMs = elapsedMs(updateStart, Clock::now());
+
+            for (size_t c = 0; c < cameraIDs.size(); ++c) {
+                FrameTiming& timing = timings[frameIdx];
+                timing.frame = frameIdx;
+                timing.camera = scenario.cameras[c];
+                timing.epoch = epoch.label;
+
+                auto t0 = Clock::now();
+                if (scenario.level_of_detail) {
+                    scene.updateLevelOfDetail(cameraIDs[c]);
+                }
+                auto t1 = Clock::now();
+
+                // Context renders do not modify the scene, so pending updates are applied first:
+                scene.prepareRender({ cameraIDs[c] });
+
+                std::ostringstream stem;
+                stem << scenario.cameras[c] << "_" << std::setw(5) << std::setfill('0') << e;
+                fs::path stemPath = scenario.output_directory / stem.str();
+
+                Frame frame;
+                frame.index = frameIdx;
+                Clock::time_point t2;
+                if (scenario.grayscale) {
+                    auto image = scene.render(cameraIDs[c], contexts[c]);
+                    t2 = Clock::now();
+                    if (scenario.image_format != "none") {
+                        addImageWrite(frame, scenario.image_format, std::move(image), stemPath);
+                    }
+                }
+                else {
+                    auto image = scene.renderRGB(cameraIDs[c], contexts[c]);
+                    t2 = Clock::now();
+                    if (scenario.image_format != "none") {
+                        addImageWrite(frame, scenario.image_format, std::move(image), stemPath);
+                    }
+                }
+                addPassWrites(frame, scenario, contexts[c].pathtracer.renderPasses, stemPath);
+                auto t3 = Clock::now();
+
+                writer.push(std::move(frame));
+                auto t4 = Clock::now();
+
+                timing.update_ms = ((c == 0) ? epochUpdateMs : 0.) + elapsedMs(t0, t1);
+                timing.render_ms = elapsedMs(t1, t2);
+                timing.copy_ms = elapsedMs(t2, t3);
+                timing.stall_ms = elapsedMs(t3, t4);
+                if (scenario.statistics) {
+                    timing.rays_per_second = contexts[c].pathtracer.statistics.raysPerSecond();
+                }
+
+                std::cout << vira::print::VIRA_INDENT << "Frame " << (frameIdx + 1) << "/" << frameCount << "  "
+                    << std::left << std::setw(12) << timing.camera << std::right << " " << timing.epoch
+                    << std::fixed << std::setprecision(1)
+                    << "  update " << timing.update_ms << " ms, render " << timing.render_ms << " ms";
+                if (scenario.statistics) {
+                    std::cout << " (" << std::setprecision(2) << timing.rays_per_second * 1e-6 << " Mrays/s)";
+                }
+                std::cout << "\n" << std::flush;
+
+                frameIdx++;
+            }
+        }
+
+        writer.finish();
+        double wallMs = elapsedMs(renderStart, Clock::now());
+
+        printSummary(timings, wallMs);
+
+        if (!scenario.timing_file.empty()) {
+            writeTimings(scenario.timing_file, timings);
+            std::cout << vira::print::VIRA_INDENT << "Frame timings written to: " << scenario.timing_file.string() << "\n";
+        }
+
+        if (!input.tracePath.empty()) {
+            vira::utils::Profiler::get().writeChromeTrace(input.tracePath);
+            std::cout << vira::print::VIRA_INDENT << "Trace written to: " << input.tracePath.string() << "\n";
+        }
+    }
+    catch (std::exception& err) {
+        vira::print::printError(err.what());
+        return 1;
+    }
+
+    return 0;
+};
@@ -10,6 +10,7 @@
 
 #include "vira/vira.hpp"
 #include "vira/utils/print_utils.hpp"
+#include "vira/utils/concurrency.hpp"
 
 using TFloat = float;
 using TSpectral = vira::Visible_1bin;
@@ -21,6 +22,7 @@ struct Input {
     bool compressData;
     bool writeAlbedos;
     bool parallel;
+    vira::utils::ConcurrencyOptions concurrency;
 
     Input() = default;
     Input(int argc, char* argv[])
@@ -44,6 +46,18 @@ struct Input {
         TCLAP::SwitchArg parallelArg("p", "parallel", "Process files in parallel", false);
         cmd.add(parallelArg);
 
+        TCLAP::ValueArg<size_t> threadsArg("j", "threads", "Maximum number of threads to use with --parallel (0 uses all cores)", false, 0, "int");
+        cmd.add(threadsArg);
+
+        TCLAP::ValueArg<int> numaArg("", "numa-node", "NUMA node to run on", false, -1, "int");
+        cmd.add(numaArg);
+
+        TCLAP::SwitchArg pinArg("", "pin-threads", "Pin each thread to its own core", false);
+        cmd.add(pinArg);
+
+        TCLAP::ValueArg<size_t> firstCoreArg("", "first-core", "First core to pin threads to (within the NUMA node, if one is given)", false, 0, "int");
+        cmd.add(firstCoreArg);
+
         // Parse the argv array.
         cmd.parse(argc, argv);
 
@@ -53,6 +67,10 @@ struct Input {
         compressData = compressArg.getValue();
         writeAlbedos = albedoArg.getValue();
         parallel = parallelArg.getValue();
+        concurrency.max_threads = threadsArg.getValue();
+        concurrency.numa_node = numaArg.getValue();
+        concurrency.pin_threads = pinArg.getValue();
+        concurrency.first_core = firstCoreArg.getValue();
 
         // Validate inputs:
         if (inputs.size() == 0) {
@@ -120,32 +138,35 @@ int main(int argc, char* argv[])
         options.writeAlbedos = input.writeAlbedos;
         if (input.parallel) {
             std::atomic<size_t> counter(0);
-            tbb::parallel_for(tbb::blocked_range<size_t>(0, input.filepaths.size()),
-                [&](tbb::blocked_range<size_t> r)
-                {
-                    for (size_t i = r.begin(); i < r.end(); ++i) {
-                        // Load the SPCMaplet:
-                        vira::mat4<double> transformation = spcMapletInterface.loadTransformation(input.filepaths[i]);
-                        vira::dems::DEM<TSpectral, TFloat, TMeshFloat> spcMaplet = spcMapletInterface.load(input.filepaths[i], spcOptions);
-
-                        // Make the DEM Pyramid:
-                        std::vector<vira::dems::DEM<TSpectral, TFloat, TMeshFloat>> pyramid = spcMaplet.makePyramid();
-
-                        // Format output filepath:
-                        std::filesystem::path fullPath = input.outputDirectory;
-                        fullPath /= vira::utils::getFileName(input.filepaths[i]);
-                        std::string quipuFile = fullPath.generic_string() + ".qld";
-
-                        // Write:
-                        vira::quipu::DEMQuipu<TSpectral, TFloat, TMeshFloat>::write(quipuFile, pyramid, transformation, options);
-
-                        // Update progress bar periodically
-                        size_t current = ++counter;
-                        if (current % N == 0 || current == input.filepaths.size()) {
-                            vira::print::updateProgressBar(bar, 99 * static_cast<float>(current) / static_cast<float>(input.filepaths.size()));
+            vira::utils::ConcurrencyContext concurrency(input.concurrency);
+            concurrency.execute([&] {
+                tbb::parallel_for(tbb::blocked_range<size_t>(0, input.filepaths.size()),
+                    [&](tbb::blocked_range<size_t> r)
+                    {
+                        for (size_t i = r.begin(); i < r.end(); ++i) {
+                            // Load the SPCMaplet:
+                            vira::mat4<double> transformation = spcMapletInterface.loadTransformation(input.filepaths[i]);
+                            vira::dems::DEM<TSpectral, TFloat, TMeshFloat> spcMaplet = spcMapletInterface.load(input.filepaths[i], spcOptions);
+
+                            // Make the DEM Pyramid:
+                            std::vector<vira::dems::DEM<TSpectral, TFloat, TMeshFloat>> pyramid = spcMaplet.makePyramid();
+
+                            // Format output filepath:
+                            std::filesystem::path fullPath = input.outputDirectory;
+                            fullPath /= vira::utils::getFileName(input.filepaths[i]);
+                            std::string quipuFile = fullPath.generic_string() + ".qld";
+
+                            // Write:
+                            vira::quipu::DEMQuipu<TSpectral, TFloat, TMeshFloat>::write(quipuFile, pyramid, transformation, options);
+
+                            // Update progress bar periodically
+                            size_t current = ++counter;
+                            if (current % N == 0 || current == input.filepaths.size()) {
+                                vira::print::updateProgressBar(bar, 99 * static_cast<float>(current) / static_cast<float>(input.filepaths.size()));
+                            }
                         }
-                    }
-                });
+                    });
+            });
         }
         else {
             for (size_t i = 0; i < input.filepaths.size(); ++i)
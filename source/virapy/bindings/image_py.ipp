@@ -0,0 +1,151 @@
+#ifndef VIRAPY_IMAGE_PY
+#define VIRAPY_IMAGE_PY
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <type_traits>
+
+#include "pybind11/pybind11.h"
+#include "pybind11/stl.h"
+#include "pybind11/numpy.h"
+
+#include "vira/constraints.hpp"
+#include "vira/vec.hpp"
+#include "vira/spectral_data.hpp"
+#include "vira/images/image.hpp"
+#include "vira/images/resolution.hpp"
+#include "vira/rendering/passes.hpp"
+
+namespace py = pybind11;
+
+namespace vira {
+    // Describes how a pixel type is laid out in memory (scalar type and number of channels):
+    template <typename T>
+    struct PixelLayout {
+        using Scalar = T;
+        static constexpr size_t channels = 1;
+    };
+
+    template <IsSpectral TSpectral>
+    struct PixelLayout<TSpectral> {
+        using Scalar = float;
+        static constexpr size_t channels = TSpectral::size();
+    };
+
+    template <IsFloat TFloat>
+    struct PixelLayout<vec3<TFloat>> {
+        using Scalar = TFloat;
+        static constexpr size_t channels = 3;
+    };
+
+    /**
+     * @brief Describes the pixel data of an Image as a (height, width[, channels]) buffer
+     * @param image The image whose memory will be viewed
+     * @return Buffer info pointing directly at the image's memory
+     */
+    template <typename T>
+    py::buffer_info image_buffer_info(vira::images::Image<T>& image)
+    {
+        using Scalar = typename PixelLayout<T>::Scalar;
+        constexpr size_t channels = PixelLayout<T>::channels;
+        static_assert(sizeof(T) == channels * sizeof(Scalar), "Pixel type must be tightly packed to be viewed as an array");
+
+        auto resolution = image.resolution();
+        py::ssize_t height = static_cast<py::ssize_t>(resolution.y);
+        py::ssize_t width = static_cast<py::ssize_t>(resolution.x);
+        py::ssize_t itemsize = static_cast<py::ssize_t>(sizeof(Scalar));
+
+        // Pixels are stored row-major, with index i + j * width:
+        std::vector<py::ssize_t> shape{ height, width };
+        std::vector<py::ssize_t> strides{ width * static_cast<py::ssize_t>(sizeof(T)), static_cast<py::ssize_t>(sizeof(T)) };
+        if constexpr (channels > 1) {
+            shape.push_back(static_cast<py::ssize_t>(channels));
+            strides.push_back(itemsize);
+        }
+
+        return py::buffer_info(
+            image.data(),
+            itemsize,
+            py::format_descriptor<Scalar>::format(),
+            static_cast<py::ssize_t>(shape.size()),
+            shape,
+            strides
+        );
+    };
+
+    template <typename T>
+    void bind_image(py::module& m, const std::string& suffix) {
+        using ImageT = vira::images::Image<T>;
+
+        py::class_<ImageT>(m, ("Image_" + suffix).c_str(), py::buffer_protocol())
+            .def(py::init<>(), "Default constructor")
+            .def(py::init<vira::images::Resolution, T>(), "Construct an image filled with a value",
+                py::arg("resolution"), py::arg("defaultValue") = T{ 0 })
+
+            // Zero-copy views (valid until the image is resized or cleared):
+            .def_buffer([](ImageT& image) { return image_buffer_info<T>(image); })
+            .def("numpy", [](py::object self) {
+                ImageT& image = self.cast<ImageT&>();
+                return py::array(image_buffer_info<T>(image), self);
+                }, "View the pixel data as a NumPy array of shape (height, width[, channels]) without copying")
+            .def("alpha_numpy", [](py::object self) {
+                ImageT& image = self.cast<ImageT&>();
+                if (!image.hasAlpha()) {
+                    return py::array_t<float>();
+                }
+                auto resolution = image.resolution();
+                std::vector<py::ssize_t> shape{ resolution.y, resolution.x };
+                return py::array_t<float>(shape, image.getAlpha().data(), self);
+                }, "View the alpha channel as a NumPy array of shape (height, width) without copying")
+
+            // Meta-data:
+            .def("resolution", py::overload_cast<>(&ImageT::resolution, py::const_), "Get the image resolution")
+            .def("size", &ImageT::size, "Get the number of pixels")
+            .def("numChannels", &ImageT::numChannels, "Get the number of channels per pixel")
+            .def("hasAlpha", &ImageT::hasAlpha, "Check if the image has an alpha channel")
+            .def("__len__", &ImageT::size);
+    };
+
+    template <IsSpectral TSpectral, IsFloat TFloat>
+    void bind_render_passes(py::module& m, const std::string& suffix) {
+        using Passes = vira::rendering::RenderPasses<TSpectral, TFloat>;
+
+        // Images are returned by reference, so np.asarray(passes.depth) views the renderer's memory directly:
+        constexpr auto ref = py::return_value_policy::reference_internal;
+
+        py::class_<Passes>(m, ("RenderPasses_" + suffix).c_str())
+            .def(py::init<>(), "Default constructor")
+
+            // Required passes
+            .def_property_readonly("depth", [](Passes& p) -> auto& { return p.depth; }, ref)
+            .def_property_readonly("alpha", [](Passes& p) -> auto& { return p.alpha; }, ref)
+            .def_property_readonly("albedo", [](Passes& p) -> auto& { return p.albedo; }, ref)
+            .def_property_readonly("normal_global", [](Passes& p) -> auto& { return p.normal_global; }, ref)
+            .def_property_readonly("normal_camera", [](Passes& p) -> auto& { return p.normal_camera; }, ref)
+            .def_property_readonly("instance_id", [](Passes& p) -> auto& { return p.instance_id; }, ref)
+            .def_property_readonly("mesh_id", [](Passes& p) -> auto& { return p.mesh_id; }, ref)
+            .def_property_readonly("triangle_id", [](Passes& p) -> auto& { return p.triangle_id; }, ref)
+            .def_property_readonly("material_id", [](Passes& p) -> auto& { return p.material_id; }, ref)
+
+            // Optional passes
+            .def_readwrite("simulate_lighting", &Passes::simulate_lighting)
+            .def_property_readonly("received_power", [](Passes& p) -> auto& { return p.received_power; }, ref)
+            .def_property_readonly("total_radiance", [](Passes& p) -> auto& { return p.total_radiance; }, ref)
+            .def_property_readonly("direct_radiance", [](Passes& p) -> auto& { return p.direct_radiance; }, ref)
+            .def_property_readonly("indirect_radiance", [](Passes& p) -> auto& { return p.indirect_radiance; }, ref)
+
+            .def_readwrite("save_velocity", &Passes::save_velocity)
+            .def_property_readonly("velocity_global", [](Passes& p) -> auto& { return p.velocity_global; }, ref)
+            .def_property_readonly("velocity_camera", [](Passes& p) -> auto& { return p.velocity_camera; }, ref)
+
+            .def_readwrite("save_triangle_size", &Passes::save_triangle_size)
+            .def_property_readonly("triangle_size", [](Passes& p) -> auto& { return p.triangle_size; }, ref)
+
+            .def("resetImages", &Passes::resetImages, "Reset all pass images to their default values")
+            .def("initializeImages", &Passes::initializeImages, "Allocate all pass images at a given resolution",
+                py::arg("resolution"));
+    };
+};
+
+#endif
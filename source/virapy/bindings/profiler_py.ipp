@@ -0,0 +1,41 @@
+#ifndef VIRAPY_PROFILER_PY
+#define VIRAPY_PROFILER_PY
+
+#include <string>
+
+#include "pybind11/pybind11.h"
+#include "pybind11/stl.h"
+
+#include "vira/utils/profiler.hpp"
+
+namespace py = pybind11;
+
+namespace vira {
+    static inline void bind_profiler(py::module& m)
+    {
+        using utils::Profiler;
+        using utils::ProfileStatistics;
+
+        py::class_<ProfileStatistics>(m, "ProfileStatistics")
+            .def_readonly("name", &ProfileStatistics::name)
+            .def_readonly("count", &ProfileStatistics::count)
+            .def_readonly("total_ms", &ProfileStatistics::total_ms)
+            .def_readonly("min_ms", &ProfileStatistics::min_ms)
+            .def_readonly("max_ms", &ProfileStatistics::max_ms)
+            .def("mean_ms", &ProfileStatistics::mean_ms)
+            .def("__repr__", [](const ProfileStatistics& s) {
+                return "<ProfileStatistics " + s.name + ": " + std::to_string(s.count) + " calls, " + std::to_string(s.total_ms) + " ms>";
+                });
+
+        // The profiler is a process-wide singleton, so it is exposed as module-level functions:
+        m.def("enableProfiling", &utils::enableProfiling, "Start recording timed zones");
+        m.def("disableProfiling", &utils::disableProfiling, "Stop recording timed zones");
+        m.def("clearProfile", []() { Profiler::get().clear(); }, "Discard all recorded zones");
+        m.def("getProfileStatistics", []() { return Profiler::get().getStatistics(); }, "Summarize the recorded zones by name");
+        m.def("formatProfileStatistics", []() { return Profiler::get().formatStatistics(); }, "Format the zone statistics as a table");
+        m.def("writeChromeTrace", [](const std::string& filepath) { Profiler::get().writeChromeTrace(filepath); },
+            "Write the recorded zones for chrome://tracing or Perfetto", py::arg("filepath"));
+    };
+};
+
+#endif
@@ -0,0 +1,408 @@
+#ifndef VIRAPY_SCENE_PY
+#define VIRAPY_SCENE_PY
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "pybind11/pybind11.h"
+#include "pybind11/stl.h"
+
+#include "vira/constraints.hpp"
+#include "vira/math.hpp"
+#include "vira/spectral_data.hpp"
+#include "vira/scene.hpp"
+#include "vira/scene/ids.hpp"
+#include "vira/scene/group.hpp"
+#include "vira/scene/instance.hpp"
+#include "vira/scene/lod_manager.hpp"
+#include "vira/cameras/camera.hpp"
+#include "vira/lights/light.hpp"
+#include "vira/rendering/cpu_path_tracer.hpp"
+#include "vira/rendering/render_context.hpp"
+#include "vira/rendering/render_control.hpp"
+#include "vira/rendering/ray_statistics.hpp"
+#include "vira/quipu/scene_snapshot.hpp"
+#include "vira/units/units.hpp"
+#include "vira/utils/concurrency.hpp"
+#include "vira/utils/memory_usage.hpp"
+
+namespace py = pybind11;
+namespace fs = std::filesystem;
+
+namespace vira {
+    // Releases the GIL while rendering and loading, so other Python threads keep running:
+    using release_gil = py::call_guard<py::gil_scoped_release>;
+
+    template <IsTypedID IDType>
+    void bind_typed_id(py::module& m, const std::string& name) {
+        py::class_<IDType>(m, name.c_str())
+            .def(py::init<>(), "Default (invalid) ID")
+            .def("id", &IDType::id, "Get the underlying integer value")
+            .def("name", &IDType::name, "Get a printable name")
+            .def("__eq__", [](const IDType& lhs, const IDType& rhs) { return lhs == rhs; })
+            .def("__hash__", [](const IDType& id) { return std::hash<IDType>{}(id); })
+            .def("__repr__", &IDType::name);
+    };
+
+    static inline void bind_scene_ids(py::module& m)
+    {
+        bind_typed_id<MeshID>(m, "MeshID");
+        bind_typed_id<UnresolvedID>(m, "UnresolvedID");
+        bind_typed_id<LightID>(m, "LightID");
+        bind_typed_id<GroupID>(m, "GroupID");
+        bind_typed_id<InstanceID>(m, "InstanceID");
+        bind_typed_id<MaterialID>(m, "MaterialID");
+        bind_typed_id<CameraID>(m, "CameraID");
+    };
+
+    static inline void bind_scene_options(py::module& m)
+    {
+        py::class_<rendering::CPUPathTracerOptions>(m, "CPUPathTracerOptions")
+            .def(py::init<>(), "Default constructor")
+            .def_readwrite("samples", &rendering::CPUPathTracerOptions::samples)
+            .def_readwrite("bounces", &rendering::CPUPathTracerOptions::bounces)
+            .def_readwrite("show_background", &rendering::CPUPathTracerOptions::show_background)
+            .def_readwrite("denoise", &rendering::CPUPathTracerOptions::denoise)
+            .def_readwrite("adaptive_sampling", &rendering::CPUPathTracerOptions::adaptive_sampling)
+            .def_readwrite("samples_per_batch", &rendering::CPUPathTracerOptions::samples_per_batch)
+            .def_readwrite("sampling_tolerance", &rendering::CPUPathTracerOptions::sampling_tolerance)
+            .def_readwrite("samples_to_detect_miss", &rendering::CPUPathTracerOptions::samples_to_detect_miss)
+            .def_readwrite("raster_primary", &rendering::CPUPathTracerOptions::raster_primary)
+            .def_readwrite("validate_raster_primary", &rendering::CPUPathTracerOptions::validate_raster_primary)
+            .def_readwrite("shadow_cache", &rendering::CPUPathTracerOptions::shadow_cache)
+            .def_readwrite("shadow_cache_tolerance", &rendering::CPUPathTracerOptions::shadow_cache_tolerance)
+            .def_readwrite("collect_statistics", &rendering::CPUPathTracerOptions::collect_statistics);
+
+        py::class_<scene::LevelOfDetailOptions>(m, "LevelOfDetailOptions")
+            .def(py::init<>(), "Default constructor")
+            .def_readwrite("target_triangle_size", &scene::LevelOfDetailOptions::target_triangle_size)
+            .def_readwrite("cone_angle", &scene::LevelOfDetailOptions::cone_angle)
+            .def_readwrite("max_view_angle", &scene::LevelOfDetailOptions::max_view_angle)
+            .def_readwrite("check_shadows", &scene::LevelOfDetailOptions::check_shadows)
+            .def_readwrite("parallel_update", &scene::LevelOfDetailOptions::parallel_update);
+
+        py::class_<utils::ConcurrencyOptions>(m, "ConcurrencyOptions")
+            .def(py::init<>(), "Default constructor")
+            .def_readwrite("max_threads", &utils::ConcurrencyOptions::max_threads)
+            .def_readwrite("numa_node", &utils::ConcurrencyOptions::numa_node)
+            .def_readwrite("pin_threads", &utils::ConcurrencyOptions::pin_threads)
+            .def_readwrite("first_core", &utils::ConcurrencyOptions::first_core);
+
+        py::class_<quipu::SceneSnapshotOptions>(m, "SceneSnapshotOptions")
+            .def(py::init<>(), "Default constructor")
+            .def_readwrite("store_blas", &quipu::SceneSnapshotOptions::store_blas)
+            .def_readwrite("store_camera_tables", &quipu::SceneSnapshotOptions::store_camera_tables);
+    };
+
+    static inline void bind_render_control(py::module& m)
+    {
+        py::class_<rendering::RenderProgress>(m, "RenderProgress")
+            .def(py::init<>(), "Default constructor")
+            .def_readonly("pixels_done", &rendering::RenderProgress::pixels_done)
+            .def_readonly("total_pixels", &rendering::RenderProgress::total_pixels)
+            .def_readonly("samples_done", &rendering::RenderProgress::samples_done)
+            .def("fraction", &rendering::RenderProgress::fraction, "Fraction of the image completed");
+
+        py::class_<rendering::RenderControl, std::shared_ptr<rendering::RenderControl>>(m, "RenderControl")
+            .def(py::init<>(), "Default constructor")
+            .def("cancel", &rendering::RenderControl::cancel, "Stop the render as soon as possible (thread-safe)")
+            .def("isCancelled", &rendering::RenderControl::isCancelled, "Check if the render has been cancelled")
+            .def("reset", &rendering::RenderControl::reset, "Clear a cancellation and the recorded progress")
+            .def("getProgress", &rendering::RenderControl::getProgress, "Get the progress of the current render")
+            .def("setProgressCallback", [](rendering::RenderControl& control, py::function callback, float interval) {
+                // The callback is invoked from worker threads, which do not hold the GIL:
+                control.setProgressCallback([callback = std::move(callback)](const rendering::RenderProgress& progress) {
+                    py::gil_scoped_acquire gil;
+                    callback(progress);
+                    }, interval);
+                }, "Call a function (from a worker thread) as the render progresses", py::arg("callback"), py::arg("interval") = 0.01f);
+
+        py::class_<rendering::RayCounters>(m, "RayCounters")
+            .def(py::init<>(), "Default constructor")
+            .def_readonly("primary_rays", &rendering::RayCounters::primary_rays)
+            .def_readonly("visibility_hits", &rendering::RayCounters::visibility_hits)
+            .def_readonly("shadow_rays", &rendering::RayCounters::shadow_rays)
+            .def_readonly("indirect_rays", &rendering::RayCounters::indirect_rays)
+            .def_readonly("tlas_nodes", &rendering::RayCounters::tlas_nodes)
+            .def_readonly("blas_nodes", &rendering::RayCounters::blas_nodes)
+            .def_readonly("triangle_tests", &rendering::RayCounters::triangle_tests)
+            .def_readonly("embree_queries", &rendering::RayCounters::embree_queries)
+            .def("tracedRays", &rendering::RayCounters::tracedRays, "Total number of primary, shadow, and indirect rays");
+
+        py::class_<rendering::RayStatistics>(m, "RayStatistics")
+            .def(py::init<>(), "Default constructor")
+            .def_readonly("totals", &rendering::RayStatistics::totals)
+            .def_readonly("trace_seconds", &rendering::RayStatistics::trace_seconds)
+            .def_readonly("pixels", &rendering::RayStatistics::pixels)
+            .def_readonly("spp_histogram", &rendering::RayStatistics::spp_histogram)
+            .def("raysPerSecond", &rendering::RayStatistics::raysPerSecond)
+            .def("primaryRaysPerSecond", &rendering::RayStatistics::primaryRaysPerSecond)
+            .def("shadowRaysPerSecond", &rendering::RayStatistics::shadowRaysPerSecond)
+            .def("indirectRaysPerSecond", &rendering::RayStatistics::indirectRaysPerSecond)
+            .def("nodesPerRay", &rendering::RayStatistics::nodesPerRay)
+            .def("trianglesPerRay", &rendering::RayStatistics::trianglesPerRay)
+            .def("meanSamplesPerPixel", &rendering::RayStatistics::meanSamplesPerPixel)
+            .def("format", &rendering::RayStatistics::format, "Format the statistics as a report")
+            .def("__repr__", &rendering::RayStatistics::format);
+    };
+
+    static inline void bind_memory_usage(py::module& m)
+    {
+        py::class_<utils::MemoryUsage>(m, "MemoryUsage")
+            .def(py::init<>(), "Default constructor")
+            .def_readonly("vertices", &utils::MemoryUsage::vertices)
+            .def_readonly("indices", &utils::MemoryUsage::indices)
+            .def_readonly("triangles", &utils::MemoryUsage::triangles)
+            .def_readonly("blas", &utils::MemoryUsage::blas)
+            .def_readonly("tlas", &utils::MemoryUsage::tlas)
+            .def_readonly("textures", &utils::MemoryUsage::textures)
+            .def_readonly("render_passes", &utils::MemoryUsage::render_passes)
+            .def("geometry", &utils::MemoryUsage::geometry, "Bytes held by vertices, indices, and triangles")
+            .def("acceleration", &utils::MemoryUsage::acceleration, "Bytes held by the BLASs and the TLAS")
+            .def("total", &utils::MemoryUsage::total, "Bytes held by all categories");
+
+        py::class_<utils::MeshMemoryUsage>(m, "MeshMemoryUsage")
+            .def_readonly("id", &utils::MeshMemoryUsage::id)
+            .def_readonly("name", &utils::MeshMemoryUsage::name)
+            .def_readonly("instances", &utils::MeshMemoryUsage::instances)
+            .def_readonly("usage", &utils::MeshMemoryUsage::usage);
+
+        py::class_<utils::InstanceMemoryUsage>(m, "InstanceMemoryUsage")
+            .def_readonly("id", &utils::InstanceMemoryUsage::id)
+            .def_readonly("mesh", &utils::InstanceMemoryUsage::mesh)
+            .def_readonly("bytes", &utils::InstanceMemoryUsage::bytes)
+            .def_readonly("amortized_bytes", &utils::InstanceMemoryUsage::amortized_bytes);
+
+        py::class_<utils::MemoryReport>(m, "MemoryReport")
+            .def_readonly("totals", &utils::MemoryReport::totals)
+            .def_readonly("embree_device_bytes", &utils::MemoryReport::embree_device_bytes)
+            .def_readonly("meshes", &utils::MemoryReport::meshes)
+            .def_readonly("instances", &utils::MemoryReport::instances)
+            .def("format", &utils::MemoryReport::format, "Format the report as tables", py::arg("max_rows") = 10)
+            .def("__repr__", [](const utils::MemoryReport& report) { return report.format(); });
+    };
+
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void bind_camera(py::module& m, const std::string& suffix) {
+        using CameraT = cameras::Camera<TSpectral, TFloat, TMeshFloat>;
+
+        py::class_<CameraT, ReferenceFrame<TFloat>>(m, ("Camera_" + suffix).c_str())
+            .def("initialize", &CameraT::initialize, "Precompute per-pixel quantities (called automatically before rendering)", release_gil())
+            .def("getID", &CameraT::getID, "Get the camera's CameraID")
+
+            // Processing settings
+            .def("enableParallelInitialization", &CameraT::enableParallelInitialization, py::arg("parallel_initialization") = true)
+            .def("enableDistortionInterpolation", &CameraT::enableDistortionInterpolation, py::arg("interpolation") = true)
+            .def("enableDepthOfField", &CameraT::enableDepthOfField, py::arg("depth_of_field") = true)
+            .def("enableBlenderFrame", &CameraT::enableBlenderFrame, py::arg("blender_frame") = true)
+
+            // Intrinsics
+            .def("setFocalLength", &CameraT::setFocalLength, "Set the focal length (meters)", py::arg("focal_length"))
+            .def("getFocalLength", &CameraT::getFocalLength, "Get the focal length (meters)")
+            .def("setPrincipalPoint", &CameraT::setPrincipalPoint, py::arg("px"), py::arg("py"))
+            .def("setSkewParameters", &CameraT::setSkewParameters, py::arg("kxy"), py::arg("kyx"))
+            .def("setResolution", py::overload_cast<vira::images::Resolution>(&CameraT::setResolution), py::arg("resolution"))
+            .def("setResolution", py::overload_cast<size_t, size_t>(&CameraT::setResolution), py::arg("x"), py::arg("y"))
+            .def("getResolution", &CameraT::getResolution, "Get the image resolution")
+            .def("setSensorSize", py::overload_cast<double, double>(&CameraT::setSensorSize), "Set the sensor size (meters)", py::arg("x"), py::arg("y"))
+            .def("setSensorSize", py::overload_cast<double>(&CameraT::setSensorSize), "Set the sensor width (meters)", py::arg("x"))
+            .def("setOpticalEfficiency", py::overload_cast<double>(&CameraT::setOpticalEfficiency), py::arg("optical_efficiency"))
+
+            // Exposure settings
+            .def("setExposureTime", &CameraT::setExposureTime, "Set the exposure time (seconds)", py::arg("exposure_time"))
+            .def("getExposureTime", &CameraT::getExposureTime, "Get the exposure time (seconds)")
+            .def("setFocusDistance", &CameraT::setFocusDistance, py::arg("focus_distance"))
+            .def("setFStop", &CameraT::setFStop, py::arg("f_stop"))
+            .def("setApertureDiameter", &CameraT::setApertureDiameter, py::arg("aperture_diameter"))
+            .def("setGain", &CameraT::setGain, py::arg("gain"))
+            .def("setGainDB", &CameraT::setGainDB, py::arg("gain_db"), py::arg("new_unity_gain_db") = 0)
+
+            // Default sensor models
+            .def("setDefaultPhotositeBitDepth", &CameraT::setDefaultPhotositeBitDepth, py::arg("bit_depth"))
+            .def("setDefaultPhotositeWellDepth", &CameraT::setDefaultPhotositeWellDepth, py::arg("well_depth"))
+            .def("setDefaultPhotositeQuantumEfficiency", py::overload_cast<double>(&CameraT::setDefaultPhotositeQuantumEfficiency), py::arg("quantum_efficiency"))
+            .def("setDefaultPhotositeLinearScaleFactor", &CameraT::setDefaultPhotositeLinearScaleFactor, py::arg("linear_scale_factor"))
+            .def("setDefaultAiryDiskPSF", &CameraT::setDefaultAiryDiskPSF)
+            .def("setDefaultGaussianPSF", &CameraT::setDefaultGaussianPSF)
+            .def("setDefaultLowNoise", &CameraT::setDefaultLowNoise)
+            .def("setSeed", &CameraT::setSeed, "Set the seed from which sensor noise streams are derived", py::arg("seed"))
+            .def("getSeed", &CameraT::getSeed)
+            .def("setDefaultBayerFilter", py::overload_cast<>(&CameraT::setDefaultBayerFilter))
+
+            // Geometry
+            .def("lookAt", &CameraT::lookAt, py::arg("target"), py::arg("up") = vec3<TFloat>{ 0,0,1 })
+            .def("lookInDirection", &CameraT::lookInDirection, py::arg("direction"), py::arg("up") = vec3<TFloat>{ 0,0,1 })
+            .def("getFOV", &CameraT::getFOV, "Get the field of view")
+            .def("calculateGSD", &CameraT::calculateGSD, "Ground sample distance at a given distance", py::arg("distance"))
+
+            // Sensor simulation
+            .def("simulateSensor", &CameraT::simulateSensor, py::arg("total_power_image"), py::arg("stream") = 0, release_gil())
+            .def("simulateSensorRGB", &CameraT::simulateSensorRGB, py::arg("total_power_image"), py::arg("stream") = 0, release_gil());
+    };
+
+    template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
+    void bind_scene(py::module& m, const std::string& suffix) {
+        using GroupT = scene::Group<TSpectral, TFloat, TMeshFloat>;
+        using InstanceT = scene::Instance<TSpectral, TFloat, TMeshFloat>;
+        using LightT = lights::Light<TSpectral, TFloat, TMeshFloat>;
+        using SceneT = Scene<TSpectral, TFloat, TMeshFloat>;
+        using PathTracerT = rendering::CPUPathTracer<TSpectral, TFloat, TMeshFloat>;
+        using ContextT = rendering::RenderContext<TSpectral, TFloat, TMeshFloat>;
+
+        constexpr auto ref = py::return_value_policy::reference_internal;
+
+        bind_camera<TSpectral, TFloat, TMeshFloat>(m, suffix);
+
+        py::class_<InstanceT, ReferenceFrame<TFloat>>(m, ("Instance_" + suffix).c_str())
+            .def("getID", &InstanceT::getID)
+            .def("getMeshID", &InstanceT::getMeshID);
+
+        py::class_<LightT, ReferenceFrame<TFloat>>(m, ("Light_" + suffix).c_str())
+            .def("getID", &LightT::getID);
+
+        // Objects owned by a Group are returned by reference and keep the owning Scene alive:
+        py::class_<GroupT, ReferenceFrame<TFloat>>(m, ("Group_" + suffix).c_str())
+            .def("getID", &GroupT::getID)
+            .def("graphToString", &GroupT::graphToString, py::arg("prefix") = "")
+
+            // Access
+            .def("camera", [](GroupT& g, const CameraID& id) -> auto& { return g[id]; }, ref, py::arg("id"))
+            .def("group", [](GroupT& g, const GroupID& id) -> auto& { return g[id]; }, ref, py::arg("id"))
+            .def("instance", [](GroupT& g, const InstanceID& id) -> auto& { return g[id]; }, ref, py::arg("id"))
+            .def("light", [](GroupT& g, const LightID& id) -> auto& { return g[id]; }, ref, py::arg("id"))
+            .def("searchCameraName", &GroupT::searchCameraName, py::arg("name"))
+            .def("searchGroupName", &GroupT::searchGroupName, py::arg("name"))
+            .def("searchInstanceName", &GroupT::searchInstanceName, py::arg("name"))
+            .def("searchLightName", &GroupT::searchLightName, py::arg("name"))
+
+            // Graph creators
+            .def("newCamera", &GroupT::newCamera, py::arg("name") = "")
+            .def("newGroup", [](GroupT& g, std::string name) { return g.newGroup(name); }, py::arg("name") = "")
+            .def("newGroup", py::overload_cast<std::vector<MeshID>, std::string>(&GroupT::newGroup), py::arg("meshIDs"), py::arg("name") = "")
+            .def("newInstance", &GroupT::newInstance, py::arg("meshID"), py::arg("name") = "")
+            .def("addQuipuAsInstance", &GroupT::addQuipuAsInstance, "Load a Quipu file and instance it in this group",
+                py::arg("filepath"), py::arg("materialID"), py::arg("smoothShading"), py::arg("name") = "", release_gil())
+            .def("addQuipusAsInstances", &GroupT::addQuipusAsInstances, "Load all Quipu files matching a glob and instance them in this group",
+                py::arg("glob"), py::arg("materialID"), py::arg("smoothShading"), release_gil())
+            .def("loadGeometryAsGroup", &GroupT::loadGeometryAsGroup, "Load a geometry file as a new child group",
+                py::arg("filepath"), py::arg("format") = "AUTO", py::arg("keep_layout") = true, py::arg("name") = "", release_gil())
+            .def("newPointLight", [](GroupT& g, float spectralPower, std::string name) { return g.newPointLight(spectralPower, name); },
+                py::arg("spectralPower"), py::arg("name") = "")
+            .def("newSphereLight", [](GroupT& g, float spectralInput, TFloat radius, bool isPower, std::string name) { return g.newSphereLight(spectralInput, radius, isPower, name); },
+                py::arg("spectralInput"), py::arg("radius"), py::arg("isPower"), py::arg("name") = "")
+            .def("newSun", &GroupT::newSun)
+            .def("setSunDirectionEulerAngles", [](GroupT& g, LightID id, double r1, double r2, double r3, double distance) {
+                g.setSunDirectionEulerAngles(id, units::Degree(r1), units::Degree(r2), units::Degree(r3), distance);
+                }, "Place the sun using Euler angles (degrees)",
+                py::arg("id"), py::arg("r1"), py::arg("r2"), py::arg("r3"), py::arg("distance") = AUtoM<double>())
+            .def("newUnresolvedObject", [](GroupT& g, float irradiance, std::string name) { return g.newUnresolvedObject(irradiance, name); },
+                py::arg("irradiance") = 0.f, py::arg("name") = "")
+
+            // Graph deleters
+            .def("removeCamera", &GroupT::removeCamera, py::arg("cameraID"))
+            .def("removeGroup", &GroupT::removeGroup, py::arg("groupID"))
+            .def("removeInstance", &GroupT::removeInstance, py::arg("instanceID"))
+            .def("removeLight", &GroupT::removeLight, py::arg("lightID"))
+            .def("removeUnresolvedObject", &GroupT::removeUnresolvedObject, py::arg("unresolvedID"))
+            .def("removeInstancesOfMesh", &GroupT::removeInstancesOfMesh, py::arg("meshID"));
+
+        py::class_<PathTracerT>(m, ("CPUPathTracer_" + suffix).c_str())
+            .def_readwrite("options", &PathTracerT::options)
+            .def_property_readonly("renderPasses", [](PathTracerT& p) -> auto& { return p.renderPasses; }, ref)
+            .def_readwrite("control", &PathTracerT::control)
+            .def_readonly("statistics", &PathTracerT::statistics)
+            .def_readonly("partial", &PathTracerT::partial, "Whether the most recent render was cancelled before every pixel was traced")
+            .def("snapshotPasses", &PathTracerT::snapshotPasses, "Copy the passes of a render in progress (requires a control)", release_gil())
+            .def("render", [](PathTracerT& p, cameras::Camera<TSpectral, TFloat, TMeshFloat>& camera, SceneT& scene) {
+                scene.getConcurrency().execute([&] { p.render(camera, scene); });
+                }, "Render a camera into renderPasses", py::arg("camera"), py::arg("scene"), release_gil());
+
+        py::class_<ContextT>(m, ("RenderContext_" + suffix).c_str())
+            .def(py::init<>(), "Default constructor")
+            .def_property_readonly("pathtracer", [](ContextT& c) -> auto& { return c.pathtracer; }, ref)
+            .def_readwrite("sensor_stream", &ContextT::sensor_stream);
+
+        py::class_<SceneT, GroupT>(m, ("Scene_" + suffix).c_str())
+            .def(py::init<>(), "Default constructor")
+
+            // Access (searches the entire scene graph)
+            .def("camera", [](SceneT& s, const CameraID& id) -> auto& { return s[id]; }, ref, py::arg("id"))
+            .def("group", [](SceneT& s, const GroupID& id) -> auto& { return s[id]; }, ref, py::arg("id"))
+            .def("instance", [](SceneT& s, const InstanceID& id) -> auto& { return s[id]; }, ref, py::arg("id"))
+            .def("light", [](SceneT& s, const LightID& id) -> auto& { return s[id]; }, ref, py::arg("id"))
+
+            // Persistence
+            .def("saveSnapshot", &SceneT::saveSnapshot, py::arg("filepath"), py::arg("options") = quipu::SceneSnapshotOptions{}, release_gil())
+            .def("loadSnapshot", &SceneT::loadSnapshot, py::arg("filepath"), release_gil())
+            .def("saveGroupAsGeometry", &SceneT::saveGroupAsGeometry, py::arg("group_id"), py::arg("filepath"), py::arg("format") = "AUTO", release_gil())
+
+            // SPICE interface
+            .def("setSpiceDatetime", &SceneT::setSpiceDatetime, py::arg("datetimeString"))
+            .def("setSpiceET", &SceneT::setSpiceET, py::arg("et"))
+            .def("incrementSpiceET", &SceneT::incrementSpiceET, py::arg("seconds_elapsed"))
+            .def("getSpiceET", &SceneT::getSpiceET)
+
+            // Global lighting
+            .def("setAmbient", py::overload_cast<float>(&SceneT::setAmbient), py::arg("ambient_lighting"))
+            .def("setAmbientRGB", py::overload_cast<float, float, float>(&SceneT::setAmbientRGB), py::arg("red"), py::arg("green"), py::arg("blue"))
+            .def("setBackgroundEmissionRGB", py::overload_cast<float, float, float>(&SceneT::setBackgroundEmissionRGB), py::arg("red"), py::arg("green"), py::arg("blue"))
+            .def("loadTychoQuipu", py::overload_cast<const fs::path&, double>(&SceneT::loadTychoQuipu), py::arg("quipuPath"), py::arg("et"), release_gil())
+
+            // Materials and meshes
+            .def("newLambertianMaterial", &SceneT::newLambertianMaterial, py::arg("name") = "")
+            .def("newMcEwenMaterial", &SceneT::newMcEwenMaterial, py::arg("name") = "")
+            .def("removeMaterial", &SceneT::removeMaterial, py::arg("materialID"))
+            .def("addQuipuMesh", py::overload_cast<const fs::path&, const MaterialID&, std::string>(&SceneT::addQuipuMesh),
+                py::arg("quipuPath"), py::arg("materialID"), py::arg("name") = "", release_gil())
+            .def("removeMesh", &SceneT::removeMesh, py::arg("meshID"))
+            .def("loadGeometry", [](SceneT& scene, const fs::path& filepath, std::string format) {
+                return scene.loadGeometry(filepath, format).mesh_ids;
+                }, "Load all meshes from a geometry file, returning their MeshIDs", py::arg("filepath"), py::arg("format") = "AUTO", release_gil())
+
+            // Graph modifiers
+            .def("moveCamera", &SceneT::moveCamera, py::arg("id"), py::arg("from_group"), py::arg("to_group"))
+            .def("moveInstance", &SceneT::moveInstance, py::arg("id"), py::arg("from_group"), py::arg("to_group"))
+            .def("moveLight", &SceneT::moveLight, py::arg("id"), py::arg("from_group"), py::arg("to_group"))
+            .def("moveGroup", &SceneT::moveGroup, py::arg("id"), py::arg("from_group"), py::arg("to_group"))
+
+            // Concurrency
+            .def("setConcurrency", &SceneT::setConcurrency, "Limit the threads used for loading and rendering", py::arg("options"))
+            .def("getMemoryReport", &SceneT::getMemoryReport, "Report the memory held by the scene, by category, mesh, and instance")
+
+            // Level of detail
+            .def_property("lodOptions",
+                [](SceneT& scene) { return scene.lodManager.options; },
+                [](SceneT& scene, const scene::LevelOfDetailOptions& options) { scene.lodManager.options = options; })
+            .def("updateLevelOfDetail", &SceneT::updateLevelOfDetail, py::arg("cameraID"), release_gil())
+
+            // Rendering
+            .def_property_readonly("pathtracer", [](SceneT& scene) -> auto& { return scene.pathtracer; }, ref)
+            .def("processSceneGraph", &SceneT::processSceneGraph, release_gil())
+            .def("buildTLAS", &SceneT::buildTLAS, release_gil())
+            .def("render", py::overload_cast<const CameraID&>(&SceneT::render), py::arg("cameraID"), release_gil())
+            .def("renderRGB", py::overload_cast<const CameraID&>(&SceneT::renderRGB), py::arg("cameraID"), release_gil())
+            .def("renderTotalPower", py::overload_cast<const CameraID&>(&SceneT::renderTotalPower), py::arg("cameraID"), release_gil())
+
+            // Thread-safe rendering (one context per thread)
+            .def("prepareRender", &SceneT::prepareRender, py::arg("cameraIDs") = std::vector<CameraID>{}, release_gil(),
+                "Update the scene graph caches and acceleration structures, and initialize cameras, before rendering through contexts")
+            .def("isPrepared", &SceneT::isPrepared)
+            .def("newRenderContext", &SceneT::newRenderContext, "Create a render context using the Scene's renderer options")
+            .def("render", py::overload_cast<const CameraID&, ContextT&>(&SceneT::render, py::const_), py::arg("cameraID"), py::arg("context"), release_gil())
+            .def("renderRGB", py::overload_cast<const CameraID&, ContextT&>(&SceneT::renderRGB, py::const_), py::arg("cameraID"), py::arg("context"), release_gil())
+            .def("renderTotalPower", py::overload_cast<const CameraID&, ContextT&>(&SceneT::renderTotalPower, py::const_), py::arg("cameraID"), py::arg("context"), release_gil())
+            .def("pathtraceRender", &SceneT::pathtraceRender, py::arg("cameraID"), release_gil())
+            .def("pathtraceRenderRGB", &SceneT::pathtraceRenderRGB, py::arg("cameraID"), release_gil())
+            .def("rasterizeRender", &SceneT::rasterizeRender, py::arg("cameraID"), release_gil())
+            .def("rasterizeRenderRGB", &SceneT::rasterizeRenderRGB, py::arg("cameraID"), release_gil())
+            .def("unresolvedRender", &SceneT::unresolvedRender, py::arg("cameraID"), release_gil())
+            .def("unresolvedRenderRGB", &SceneT::unresolvedRenderRGB, py::arg("cameraID"), release_gil());
+    };
+};
+
+#endif
@@ -7,9 +7,12 @@
 #include "vira/constraints.hpp"
 #include "vira/spectral_data.hpp"
 
+#include "bindings/image_py.ipp"
 #include "bindings/math_py.ipp"
+#include "bindings/profiler_py.ipp"
 #include "bindings/reference_frame_py.ipp"
 #include "bindings/rotation_py.ipp"
+#include "bindings/scene_py.ipp"
 #include "bindings/spice_utils_py.ipp"
 #include "bindings/vec_py.ipp"
 
@@ -45,14 +48,28 @@ namespace pybind11 {
 namespace vira {
     static inline void bind_non_templates(py::module& m)
     {
-        (void)m;
+        py::class_<vira::images::Resolution>(m, "Resolution")
+            .def(py::init<>(), "Default constructor")
+            .def(py::init<int, int>(), "Constructor with x (width), y (height)", py::arg("x"), py::arg("y"))
+            .def_readwrite("x", &vira::images::Resolution::x, "Width in pixels")
+            .def_readwrite("y", &vira::images::Resolution::y, "Height in pixels");
+
+        bind_image<float>(m, "F");
+        bind_image<size_t>(m, "ID");
+        bind_image<vira::ColorRGB>(m, "RGB");
+        bind_image<vec3<float>>(m, "vec3F");
+
+        bind_scene_ids(m);
+        bind_scene_options(m);
+        bind_render_control(m);
+        bind_memory_usage(m);
+        bind_profiler(m);
     };
 
     template <IsSpectral TSpectral>
     void bind_spectral_templates(py::module& m, const std::string& suffix)
     {
-        (void)m;
-        (void)suffix;
+        bind_image<TSpectral>(m, suffix);
     };
 
     template <IsFloat TFloat>
@@ -68,15 +85,13 @@ namespace vira {
     template <IsSpectral TSpectral, IsFloat TFloat>
     void bind_spectral_precision_templates(py::module& m, const std::string& suffix)
     {
-        (void)m;
-        (void)suffix;
+        bind_render_passes<TSpectral, TFloat>(m, suffix);
     };
 
     template <IsSpectral TSpectral, IsFloat TFloat, IsFloat TMeshFloat> requires LesserFloat<TFloat, TMeshFloat>
     void bind_full_templates(py::module& m, const std::string& suffix)
     {
-        (void)m;
-        (void)suffix;
+        bind_scene<TSpectral, TFloat, TMeshFloat>(m, suffix);
     };
 
     template <IsSpectral TSpectral>
@@ -87,8 +102,8 @@ namespace vira {
         bind_spectral_precision_templates<vira::Visible_8bin, float>(m, suffix + "F");
         bind_spectral_precision_templates<vira::Visible_8bin, double>(m, suffix + "D");
 
+        // Scenes are only bound in single precision (matching the C++ tests and tools):
         bind_full_templates<vira::Visible_8bin, float, float>(m, suffix + "FF");
-        bind_full_templates<vira::Visible_8bin, double, float>(m, suffix + "DF");
     };
 };
 
@@ -0,0 +1,286 @@
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "vira/vira.hpp"
+
+namespace fs = std::filesystem;
+
+using TestMesh = vira::geometry::Mesh<vira::ColorRGB, float, float>;
+using TestQuipu = vira::quipu::MeshQuipu<vira::ColorRGB, float>;
+using TestEntry = vira::quipu::MeshQuipuEntry<vira::ColorRGB, float>;
+
+// Builds a gently curved n x n grid of vertices (2 (n-1)^2 triangles) with distinct attributes:
+static TestEntry makeGrid(size_t n, const std::string& name)
+{
+    TestEntry entry;
+    entry.name = name;
+    for (size_t j = 0; j < n; ++j) {
+        for (size_t i = 0; i < n; ++i) {
+            float x = static_cast<float>(i);
+            float y = static_cast<float>(j);
+
+            vira::geometry::Vertex<vira::ColorRGB, float> vertex;
+            vertex.position = vira::vec3<float>{ x, y, 0.1f * std::sin(0.3f * x) * std::cos(0.2f * y) };
+            vertex.albedo = vira::ColorRGB{ x / static_cast<float>(n), y / static_cast<float>(n), 0.5f };
+            vertex.normal = vira::Normal{ 0, 0, 1 };
+            vertex.uv = vira::UV{ x / static_cast<float>(n - 1), y / static_cast<float>(n - 1) };
+            entry.vertexBuffer.push_back(vertex);
+        }
+    }
+
+    for (size_t j = 0; j + 1 < n; ++j) {
+        for (size_t i = 0; i + 1 < n; ++i) {
+            uint32_t a = static_cast<uint32_t>(j * n + i);
+            uint32_t b = a + 1;
+            uint32_t c = a + static_cast<uint32_t>(n);
+            uint32_t d = c + 1;
+            entry.indexBuffer.insert(entry.indexBuffer.end(), { a, b, d, a, d, c });
+        }
+    }
+    entry.materialIndices = std::vector<vira::MaterialID::ValueType>(entry.indexBuffer.size() / 3, 0);
+    entry.gsd = 1.f;
+    return entry;
+}
+
+static fs::path tempPath(const std::string& name)
+{
+    fs::path directory = fs::temp_directory_path() / "vira_mesh_quipu_tests";
+    fs::create_directories(directory);
+    return directory / name;
+}
+
+static void expectEqualEntries(const TestEntry& a, const TestEntry& b, float positionTolerance)
+{
+    EXPECT_EQ(a.name, b.name);
+    EXPECT_EQ(a.gsd, b.gsd);
+    EXPECT_EQ(a.smoothShading, b.smoothShading);
+    EXPECT_EQ(a.indexBuffer, b.indexBuffer);
+    EXPECT_EQ(a.materialIndices, b.materialIndices);
+
+    ASSERT_EQ(a.vertexBuffer.size(), b.vertexBuffer.size());
+    for (size_t i = 0; i < a.vertexBuffer.size(); ++i) {
+        for (int k = 0; k < 3; ++k) {
+            ASSERT_NEAR(a.vertexBuffer[i].position[k], b.vertexBuffer[i].position[k], positionTolerance) << "Position differs at vertex " << i;
+            ASSERT_EQ(a.vertexBuffer[i].albedo[static_cast<size_t>(k)], b.vertexBuffer[i].albedo[static_cast<size_t>(k)]) << "Albedo differs at vertex " << i;
+            ASSERT_EQ(a.vertexBuffer[i].normal[k], b.vertexBuffer[i].normal[k]) << "Normal differs at vertex " << i;
+        }
+        ASSERT_EQ(a.vertexBuffer[i].uv[0], b.vertexBuffer[i].uv[0]) << "UV differs at vertex " << i;
+        ASSERT_EQ(a.vertexBuffer[i].uv[1], b.vertexBuffer[i].uv[1]) << "UV differs at vertex " << i;
+    }
+}
+
+// Plain buffers, materials, and the node hierarchy are read back exactly:
+TEST(MeshQuipu, RoundTrip) {
+    vira::quipu::MeshQuipuData<vira::ColorRGB, float> data;
+    data.meshes.push_back(makeGrid(16, "small"));
+    data.meshes.push_back(makeGrid(300, "large")); // More than 65536 vertices, so indices stay 32-bit
+    data.meshes[1].gsd = 2.f;
+    data.meshes[1].smoothShading = true;
+
+    vira::quipu::MaterialReference material;
+    material.name = "rock";
+    material.roughness = 0.8f;
+    material.diffuseTexture = "rock.png";
+    data.materials.push_back(material);
+    data.meshes[0].materialReferences = { 0 };
+
+    vira::quipu::MeshQuipuNode root;
+    root.name = "root";
+    root.meshIndices = { 0, 1 };
+    data.nodes.push_back(root);
+
+    fs::path filepath = tempPath("round_trip.qms");
+    TestQuipu::write(filepath, data, 42);
+
+    TestQuipu quipu(filepath);
+    ASSERT_TRUE(quipu.isCompatible());
+    EXPECT_EQ(quipu.getSourceKey(), 42u);
+    EXPECT_EQ(quipu.getFileSize(), static_cast<uint64_t>(fs::file_size(filepath)));
+    ASSERT_EQ(quipu.getGSDs().size(), 2u);
+    EXPECT_EQ(quipu.getGSDs()[0], 1.f);
+    EXPECT_EQ(quipu.getGSDs()[1], 2.f);
+
+    auto read = quipu.read();
+    ASSERT_EQ(read.meshes.size(), 2u);
+    expectEqualEntries(read.meshes[0], data.meshes[0], 0.f);
+    expectEqualEntries(read.meshes[1], data.meshes[1], 0.f);
+
+    ASSERT_EQ(read.materials.size(), 1u);
+    EXPECT_EQ(read.materials[0].name, "rock");
+    EXPECT_EQ(read.materials[0].roughness, 0.8f);
+    EXPECT_EQ(read.materials[0].diffuseTexture, "rock.png");
+    EXPECT_EQ(read.meshes[0].materialReferences, std::vector<uint32_t>{ 0 });
+
+    ASSERT_EQ(read.nodes.size(), 1u);
+    EXPECT_EQ(read.nodes[0].name, "root");
+    EXPECT_EQ(read.nodes[0].meshIndices, (std::vector<uint64_t>{ 0, 1 }));
+
+    // A single mesh may be read through the table of contents:
+    expectEqualEntries(quipu.readMesh(1), data.meshes[1], 0.f);
+    EXPECT_THROW(quipu.readMesh(2), std::out_of_range);
+}
+
+// 16-bit indices, quantized positions, and compression decode back to the original layout:
+TEST(MeshQuipu, CompactEncodings) {
+    vira::quipu::MeshQuipuData<vira::ColorRGB, float> data;
+    data.meshes.push_back(makeGrid(64, "grid"));
+
+    vira::quipu::MeshQuipuWriterOptions options;
+    options.compress = true;
+    options.quantize_positions = true;
+
+    fs::path plainPath = tempPath("plain.qms");
+    fs::path compactPath = tempPath("compact.qms");
+    TestQuipu::write(plainPath, data, 7);
+    TestQuipu::write(compactPath, data, 7, options);
+    EXPECT_LT(fs::file_size(compactPath), fs::file_size(plainPath));
+
+    // Positions are quantized to 1/65535 of the mesh extent along each axis:
+    auto read = TestQuipu(compactPath).read();
+    ASSERT_EQ(read.meshes.size(), 1u);
+    expectEqualEntries(read.meshes[0], data.meshes[0], 63.f / 65535.f);
+}
+
+// Caches are rejected if their key differs, or if the file was truncated:
+TEST(MeshQuipu, CacheValidation) {
+    vira::quipu::MeshQuipuData<vira::ColorRGB, float> data;
+    data.meshes.push_back(makeGrid(32, "grid"));
+
+    fs::path filepath = tempPath("cache.qms");
+    TestQuipu::write(filepath, data, 99);
+    EXPECT_TRUE(TestQuipu::isValidCache(filepath, 99));
+    EXPECT_FALSE(TestQuipu::isValidCache(filepath, 100));
+    EXPECT_FALSE(TestQuipu::isValidCache(tempPath("missing.qms"), 99));
+
+    fs::resize_file(filepath, fs::file_size(filepath) - 16);
+    EXPECT_FALSE(TestQuipu::isValidCache(filepath, 99));
+}
+
+// Caches are rejected once a dependency (such as a material library) changes or is removed:
+TEST(MeshQuipu, CacheDependencies) {
+    fs::path library = tempPath("grid.mtl");
+    {
+        std::ofstream file(library);
+        file << "newmtl rock\nKd 0.5 0.5 0.5\n";
+    }
+
+    vira::quipu::MeshQuipuData<vira::ColorRGB, float> data;
+    data.meshes.push_back(makeGrid(8, "grid"));
+    data.dependencies.push_back(TestQuipu::stampDependency(library));
+
+    fs::path filepath = tempPath("dependencies.qms");
+    TestQuipu::write(filepath, data, 11);
+    EXPECT_TRUE(TestQuipu::isValidCache(filepath, 11));
+    ASSERT_EQ(TestQuipu(filepath).read().dependencies.size(), 1u);
+    EXPECT_EQ(TestQuipu(filepath).read().dependencies[0].path, fs::absolute(library).string());
+
+    {
+        std::ofstream file(library, std::ios::app);
+        file << "Ks 0.1 0.1 0.1\n";
+    }
+    EXPECT_FALSE(TestQuipu::isValidCache(filepath, 11));
+
+    fs::remove(library);
+    EXPECT_FALSE(TestQuipu::isValidCache(filepath, 11));
+}
+
+// The pyramid is ordered from finest to coarsest, and a mesh that is not visible drops to the coarsest level:
+TEST(MeshQuipu, LoDPyramid) {
+    TestEntry grid = makeGrid(64, "grid");
+    TestMesh mesh(grid.vertexBuffer, grid.indexBuffer);
+    const size_t fullTriangles = mesh.getNumTriangles();
+
+    vira::geometry::LoDPyramidOptions options;
+    options.min_triangles = 64;
+
+    fs::path filepath = tempPath("pyramid.qms");
+    mesh.generateLoDs(filepath, 5, options);
+    ASSERT_TRUE(mesh.hasLoDs());
+    ASSERT_TRUE(TestQuipu::isValidCache(filepath, 5));
+
+    TestQuipu quipu(filepath);
+    ASSERT_GT(quipu.getNumberOfMeshes(), 1u);
+    const std::vector<float>& gsds = quipu.getGSDs();
+    for (size_t i = 1; i < gsds.size(); ++i) {
+        EXPECT_GT(gsds[i], gsds[i - 1]);
+        EXPECT_LT(quipu.readMesh(i).indexBuffer.size(), quipu.readMesh(i - 1).indexBuffer.size());
+    }
+    const size_t coarsestTriangles = quipu.readMesh(gsds.size() - 1).indexBuffer.size() / 3;
+
+    mesh.updateGSD(std::numeric_limits<float>::infinity());
+    EXPECT_EQ(mesh.getNumTriangles(), coarsestTriangles);
+
+    mesh.updateGSD(0.f);
+    EXPECT_EQ(mesh.getNumTriangles(), fullTriangles);
+
+    // A pyramid loaded from the cache behaves the same:
+    TestMesh cached(grid.vertexBuffer, grid.indexBuffer);
+    cached.loadLoDs(filepath);
+    cached.updateGSD(std::numeric_limits<float>::infinity());
+    EXPECT_EQ(cached.getNumTriangles(), coarsestTriangles);
+}
+
+// Compact meshes keep 16-bit indices and quantized positions resident, and trace the same surface:
+TEST(MeshQuipu, CompactStorage) {
+    using DoubleMesh = vira::geometry::Mesh<vira::ColorRGB, double, double>;
+
+    TestEntry grid = makeGrid(64, "grid");
+    vira::geometry::VertexBuffer<vira::ColorRGB, double> vertices(grid.vertexBuffer.size());
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        vertices[i].position = vira::vec3<double>{ grid.vertexBuffer[i].position };
+        vertices[i].albedo = grid.vertexBuffer[i].albedo;
+        vertices[i].normal = grid.vertexBuffer[i].normal;
+        vertices[i].uv = grid.vertexBuffer[i].uv;
+    }
+
+    DoubleMesh full(vertices, grid.indexBuffer);
+    DoubleMesh compact(vertices, grid.indexBuffer);
+    compact.setCompactStorage(true);
+    ASSERT_TRUE(compact.isCompact());
+    EXPECT_TRUE(compact.getIndexBuffer().empty());
+    EXPECT_TRUE(compact.getTriangles().empty());
+    EXPECT_EQ(compact.getIndices(), grid.indexBuffer);
+    EXPECT_EQ(compact.getIndexCount(), grid.indexBuffer.size());
+    EXPECT_LT(compact.getMemoryUsage().geometry(), full.getMemoryUsage().geometry() / 2);
+
+    // Positions are replaced by their decoded values:
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        for (int k = 0; k < 3; ++k) {
+            ASSERT_NEAR(compact.getVertexBuffer()[i].position[k], vertices[i].position[k], 63. / 65535.) << "Position differs at vertex " << i;
+        }
+    }
+
+    vira::rendering::ViraBLAS<vira::ColorRGB> fullBLAS(&full, vira::rendering::BVHBuildOptions{});
+    vira::rendering::ViraBLAS<vira::ColorRGB> compactBLAS(&compact, vira::rendering::BVHBuildOptions{});
+    for (size_t j = 0; j < 63; j += 3) {
+        for (size_t i = 0; i < 63; i += 3) {
+            vira::vec3<double> origin{ static_cast<double>(i) + 0.3, static_cast<double>(j) + 0.6, 10. };
+            vira::rendering::Ray<vira::ColorRGB, double> fullRay(origin, vira::vec3<double>{ 0, 0, -1 });
+            vira::rendering::Ray<vira::ColorRGB, double> compactRay(origin, vira::vec3<double>{ 0, 0, -1 });
+            fullBLAS.intersect(fullRay);
+            compactBLAS.intersect(compactRay);
+
+            ASSERT_TRUE(std::isfinite(fullRay.hit.t));
+            ASSERT_TRUE(std::isfinite(compactRay.hit.t));
+            EXPECT_EQ(compactRay.hit.tri_id, fullRay.hit.tri_id);
+            EXPECT_NEAR(compactRay.hit.t, fullRay.hit.t, 1e-3);
+            for (size_t k = 0; k < 3; ++k) {
+                EXPECT_EQ(compactRay.hit.vert[k].uv[0], fullRay.hit.vert[k].uv[0]);
+                EXPECT_EQ(compactRay.hit.vert[k].uv[1], fullRay.hit.vert[k].uv[1]);
+            }
+        }
+    }
+
+    // Disabling compact storage restores the full buffers:
+    compact.setCompactStorage(false);
+    EXPECT_FALSE(compact.isCompact());
+    EXPECT_EQ(compact.getIndexBuffer(), grid.indexBuffer);
+    EXPECT_EQ(compact.getTriangles().size(), compact.getNumTriangles());
+}
@@ -0,0 +1,165 @@
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+
+#include "vira/vira.hpp"
+
+#include "test_scenes.hpp"
+
+// Builds a small scene with a single sphere lit by a point light, viewed by two cameras:
+static void buildScene(TestScene& scene, vira::CameraID& left, vira::CameraID& right)
+{
+    addLitSphere(scene);
+    left = addCamera(scene, -1, -8, 0, 64);
+    right = addCamera(scene, 1, -8, 0, 64);
+
+    scene.pathtracer.options.samples = 1;
+    scene.pathtracer.options.bounces = 0;
+}
+
+static void expectEqualDepth(const vira::images::Image<float>& a, const vira::images::Image<float>& b)
+{
+    ASSERT_EQ(a.size(), b.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        ASSERT_EQ(a[i], b[i]) << "Depth differs at pixel " << i;
+    }
+}
+
+static void expectEqualPower(const vira::images::Image<vira::ColorRGB>& a, const vira::images::Image<vira::ColorRGB>& b)
+{
+    ASSERT_EQ(a.size(), b.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        for (size_t k = 0; k < vira::ColorRGB::size(); ++k) {
+            ASSERT_EQ(a[i][k], b[i][k]) << "Received power differs at pixel " << i << " (channel " << k << ")";
+        }
+    }
+}
+
+static void expectEqualSensor(const vira::images::Image<float>& a, const vira::images::Image<float>& b)
+{
+    ASSERT_EQ(a.size(), b.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        ASSERT_EQ(a[i], b[i]) << "Sensor output differs at pixel " << i;
+    }
+}
+
+// Concurrent renders of one Scene must match renders performed one at a time:
+TEST(ConcurrentRender, SameSceneSeparateContexts) {
+    TestScene scene;
+    vira::CameraID left;
+    vira::CameraID right;
+    buildScene(scene, left, right);
+    scene.prepareRender({ left, right });
+
+    auto serial_context = scene.newRenderContext();
+    vira::images::Image<vira::ColorRGB> left_power = scene.renderTotalPower(left, serial_context);
+    vira::images::Image<float> left_depth = serial_context.pathtracer.renderPasses.depth;
+    vira::images::Image<vira::ColorRGB> right_power = scene.renderTotalPower(right, serial_context);
+    vira::images::Image<float> right_depth = serial_context.pathtracer.renderPasses.depth;
+
+    constexpr int REPEATS = 4;
+    for (int repeat = 0; repeat < REPEATS; ++repeat) {
+        auto left_context = scene.newRenderContext();
+        auto right_context = scene.newRenderContext();
+
+        vira::images::Image<vira::ColorRGB> left_result;
+        vira::images::Image<vira::ColorRGB> right_result;
+        std::thread left_thread([&] { left_result = scene.renderTotalPower(left, left_context); });
+        std::thread right_thread([&] { right_result = scene.renderTotalPower(right, right_context); });
+        left_thread.join();
+        right_thread.join();
+
+        expectEqualDepth(left_context.pathtracer.renderPasses.depth, left_depth);
+        expectEqualDepth(right_context.pathtracer.renderPasses.depth, right_depth);
+        expectEqualPower(left_result, left_power);
+        expectEqualPower(right_result, right_power);
+    }
+}
+
+// Context renders never modify the Scene or its cameras, so they must be prepared beforehand:
+TEST(ConcurrentRender, RequiresPreparedScene) {
+    TestScene scene;
+    vira::CameraID left;
+    vira::CameraID right;
+    buildScene(scene, left, right);
+
+    auto context = scene.newRenderContext();
+    EXPECT_FALSE(scene.isPrepared());
+    EXPECT_THROW(scene.renderTotalPower(left, context), std::runtime_error);
+
+    scene.prepareRender({ left });
+    EXPECT_TRUE(scene.isPrepared());
+    EXPECT_NO_THROW(scene.renderTotalPower(left, context));
+    EXPECT_THROW(scene.renderTotalPower(right, context), std::runtime_error);
+
+    scene.markDirty();
+    EXPECT_FALSE(scene.isPrepared());
+    EXPECT_THROW(scene.renderTotalPower(left, context), std::runtime_error);
+}
+
+// Independent Scenes share no mutable state, even when first prepared concurrently:
+TEST(ConcurrentRender, IndependentScenes) {
+    constexpr size_t NUM_SCENES = 4;
+
+    std::vector<vira::images::Image<float>> depths(NUM_SCENES);
+    std::vector<vira::images::Image<vira::ColorRGB>> powers(NUM_SCENES);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < NUM_SCENES; ++i) {
+        threads.emplace_back([&depths, &powers, i] {
+            TestScene scene;
+            vira::CameraID left;
+            vira::CameraID right;
+            buildScene(scene, left, right);
+
+            scene.pathtraceRender(left);
+            depths[i] = scene.pathtracer.renderPasses.depth;
+            powers[i] = scene.pathtracer.renderPasses.received_power;
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t i = 1; i < NUM_SCENES; ++i) {
+        expectEqualDepth(depths[i], depths[0]);
+        expectEqualPower(powers[i], powers[0]);
+    }
+}
+
+// Sensor simulation is const and may be shared between threads, and its noise depends only on the seed and stream:
+TEST(ConcurrentRender, ConcurrentSensorSimulation) {
+    TestScene scene;
+    vira::CameraID left;
+    vira::CameraID right;
+    buildScene(scene, left, right);
+    scene[left].setDefaultLowNoise();
+    scene[left].setSeed(1234);
+    scene.prepareRender({ left });
+
+    auto context = scene.newRenderContext();
+    vira::images::Image<vira::ColorRGB> power = scene.renderTotalPower(left, context);
+
+    const auto& camera = scene[left];
+    constexpr size_t NUM_THREADS = 4;
+
+    std::vector<vira::images::Image<float>> expected(NUM_THREADS);
+    for (size_t i = 0; i < NUM_THREADS; ++i) {
+        expected[i] = camera.simulateSensor(power, i);
+    }
+
+    std::vector<vira::images::Image<float>> outputs(NUM_THREADS);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back([&, i] { outputs[i] = camera.simulateSensor(power, i); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < NUM_THREADS; ++i) {
+        expectEqualSensor(outputs[i], expected[i]);
+    }
+}
@@ -0,0 +1,77 @@
+#include <cmath>
+#include <cstddef>
+
+#include "gtest/gtest.h"
+
+#include "vira/vira.hpp"
+
+#include "test_scenes.hpp"
+
+// Builds a terrain, partly shadowed and occluded by a second, smaller instance floating above it:
+static vira::CameraID buildScene(TestScene& scene)
+{
+    vira::MeshID terrain = addLitTerrain(scene, 48, 4.f);
+    scene.newInstance(terrain);
+
+    vira::InstanceID tile = scene.newInstance(terrain);
+    scene[tile].setLocalScale(0.15, 0.15, 0.15);
+    scene[tile].setLocalPosition(0.3, -0.2, 1.5);
+    scene[tile].setLocalEulerAngles(vira::units::Degree(20), vira::units::Degree(-10), vira::units::Degree(35));
+
+    vira::CameraID camera = addCamera(scene, 0, -4, 8, 64);
+
+    // A single primary ray through each pixel sample location, so both renders trace the same rays:
+    scene.pathtracer.options.samples = 1;
+    scene.pathtracer.options.bounces = 0;
+    scene.pathtracer.options.collect_statistics = true;
+    return camera;
+}
+
+// Primary visibility resolved by rasterization must reproduce the traced render of a triangle mesh scene:
+TEST(RasterPrimary, MatchesTracedPrimaryVisibility) {
+    TestScene scene;
+    vira::CameraID camera = buildScene(scene);
+
+    scene.pathtracer.options.raster_primary = false;
+    scene.pathtraceRender(camera);
+    vira::rendering::RenderPasses<vira::ColorRGB, float> traced = scene.pathtracer.renderPasses;
+    EXPECT_EQ(scene.pathtracer.statistics.totals.visibility_hits, 0u);
+
+    scene.pathtracer.options.raster_primary = true;
+    scene.pathtraceRender(camera);
+    const vira::rendering::RenderPasses<vira::ColorRGB, float>& rasterized = scene.pathtracer.renderPasses;
+
+    // Nearly every pixel must have been resolved from the visibility buffer (rather than traced):
+    const size_t pixels = traced.depth.size();
+    EXPECT_GT(scene.pathtracer.statistics.totals.visibility_hits, pixels * 9 / 10);
+
+    ASSERT_EQ(rasterized.depth.size(), pixels);
+    ASSERT_EQ(rasterized.total_radiance.size(), pixels);
+
+    // Pixel samples lying exactly on a shared triangle edge may resolve to either triangle:
+    size_t id_mismatches = 0;
+    size_t hits = 0;
+    for (size_t i = 0; i < pixels; ++i) {
+        bool traced_hit = !std::isinf(traced.depth[i]);
+        bool rasterized_hit = !std::isinf(rasterized.depth[i]);
+        ASSERT_EQ(rasterized_hit, traced_hit) << "Coverage differs at pixel " << i;
+        if (!traced_hit) {
+            continue;
+        }
+        hits++;
+
+        EXPECT_NEAR(rasterized.depth[i], traced.depth[i], 1e-4f * traced.depth[i]) << "Depth differs at pixel " << i;
+        EXPECT_EQ(rasterized.instance_id[i], traced.instance_id[i]) << "Instance differs at pixel " << i;
+        if (rasterized.triangle_id[i] != traced.triangle_id[i]) {
+            id_mismatches++;
+        }
+
+        for (size_t k = 0; k < vira::ColorRGB::size(); ++k) {
+            float expected = traced.total_radiance[i][k];
+            EXPECT_NEAR(rasterized.total_radiance[i][k], expected, 1e-3f * std::abs(expected) + 1e-6f) << "Radiance differs at pixel " << i << " (channel " << k << ")";
+        }
+    }
+
+    EXPECT_GT(hits, pixels / 2);
+    EXPECT_LE(id_mismatches, hits / 100);
+}
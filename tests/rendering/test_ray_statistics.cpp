@@ -0,0 +1,54 @@
+#include <cstddef>
+#include <cstdint>
+
+#include "gtest/gtest.h"
+
+#include "vira/vira.hpp"
+
+#include "test_scenes.hpp"
+
+// Builds a sphere lit by a point light, filling the view of a single camera:
+static vira::CameraID buildScene(TestScene& scene)
+{
+    addLitSphere(scene);
+    vira::CameraID camera = addCamera(scene, 0, -8, 0, 32);
+
+    scene.pathtracer.options.samples = 4;
+    scene.pathtracer.options.bounces = 1;
+    return camera;
+}
+
+TEST(RayStatistics, DisabledByDefault) {
+    TestScene scene;
+    vira::CameraID camera = buildScene(scene);
+
+    scene.pathtraceRender(camera);
+
+    const auto& stats = scene.pathtracer.statistics;
+    EXPECT_EQ(stats.totals.tracedRays(), 0u);
+    EXPECT_EQ(stats.pixels, 0u);
+    EXPECT_EQ(vira::rendering::activeRayCounters(), nullptr);
+}
+
+TEST(RayStatistics, CountsEveryPixelAndSample) {
+    TestScene scene;
+    vira::CameraID camera = buildScene(scene);
+    scene.pathtracer.options.collect_statistics = true;
+
+    scene.pathtraceRender(camera);
+
+    const auto& stats = scene.pathtracer.statistics;
+    const size_t pixels = 32 * 32;
+    EXPECT_EQ(stats.pixels, pixels);
+    EXPECT_EQ(stats.totals.primary_rays, pixels * 4);
+    EXPECT_GT(stats.totals.shadow_rays, 0u);
+    EXPECT_GT(stats.trace_seconds, 0.0);
+
+    // Without adaptive sampling, every pixel takes every sample:
+    ASSERT_EQ(stats.spp_histogram.size(), 5u);
+    EXPECT_EQ(stats.spp_histogram[4], pixels);
+    EXPECT_DOUBLE_EQ(stats.meanSamplesPerPixel(), 4.0);
+
+    // The worker threads' counters must not leak past the render:
+    EXPECT_EQ(vira::rendering::activeRayCounters(), nullptr);
+}
@@ -0,0 +1,71 @@
+#ifndef VIRA_TESTS_RENDERING_TEST_SCENES_HPP
+#define VIRA_TESTS_RENDERING_TEST_SCENES_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "vira/vira.hpp"
+
+// Scenes shared by the rendering tests:
+using TestScene = vira::Scene<vira::ColorRGB, float, float>;
+
+// Adds a unit sphere lit by a point light:
+inline void addLitSphere(TestScene& scene)
+{
+    vira::MaterialID material = scene.newLambertianMaterial();
+    vira::MeshID sphere = scene.addEllipsoidMesh(vira::geometry::AnalyticEllipsoid<vira::ColorRGB, float>(1.f), material);
+    scene.newInstance(sphere);
+
+    auto light = scene.newPointLight(1000.f);
+    scene[light].setLocalPosition(0, -10, 10);
+}
+
+// Adds an n x n triangle mesh of a rolling surface spanning [-extent, extent] in x and y, lit by a point light:
+inline vira::MeshID addLitTerrain(TestScene& scene, size_t n, float extent)
+{
+    vira::geometry::VertexBuffer<vira::ColorRGB, float> vertexBuffer;
+    for (size_t j = 0; j < n; ++j) {
+        for (size_t i = 0; i < n; ++i) {
+            float x = extent * (2.f * static_cast<float>(i) / static_cast<float>(n - 1) - 1.f);
+            float y = extent * (2.f * static_cast<float>(j) / static_cast<float>(n - 1) - 1.f);
+
+            vira::geometry::Vertex<vira::ColorRGB, float> vertex;
+            vertex.position = vira::vec3<float>{ x, y, 0.3f * std::sin(1.7f * x) * std::cos(1.3f * y) };
+            vertexBuffer.push_back(vertex);
+        }
+    }
+
+    vira::geometry::IndexBuffer indexBuffer;
+    for (size_t j = 0; j + 1 < n; ++j) {
+        for (size_t i = 0; i + 1 < n; ++i) {
+            uint32_t a = static_cast<uint32_t>(j * n + i);
+            uint32_t b = a + 1;
+            uint32_t c = a + static_cast<uint32_t>(n);
+            uint32_t d = c + 1;
+            indexBuffer.insert(indexBuffer.end(), { a, b, d, a, d, c });
+        }
+    }
+
+    vira::MaterialID material = scene.newLambertianMaterial();
+    vira::MeshID terrain = scene.addMesh(std::make_unique<vira::geometry::Mesh<vira::ColorRGB, float, float>>(vertexBuffer, indexBuffer));
+    scene[terrain].setMaterial(0, material);
+
+    auto light = scene.newPointLight(1000.f);
+    scene[light].setLocalPosition(3, -10, 10);
+    return terrain;
+}
+
+// Adds a square camera at the given position, looking at the sphere:
+inline vira::CameraID addCamera(TestScene& scene, float x, float y, float z, size_t resolution)
+{
+    vira::CameraID camera = scene.newCamera();
+    scene[camera].setResolution(resolution, resolution);
+    scene[camera].setFocalLength(0.05);
+    scene[camera].setLocalPosition(x, y, z);
+    scene[camera].lookAt(vira::vec3<float>{ 0, 0, 0 });
+    return camera;
+}
+
+#endif
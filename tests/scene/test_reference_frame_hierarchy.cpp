@@ -0,0 +1,96 @@
+#include <cstdio>
+#include <cmath>
+#include <utility>
+#include <string>
+#include <filesystem>
+
+#include "gtest/gtest.h"
+#include "cspice/SpiceUsr.h"
+
+#include "vira/vira.hpp"
+
+namespace fs = std::filesystem;
+
+using TestScene = vira::Scene<vira::ColorRGB, float, float>;
+
+// Two bodies in linear motion (1001 about the SSB, and 1002 about 1001), each with a fixed frame rotated
+// relative to the other, so that a child's velocity relative to its parent differs between their axes:
+static void loadTestKernels(const fs::path& spk_path)
+{
+    const char* frames[] = {
+        "FRAME_TEST_PARENT_FRAME = 1400001",
+        "FRAME_1400001_NAME = 'TEST_PARENT_FRAME'",
+        "FRAME_1400001_CLASS = 4",
+        "FRAME_1400001_CLASS_ID = 1400001",
+        "FRAME_1400001_CENTER = 1001",
+        "TKFRAME_1400001_RELATIVE = 'J2000'",
+        "TKFRAME_1400001_SPEC = 'ANGLES'",
+        "TKFRAME_1400001_UNITS = 'DEGREES'",
+        "TKFRAME_1400001_AXES = ( 3, 1, 3 )",
+        "TKFRAME_1400001_ANGLES = ( 30, 20, 0 )",
+        "FRAME_TEST_CHILD_FRAME = 1400002",
+        "FRAME_1400002_NAME = 'TEST_CHILD_FRAME'",
+        "FRAME_1400002_CLASS = 4",
+        "FRAME_1400002_CLASS_ID = 1400002",
+        "FRAME_1400002_CENTER = 1002",
+        "TKFRAME_1400002_RELATIVE = 'TEST_PARENT_FRAME'",
+        "TKFRAME_1400002_SPEC = 'ANGLES'",
+        "TKFRAME_1400002_UNITS = 'DEGREES'",
+        "TKFRAME_1400002_AXES = ( 1, 2, 3 )",
+        "TKFRAME_1400002_ANGLES = ( 90, 45, 0 )"
+    };
+    lmpool_c(frames, 81, static_cast<SpiceInt>(sizeof(frames) / sizeof(frames[0])));
+
+    std::remove(spk_path.string().c_str());
+
+    SpiceInt handle;
+    spkopn_c(spk_path.string().c_str(), "vira test", 0, &handle);
+
+    SpiceDouble epochs[2] = { -1000., 1000. };
+    SpiceDouble parent_states[2][6] = {
+        { 1.e5 - 10., 2.e5 - 20., 3.e5 - 5., 0.01, 0.02, 0.005 },
+        { 1.e5 + 10., 2.e5 + 20., 3.e5 + 5., 0.01, 0.02, 0.005 }
+    };
+    SpiceDouble child_states[2][6] = {
+        { 100. - 1., 50. + 2., -20. - 0.5, 0.001, -0.002, 0.0005 },
+        { 100. + 1., 50. - 2., -20. + 0.5, 0.001, -0.002, 0.0005 }
+    };
+    spkw09_c(handle, 1001, 0, "J2000", epochs[0], epochs[1], "PARENT", 1, 2, parent_states, epochs);
+    spkw09_c(handle, 1002, 1001, "J2000", epochs[0], epochs[1], "CHILD", 1, 2, child_states, epochs);
+    spkcls_c(handle);
+
+    furnsh_c(spk_path.string().c_str());
+}
+
+// Global velocities propagated through the hierarchy must match SPICE states queried in the Scene's frame:
+TEST(ReferenceFrameHierarchy, SpiceVelocityMatchesGlobalQuery) {
+    fs::path spk_path = fs::temp_directory_path() / "vira_test_hierarchy.bsp";
+    loadTestKernels(spk_path);
+    ASSERT_FALSE(failed_c());
+
+    TestScene scene;
+    scene.configureSPICE("0", "J2000");
+
+    vira::GroupID parent = scene.newGroup();
+    scene[parent].configureSPICE("1001", "TEST_PARENT_FRAME");
+
+    vira::GroupID child = scene[parent].newGroup();
+    scene[child].configureSPICE("1002", "TEST_CHILD_FRAME");
+
+    const double et = 250.;
+    scene.setSpiceET(et);
+
+    for (auto [id, naif] : { std::pair{ parent, std::string("1001") }, std::pair{ child, std::string("1002") } }) {
+        auto state = vira::SpiceUtils<float>::spkezr(naif, et, "J2000", "NONE", "0");
+
+        vira::vec3<float> position = scene[id].getGlobalPosition();
+        vira::vec3<float> velocity = scene[id].getGlobalVelocity();
+        for (int i = 0; i < 3; ++i) {
+            EXPECT_NEAR(position[i], state[0][i], 1e-5f * std::abs(state[0][i]) + 1e-2f) << naif << " position[" << i << "]";
+            EXPECT_NEAR(velocity[i], state[1][i], 1e-4f * std::abs(state[1][i]) + 1e-3f) << naif << " velocity[" << i << "]";
+        }
+    }
+
+    unload_c(spk_path.string().c_str());
+    std::remove(spk_path.string().c_str());
+}